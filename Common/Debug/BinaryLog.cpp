@@ -0,0 +1,342 @@
+#include "Debug/BinaryLog.h"
+
+#include <string.h>
+#include <ostream>
+#include <iterator>
+#include <chrono>
+#include <cassert>
+
+
+//the file starts with "SSLG", the version and the table of messages,
+//followed by the records
+static const char LogMagic[4] = {'S','S','L','G'};
+
+static const unsigned int LogVersion = 1;
+
+
+//------------------------------------------------------------------------
+//
+//  helpers for writing and reading little endian values
+//------------------------------------------------------------------------
+static void PutU16(std::vector<unsigned char>& buf, unsigned int val)
+{
+  for (int b=0; b<2; ++b) buf.push_back((unsigned char)(val >> (8*b)));
+}
+
+static void PutU32(std::vector<unsigned char>& buf, unsigned int val)
+{
+  for (int b=0; b<4; ++b) buf.push_back((unsigned char)(val >> (8*b)));
+}
+
+static void PutU64(std::vector<unsigned char>& buf, unsigned long long val)
+{
+  for (int b=0; b<8; ++b) buf.push_back((unsigned char)(val >> (8*b)));
+}
+
+static unsigned long long GetUInt(const unsigned char* p, int NumBytes)
+{
+  unsigned long long val = 0;
+
+  for (int b=0; b<NumBytes; ++b) val |= (unsigned long long)p[b] << (8*b);
+
+  return val;
+}
+
+
+//------------------------------- ctor ----------------------------------------
+//-----------------------------------------------------------------------------
+BinaryLog::BinaryLog():m_iLevel(log_off),
+                       m_bStop(false)
+{}
+
+BinaryLog* BinaryLog::Instance()
+{
+  static BinaryLog instance;
+
+  return &instance;
+}
+
+//----------------------------- SetMessages -----------------------------------
+//-----------------------------------------------------------------------------
+void BinaryLog::SetMessages(const LogMessage* messages, int NumMessages)
+{
+  for (int m=0; m<NumMessages; ++m)
+  {
+    assert (messages[m].Id == m && "<BinaryLog::SetMessages>: the table is out of order");
+  }
+
+  m_Messages.assign(messages, messages + NumMessages);
+}
+
+//------------------------------- AddRing -------------------------------------
+//-----------------------------------------------------------------------------
+BinaryLog::LogRing* BinaryLog::AddRing()
+{
+  std::lock_guard<std::mutex> lock(m_RingsMutex);
+
+  m_Rings.push_back(new LogRing(RingCapacity));
+
+  return m_Rings.back();
+}
+
+//-------------------------------- Open ---------------------------------------
+//-----------------------------------------------------------------------------
+bool BinaryLog::Open(const std::string& filename, int level)
+{
+  Close();
+
+  m_File.open(filename.c_str(), std::ios::binary);
+
+  if (!m_File) return false;
+
+  std::vector<unsigned char> header(LogMagic, LogMagic + 4);
+
+  PutU32(header, LogVersion);
+  PutU32(header, (unsigned int)m_Messages.size());
+
+  for (unsigned int m=0; m<m_Messages.size(); ++m)
+  {
+    unsigned int length = (unsigned int)strlen(m_Messages[m].Format);
+
+    PutU32(header, length);
+
+    header.insert(header.end(), m_Messages[m].Format, m_Messages[m].Format + length);
+  }
+
+  m_File.write((const char*)&header[0], header.size());
+
+  m_bStop.store(false);
+
+  m_Writer = std::thread(&BinaryLog::WriterLoop, this);
+
+  m_iLevel.store(level);
+
+  return true;
+}
+
+//-------------------------------- Close --------------------------------------
+//-----------------------------------------------------------------------------
+void BinaryLog::Close()
+{
+  if (!m_File.is_open()) return;
+
+  m_iLevel.store(log_off);
+
+  m_bStop.store(true);
+
+  m_Writer.join();
+
+  m_File.close();
+}
+
+//------------------------------ NumDropped -----------------------------------
+//-----------------------------------------------------------------------------
+size_t BinaryLog::NumDropped()
+{
+  std::lock_guard<std::mutex> lock(m_RingsMutex);
+
+  size_t total = 0;
+
+  for (unsigned int r=0; r<m_Rings.size(); ++r)
+  {
+    total += m_Rings[r]->NumDropped();
+  }
+
+  return total;
+}
+
+//----------------------------- WriterLoop ------------------------------------
+//
+//  drains the rings, sleeping a little whenever they are all found empty.
+//  Once asked to stop it empties them one last time
+//-----------------------------------------------------------------------------
+void BinaryLog::WriterLoop()
+{
+  for (;;)
+  {
+    bool stopping = m_bStop.load();
+
+    if (Drain() == 0)
+    {
+      if (stopping) break;
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  m_File.flush();
+}
+
+//-------------------------------- Drain --------------------------------------
+//
+//  each record is written as its ID, level, number of arguments, which of
+//  them are doubles, the index of the thread's ring, the tick and the
+//  arguments
+//-----------------------------------------------------------------------------
+int BinaryLog::Drain()
+{
+  const size_t BatchSize = 256;
+
+  LogRecord batch[BatchSize];
+
+  std::vector<unsigned char> buf;
+
+  int NumWritten = 0;
+
+  std::lock_guard<std::mutex> lock(m_RingsMutex);
+
+  for (unsigned int ring=0; ring<m_Rings.size(); ++ring)
+  {
+    size_t count;
+
+    while ((count = m_Rings[ring]->Pop(batch, BatchSize)) > 0)
+    {
+      buf.clear();
+
+      for (size_t i=0; i<count; ++i)
+      {
+        const LogRecord& r = batch[i];
+
+        PutU16(buf, r.Id);
+        buf.push_back(r.Level);
+        buf.push_back(r.NumArgs);
+        buf.push_back(r.DoubleArgs);
+        PutU16(buf, ring);
+        PutU64(buf, (unsigned long long)(long long)r.Tick);
+
+        for (int a=0; a<r.NumArgs; ++a)
+        {
+          PutU64(buf, (unsigned long long)r.Args[a].i);
+        }
+      }
+
+      m_File.write((const char*)&buf[0], buf.size());
+
+      NumWritten += (int)count;
+    }
+  }
+
+  return NumWritten;
+}
+
+
+//------------------------------- Decode --------------------------------------
+//
+//  writes each record as its tick, thread, level and message, with the
+//  message's {}s replaced by its arguments in turn
+//-----------------------------------------------------------------------------
+bool BinaryLog::Decode(const std::string& filename, std::ostream& os)
+{
+  std::ifstream file(filename.c_str(), std::ios::binary);
+
+  if (!file) return false;
+
+  std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)),
+                                   std::istreambuf_iterator<char>());
+
+  const unsigned char* p   = data.empty() ? NULL : &data[0];
+  const unsigned char* end = p + data.size();
+
+  if (end - p < 12 || memcmp(p, LogMagic, 4) != 0) return false;
+
+  if (GetUInt(p+4, 4) != LogVersion) return false;
+
+  unsigned int NumMessages = (unsigned int)GetUInt(p+8, 4);
+
+  p += 12;
+
+  std::vector<std::string> formats;
+
+  for (unsigned int m=0; m<NumMessages; ++m)
+  {
+    if (end - p < 4) return false;
+
+    unsigned int length = (unsigned int)GetUInt(p, 4);
+
+    p += 4;
+
+    if ((unsigned int)(end - p) < length) return false;
+
+    formats.push_back(std::string((const char*)p, length));
+
+    p += length;
+  }
+
+  //the fixed part of a record is 15 bytes
+  while (end - p >= 15)
+  {
+    unsigned int id      = (unsigned int)GetUInt(p, 2);
+    int          level   = p[2];
+    int          NumArgs = p[3];
+    int          doubles = p[4];
+    unsigned int thread  = (unsigned int)GetUInt(p+5, 2);
+    long long    tick    = (long long)GetUInt(p+7, 8);
+
+    p += 15;
+
+    if (end - p < 8*NumArgs) return false;
+
+    os << tick << '\t' << thread << '\t' << LevelName(level) << '\t';
+
+    const std::string unknown("unknown message");
+
+    const std::string& format = id < formats.size() ? formats[id] : unknown;
+
+    int arg = 0;
+
+    for (size_t c=0; c<format.size(); ++c)
+    {
+      if (format[c] == '{' && c+1 < format.size() && format[c+1] == '}' && arg < NumArgs)
+      {
+        unsigned long long bits = GetUInt(p + 8*arg, 8);
+
+        if (doubles & (1 << arg))
+        {
+          double val;
+
+          memcpy(&val, &bits, sizeof(val));
+
+          os << val;
+        }
+        else
+        {
+          os << (long long)bits;
+        }
+
+        ++arg;
+        ++c;
+      }
+      else
+      {
+        os << format[c];
+      }
+    }
+
+    os << '\n';
+
+    p += 8*NumArgs;
+  }
+
+  return p == end;
+}
+
+//------------------------------ LevelName ------------------------------------
+//-----------------------------------------------------------------------------
+static const char* const LevelNames[] = {"trace", "debug", "info", "warning", "error", "off"};
+
+const char* BinaryLog::LevelName(int level)
+{
+  if (level < log_trace || level > log_off) return "unknown";
+
+  return LevelNames[level];
+}
+
+int BinaryLog::LevelFromName(const std::string& name)
+{
+  for (int level=log_trace; level<=log_off; ++level)
+  {
+    if (name == LevelNames[level]) return level;
+  }
+
+  return -1;
+}
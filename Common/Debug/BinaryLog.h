@@ -0,0 +1,236 @@
+#ifndef BINARYLOG_H
+#define BINARYLOG_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   BinaryLog.h
+//
+//  Desc:   a logger for code that runs every tick. A call records the ID
+//          of a message and its raw arguments in a ring belonging to the
+//          calling thread; nothing is formatted or allocated. A thread of
+//          the logger's own drains the rings to a binary file, and the
+//          messages are only turned into text when the file is decoded
+//          (offline, with Decode).
+//
+//          The program gives the logger a table of its messages, which is
+//          written at the start of the file so the file can be decoded
+//          without the program. An argument is marked in the message's
+//          format by {}, eg.
+//
+//            {msg_chase, "Player {} enters chase state"}
+//
+//            binlog(log_debug, msg_chase, player->ID());
+//
+//          Messages are filtered twice: any with a level below BINLOG_LEVEL
+//          are compiled out altogether, and of the rest only those at or
+//          above the level the log was opened with are recorded. Until it
+//          is opened the log records nothing, and a call costs a test.
+//
+//          If a thread logs faster than its ring is drained the messages
+//          that don't fit are dropped and counted.
+//
+//------------------------------------------------------------------------
+#include <vector>
+#include <string>
+#include <iosfwd>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+#include "misc/SpscRing.h"
+#include "2D/Vector2D.h"
+#include "Time/SimClock.h"
+
+
+enum log_level {log_trace, log_debug, log_info, log_warning, log_error, log_off};
+
+//messages below this level are compiled out
+#ifndef BINLOG_LEVEL
+#define BINLOG_LEVEL log_trace
+#endif
+
+//use this to log a message: binlog(level, id, args...)
+#define binlog(level, ...)                                               \
+  do                                                                     \
+  {                                                                      \
+    if ((level) >= BINLOG_LEVEL && BinLog->isOn(level))                  \
+    {                                                                    \
+      BinLog->Write((level), __VA_ARGS__);                               \
+    }                                                                    \
+  } while (0)
+
+#define BinLog BinaryLog::Instance()
+
+
+//an entry of the program's table of messages. The table is indexed by
+//ID, so Id must be the entry's position in it
+struct LogMessage
+{
+  int          Id;
+  const char*  Format;
+};
+
+
+//what is recorded of each call
+struct LogRecord
+{
+  enum {MaxArgs = 6};
+
+  unsigned short  Id;
+  unsigned char   Level;
+  unsigned char   NumArgs;
+
+  //bit i is set if argument i is a double, otherwise it is an integer
+  unsigned char   DoubleArgs;
+
+  //the tick of the calling thread's simulation clock
+  long            Tick;
+
+  union
+  {
+    long long     i;
+    double        d;
+  } Args[MaxArgs];
+
+  //arguments beyond MaxArgs are ignored
+  void  Add(long long val)
+  {
+    if (NumArgs < MaxArgs) Args[NumArgs++].i = val;
+  }
+
+  void  Add(double val)
+  {
+    if (NumArgs < MaxArgs)
+    {
+      DoubleArgs |= (unsigned char)(1 << NumArgs);
+
+      Args[NumArgs++].d = val;
+    }
+  }
+};
+
+
+class BinaryLog
+{
+private:
+
+  typedef SpscRing<LogRecord> LogRing;
+
+  //the number of records each thread's ring holds
+  enum {RingCapacity = 4096};
+
+  //the messages are recorded only if at or above this level. log_off
+  //while the log is closed
+  std::atomic<int>      m_iLevel;
+
+  std::vector<LogMessage> m_Messages;
+
+  //a ring for every thread that has logged anything. Never freed, since a
+  //thread keeps a pointer to its ring for as long as it runs
+  std::vector<LogRing*> m_Rings;
+
+  //guards m_Rings
+  std::mutex            m_RingsMutex;
+
+  std::ofstream         m_File;
+
+  std::thread           m_Writer;
+
+  std::atomic<bool>     m_bStop;
+
+  BinaryLog();
+
+  BinaryLog(const BinaryLog&);
+  BinaryLog& operator=(const BinaryLog&);
+
+  //creates a ring for the calling thread
+  LogRing*  AddRing();
+
+  LogRing*  ThreadRing()
+  {
+    static thread_local LogRing* ring = NULL;
+
+    if (!ring) ring = AddRing();
+
+    return ring;
+  }
+
+  //the writer thread's loop, and one pass over the rings. Drain returns
+  //the number of records written
+  void      WriterLoop();
+  int       Drain();
+
+  //add the arguments to a record
+  static void  Encode(LogRecord&){}
+
+  template <class T, class... Rest>
+  static void  Encode(LogRecord& r, const T& arg, const Rest&... rest)
+  {
+    Put(r, arg);
+
+    Encode(r, rest...);
+  }
+
+  static void  Put(LogRecord& r, int val)               {r.Add((long long)val);}
+  static void  Put(LogRecord& r, long val)              {r.Add((long long)val);}
+  static void  Put(LogRecord& r, unsigned int val)      {r.Add((long long)val);}
+  static void  Put(LogRecord& r, bool val)              {r.Add((long long)val);}
+  static void  Put(LogRecord& r, double val)            {r.Add(val);}
+  static void  Put(LogRecord& r, const Vector2D& val)   {r.Add(val.x); r.Add(val.y);}
+
+public:
+
+  static BinaryLog* Instance();
+
+  ~BinaryLog(){Close();}
+
+  //the program's messages. Set them before the log is opened
+  void  SetMessages(const LogMessage* messages, int NumMessages);
+
+  //starts recording the messages at or above level to the file. Returns
+  //false if the file cannot be opened
+  bool  Open(const std::string& filename, int level);
+
+  //writes what is still in the rings and closes the file
+  void  Close();
+
+  bool  isOpen()const{return m_File.is_open();}
+
+  void  SetLevel(int level){if (isOpen()) m_iLevel.store(level, std::memory_order_relaxed);}
+
+  bool  isOn(int level)const{return level >= m_iLevel.load(std::memory_order_relaxed);}
+
+  //records a message in the calling thread's ring. Use the binlog macro
+  //rather than calling this directly
+  template <class... Args>
+  void  Write(int level, int id, const Args&... args)
+  {
+    LogRecord r;
+
+    r.Id         = (unsigned short)id;
+    r.Level      = (unsigned char)level;
+    r.NumArgs    = 0;
+    r.DoubleArgs = 0;
+    r.Tick       = SimTime->GetCurrentTick();
+
+    Encode(r, args...);
+
+    ThreadRing()->TryPush(r);
+  }
+
+  //the number of messages dropped because a ring was full
+  size_t  NumDropped();
+
+  //writes the messages of a log file to os as text, a line each. Returns
+  //false if the file is not a log
+  static bool  Decode(const std::string& filename, std::ostream& os);
+
+  //the level of the given name (trace, debug...), or -1
+  static int         LevelFromName(const std::string& name);
+  static const char* LevelName(int level);
+};
+
+
+
+#endif
@@ -1,41 +1,39 @@
-#include "game/EntityManager.h"
-#include "game/BaseGameEntity.h"
-
-
-//--------------------------- Instance ----------------------------------------
-//
-//   this class is a singleton
-//-----------------------------------------------------------------------------
-EntityManager* EntityManager::Instance()
-{
-  static EntityManager instance;
-
-  return &instance;
-}
-
-//------------------------- GetEntityFromID -----------------------------------
-//-----------------------------------------------------------------------------
-BaseGameEntity* EntityManager::GetEntityFromID(int id)const
-{
-  //find the entity
-  EntityMap::const_iterator ent = m_EntityMap.find(id);
-
-  //assert that the entity is a member of the map
-  assert ( (ent !=  m_EntityMap.end()) && "<EntityManager::GetEntityFromID>: invalid ID");
-
-  return ent->second;
-}
-
-//--------------------------- RemoveEntity ------------------------------------
-//-----------------------------------------------------------------------------
-void EntityManager::RemoveEntity(BaseGameEntity* pEntity)
-{    
-  m_EntityMap.erase(m_EntityMap.find(pEntity->ID()));
-} 
-
-//---------------------------- RegisterEntity ---------------------------------
-//-----------------------------------------------------------------------------
-void EntityManager::RegisterEntity(BaseGameEntity* NewEntity)
-{
-  m_EntityMap.insert(std::make_pair(NewEntity->ID(), NewEntity));
-}
+#include "Game/EntityManager.h"
+#include "Game/BaseGameEntity.h"
+#include "Game/GameWorld.h"
+
+
+//--------------------------- Instance ----------------------------------------
+//
+//   returns the entity manager of the current world
+//-----------------------------------------------------------------------------
+EntityManager* EntityManager::Instance()
+{
+  return GameWorld::Current()->GetEntityManager();
+}
+
+//--------------------------- RemoveEntity ------------------------------------
+//-----------------------------------------------------------------------------
+void EntityManager::RemoveEntity(BaseGameEntity* pEntity)
+{    
+  assert ( (GetEntityFromID(pEntity->ID()) == pEntity) &&
+           "<EntityManager::RemoveEntity>: entity not registered");
+
+  m_Entities[pEntity->ID()] = NULL;
+} 
+
+//---------------------------- RegisterEntity ---------------------------------
+//-----------------------------------------------------------------------------
+void EntityManager::RegisterEntity(BaseGameEntity* NewEntity)
+{
+  int id = NewEntity->ID();
+
+  assert ( (id >= 0) && "<EntityManager::RegisterEntity>: invalid ID");
+
+  if (id >= (int)m_Entities.size())
+  {
+    m_Entities.resize(id + 1, NULL);
+  }
+
+  m_Entities[id] = NewEntity;
+}
@@ -1,67 +1,81 @@
-#ifndef ENTITYMANAGER_H
-#define ENTITYMANAGER_H
-#pragma warning (disable:4786)
-//------------------------------------------------------------------------
-//
-//  Name:   EntityManager.h
-//
-//  Desc:   Singleton class to handle the  management of Entities.          
-//
-//  Author: Mat Buckland (fup@ai-junkie.com)
-//
-//------------------------------------------------------------------------
-#include <map>
-#include <cassert>
-
-
-class BaseGameEntity;
-
-//provide easy access
-#define EntityMgr EntityManager::Instance()
-
-
-
-class EntityManager
-{
-private:
-
-  typedef std::map<int, BaseGameEntity*> EntityMap;
-
-private:
-
-  //to facilitate quick lookup the entities are stored in a std::map, in which
-  //pointers to entities are cross referenced by their identifying number
-  EntityMap m_EntityMap;
-
-  EntityManager(){}
-
-  //copy ctor and assignment should be private
-  EntityManager(const EntityManager&);
-  EntityManager& operator=(const EntityManager&);
-
-public:
-
-  static EntityManager* Instance();
-
-  //this method stores a pointer to the entity in the std::vector
-  //m_Entities at the index position indicated by the entity's ID
-  //(makes for faster access)
-  void            RegisterEntity(BaseGameEntity* NewEntity);
-
-  //returns a pointer to the entity with the ID given as a parameter
-  BaseGameEntity* GetEntityFromID(int id)const;
-
-  //this method removes the entity from the list
-  void            RemoveEntity(BaseGameEntity* pEntity);
-
-  //clears all entities from the entity map
-  void            Reset(){m_EntityMap.clear();}
-};
-
-
-
-
-
-
-
+#ifndef ENTITYMANAGER_H
+#define ENTITYMANAGER_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   EntityManager.h
+//
+//  Desc:   Singleton class to handle the  management of Entities.          
+//          There is one instance per GameWorld; Instance returns the
+//          one belonging to the world bound to the calling thread.
+//
+//  Author: Mat Buckland (fup@ai-junkie.com)
+//
+//------------------------------------------------------------------------
+#include <vector>
+#include <cstddef>
+#include <cassert>
+
+
+class BaseGameEntity;
+
+//provide easy access
+#define EntityMgr EntityManager::Instance()
+
+
+
+class EntityManager
+{
+private:
+
+  //IDs are handed out consecutively from zero in each world, so to
+  //facilitate quick lookup the entities are stored in a std::vector at the
+  //index given by their ID. Unused IDs hold NULL
+  std::vector<BaseGameEntity*> m_Entities;
+
+  //the ID the next entity created in this world will be given
+  int       m_iNextValidID;
+
+  EntityManager():m_iNextValidID(0){}
+
+  friend class GameWorld;
+
+  //copy ctor and assignment should be private
+  EntityManager(const EntityManager&);
+  EntityManager& operator=(const EntityManager&);
+
+public:
+
+  static EntityManager* Instance();
+
+  //this method stores a pointer to the entity in the std::vector
+  //m_Entities at the index position indicated by the entity's ID
+  //(makes for faster access)
+  void            RegisterEntity(BaseGameEntity* NewEntity);
+
+  //returns a pointer to the entity with the ID given as a parameter, or
+  //NULL if there is none
+  BaseGameEntity* GetEntityFromID(int id)const
+  {
+    if (id < 0 || id >= (int)m_Entities.size()) return NULL;
+
+    return m_Entities[id];
+  }
+
+  //this method removes the entity from the list
+  void            RemoveEntity(BaseGameEntity* pEntity);
+
+  //clears all entities from the entity manager
+  void            Reset(){m_Entities.clear(); m_iNextValidID = 0;}
+
+  int             GetNextValidID()const{return m_iNextValidID;}
+  void            SetNextValidID(int id){m_iNextValidID = id;}
+};
+
+
+
+
+
+
+
 #endif
\ No newline at end of file
@@ -0,0 +1,33 @@
+#include "Game/GameWorld.h"
+#include "misc/utils.h"
+
+
+//the world each thread is currently simulating. NULL means the default
+//world
+static thread_local GameWorld* CurrentWorld = NULL;
+
+
+//------------------------------ Current --------------------------------------
+//-----------------------------------------------------------------------------
+GameWorld* GameWorld::Current()
+{
+  if (CurrentWorld) return CurrentWorld;
+
+  static GameWorld DefaultWorld;
+
+  return &DefaultWorld;
+}
+
+//---------------------------- MakeCurrent ------------------------------------
+//-----------------------------------------------------------------------------
+void GameWorld::MakeCurrent(GameWorld* pWorld)
+{
+  CurrentWorld = pWorld;
+}
+
+//------------------------- CurrentRandomStream -------------------------------
+//-----------------------------------------------------------------------------
+RandomStream* CurrentRandomStream()
+{
+  return GameWorld::Current()->GetRandom();
+}
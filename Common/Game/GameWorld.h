@@ -0,0 +1,93 @@
+#ifndef GAMEWORLD_H
+#define GAMEWORLD_H
+//------------------------------------------------------------------------
+//
+//  Name:   GameWorld.h
+//
+//  Desc:   owns the services that would otherwise be process wide
+//          singletons: the entity manager (and the entity ID counter),
+//          the message dispatcher, the simulation clock, the frame
+//          counter and the random stream the Rand* functions of utils.h
+//          draw from.
+//
+//          The singleton accessors (EntityMgr, Dispatcher, SimTime and
+//          TickCounter) return the services of the world bound to the
+//          calling thread, so several independent matches can be run at
+//          once by giving each its own world. A thread that never binds a
+//          world uses a default one, which is all a single match program
+//          needs to do.
+//
+//------------------------------------------------------------------------
+#include "Game/EntityManager.h"
+#include "Messaging/MessageDispatcher.h"
+#include "Time/SimClock.h"
+#include "misc/FrameCounter.h"
+#include "misc/RandomStream.h"
+
+
+class GameWorld
+{
+private:
+
+  EntityManager      m_EntityManager;
+
+  MessageDispatcher  m_Dispatcher;
+
+  SimClock           m_Clock;
+
+  FrameCounter       m_FrameCounter;
+
+  RandomStream       m_Random;
+
+  //copy ctor and assignment should be private
+  GameWorld(const GameWorld&);
+  GameWorld& operator=(const GameWorld&);
+
+public:
+
+  GameWorld(){}
+
+  EntityManager*     GetEntityManager(){return &m_EntityManager;}
+  MessageDispatcher* GetDispatcher(){return &m_Dispatcher;}
+  SimClock*          GetClock(){return &m_Clock;}
+  FrameCounter*      GetFrameCounter(){return &m_FrameCounter;}
+  RandomStream*      GetRandom(){return &m_Random;}
+
+  //returns the world bound to the calling thread
+  static GameWorld*  Current();
+
+  //binds a world to the calling thread. Passing NULL rebinds the
+  //default world
+  static void        MakeCurrent(GameWorld* pWorld);
+};
+
+
+//-------------------------- ScopedGameWorld -----------------------------
+//
+//  binds a world to the calling thread for the lifetime of the object and
+//  then restores whichever world was bound before
+//------------------------------------------------------------------------
+class ScopedGameWorld
+{
+private:
+
+  GameWorld* m_pPrevious;
+
+  ScopedGameWorld(const ScopedGameWorld&);
+  ScopedGameWorld& operator=(const ScopedGameWorld&);
+
+public:
+
+  explicit ScopedGameWorld(GameWorld* pWorld):m_pPrevious(GameWorld::Current())
+  {
+    GameWorld::MakeCurrent(pWorld);
+  }
+
+  ~ScopedGameWorld()
+  {
+    GameWorld::MakeCurrent(m_pPrevious);
+  }
+};
+
+
+#endif
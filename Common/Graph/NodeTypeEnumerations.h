@@ -1,18 +1,18 @@
-#ifndef NODE_TYPE_ENUMS
-#define NODE_TYPE_ENUMS
-//-----------------------------------------------------------------------------
-//
-//  Name:   NodeTypeEnumerations.h
-//
-//  Author: Mat Buckland (www.ai-junkie.com)
-//
-//  Desc:   enumerates some dummy node values that can be assigned to graph
-//          edges and nodes
-//-----------------------------------------------------------------------------
-  enum 
-  {
-    invalid_node_index    = -1
-  };
-  
-
+#ifndef NODE_TYPE_ENUMS
+#define NODE_TYPE_ENUMS
+//-----------------------------------------------------------------------------
+//
+//  Name:   NodeTypeEnumerations.h
+//
+//  Author: Mat Buckland (www.ai-junkie.com)
+//
+//  Desc:   enumerates some dummy node values that can be assigned to graph
+//          edges and nodes
+//-----------------------------------------------------------------------------
+  enum 
+  {
+    invalid_node_index    = -1
+  };
+  
+
 #endif
\ No newline at end of file
@@ -1,71 +1,98 @@
-#ifndef MESSAGE_DISPATCHER_H
-#define MESSAGE_DISPATCHER_H
-#pragma warning (disable:4786)
-//------------------------------------------------------------------------
-//
-//  Name:   MessageDispatcher.h
-//
-//  Desc:   A message dispatcher. Manages messages of the type Telegram.
-//          Instantiated as a singleton.
-//
-//  Author: Mat Buckland (fup@ai-junkie.com)
-//
-//------------------------------------------------------------------------
-#include <set>
-#include <string>
-
-
-#include "Messaging/Telegram.h"
-
-
-class BaseGameEntity;
-
-
-//to make life easier...
-#define Dispatcher MessageDispatcher::Instance()
-
-//to make code easier to read
-const double SEND_MSG_IMMEDIATELY = 0.0;
-const int    NO_ADDITIONAL_INFO   = 0;
-const int    SENDER_ID_IRRELEVANT = -1;
-
-
-class MessageDispatcher
-{
-private:  
-  
-  //a std::set is used as the container for the delayed messages
-  //because of the benefit of automatic sorting and avoidance
-  //of duplicates. Messages are sorted by their dispatch time.
-  std::set<Telegram> PriorityQ;
-
-  //this method is utilized by DispatchMsg or DispatchDelayedMessages.
-  //This method calls the message handling member function of the receiving
-  //entity, pReceiver, with the newly created telegram
-  void Discharge(BaseGameEntity* pReceiver, const Telegram& msg);
-
-  MessageDispatcher(){}
-
-  //copy ctor and assignment should be private
-  MessageDispatcher(const MessageDispatcher&);
-  MessageDispatcher& operator=(const MessageDispatcher&);
-
-public:
-
-  static MessageDispatcher* Instance();
-
-  //send a message to another agent. Receiving agent is referenced by ID.
-  void DispatchMsg(double      delay,
-                   int         sender,
-                   int         receiver,
-                   int         msg,
-                   void*       ExtraInfo);
-
-  //send out any delayed messages. This method is called each time through   
-  //the main game loop.
-  void DispatchDelayedMessages();
-};
-
-
-
+#ifndef MESSAGE_DISPATCHER_H
+#define MESSAGE_DISPATCHER_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   MessageDispatcher.h
+//
+//  Desc:   A message dispatcher. Manages messages of the type Telegram.
+//          Instantiated as a singleton per GameWorld.
+//
+//  Author: Mat Buckland (fup@ai-junkie.com)
+//
+//------------------------------------------------------------------------
+#include <string>
+
+
+#include "Messaging/Telegram.h"
+#include "Messaging/TelegramWheel.h"
+
+
+class BaseGameEntity;
+
+
+//to make life easier...
+#define Dispatcher MessageDispatcher::Instance()
+
+//to make code easier to read
+const double SEND_MSG_IMMEDIATELY = 0.0;
+const int    NO_ADDITIONAL_INFO   = 0;
+const int    SENDER_ID_IRRELEVANT = -1;
+
+
+//anything that needs to see every telegram as it is delivered (a replay
+//recorder, say) derives from this and registers with SetObserver
+class TelegramObserver
+{
+public:
+
+  virtual ~TelegramObserver(){}
+
+  virtual void OnTelegram(const Telegram& msg) = 0;
+};
+
+
+class MessageDispatcher
+{
+private:  
+  
+  //the delayed messages, bucketed by the tick they fall due on. The wheel
+  //hands them out sorted by their dispatch time and avoids duplicates
+  //without allocating per message.
+  TelegramWheel PriorityQ;
+
+  //told of each telegram as it is discharged. May be NULL
+  TelegramObserver* m_pObserver;
+
+  //this method is utilized by DispatchMsg or DispatchDelayedMessages.
+  //This method calls the message handling member function of the receiving
+  //entity, pReceiver, with the newly created telegram
+  void Discharge(BaseGameEntity* pReceiver, const Telegram& msg);
+
+  MessageDispatcher():m_pObserver(NULL){}
+
+  friend class GameWorld;
+
+  //copy ctor and assignment should be private
+  MessageDispatcher(const MessageDispatcher&);
+  MessageDispatcher& operator=(const MessageDispatcher&);
+
+public:
+
+  static MessageDispatcher* Instance();
+
+  //send a message to another agent. Receiving agent is referenced by ID.
+  //The delay is given in seconds of simulated time
+  void DispatchMsg(double      delay,
+                   int         sender,
+                   int         receiver,
+                   int         msg,
+                   void*       ExtraInfo);
+
+  //send out any delayed messages. This method is called each time through   
+  //the main game loop, after the simulation clock has been advanced.
+  void DispatchDelayedMessages();
+
+  //pass NULL to remove the observer
+  void SetObserver(TelegramObserver* observer){m_pObserver = observer;}
+
+  //the delayed messages still to be sent, for saving and restoring the
+  //state of a game. A telegram's ExtraInfo is copied as it is, so it must
+  //still point at something valid when the telegram is restored
+  const TelegramWheel& PendingMessages()const{return PriorityQ;}
+  void  SetPendingMessages(const TelegramWheel& pending){PriorityQ = pending;}
+};
+
+
+
 #endif
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include "Messaging/TelegramWheel.h"
+
+#include <cassert>
+
+
+//------------------------------- ctor ----------------------------------------
+//-----------------------------------------------------------------------------
+TelegramWheel::TelegramWheel(int NumSlots,
+                             int InitialCapacity):m_Slots(NumSlots, -1),
+                                                  m_iFreeList(-1),
+                                                  m_iNumPending(0),
+                                                  m_lNextTick(0)
+{
+  assert (NumSlots > 0 && "<TelegramWheel::TelegramWheel>: invalid slot count");
+
+  m_Nodes.reserve(InitialCapacity);
+}
+
+//---------------------------- AllocateNode -----------------------------------
+//-----------------------------------------------------------------------------
+int TelegramWheel::AllocateNode()
+{
+  if (m_iFreeList != -1)
+  {
+    int node = m_iFreeList;
+
+    m_iFreeList = m_Nodes[node].Next;
+
+    return node;
+  }
+
+  m_Nodes.push_back(Node());
+
+  return (int)m_Nodes.size() - 1;
+}
+
+//------------------------------- Insert --------------------------------------
+//-----------------------------------------------------------------------------
+bool TelegramWheel::Insert(const Telegram& telegram, long DueTick)
+{
+  //duplicates are not queued. There are only ever a few telegrams pending
+  //so a search of the pool is cheap
+  for (unsigned int n=0; n<m_Nodes.size(); ++n)
+  {
+    if (m_Nodes[n].DueTick != -1 && m_Nodes[n].telegram == telegram)
+    {
+      return false;
+    }
+  }
+
+  //a telegram can't be due before the ticks already handed out
+  if (DueTick < m_lNextTick) DueTick = m_lNextTick;
+
+  int node = AllocateNode();
+
+  m_Nodes[node].telegram = telegram;
+  m_Nodes[node].DueTick  = DueTick;
+
+  //link it into its slot after any telegrams with an earlier or equal
+  //dispatch time
+  int* link = &m_Slots[DueTick % (long)m_Slots.size()];
+
+  while (*link != -1 &&
+         m_Nodes[*link].telegram.DispatchTime <= telegram.DispatchTime)
+  {
+    link = &m_Nodes[*link].Next;
+  }
+
+  m_Nodes[node].Next = *link;
+  *link = node;
+
+  ++m_iNumPending;
+
+  return true;
+}
+
+//------------------------------- PopDue --------------------------------------
+//-----------------------------------------------------------------------------
+bool TelegramWheel::PopDue(long CurrentTick, Telegram& telegram)
+{
+  //if the clock has been reset start again from its current tick
+  if (CurrentTick + 1 < m_lNextTick) m_lNextTick = CurrentTick;
+
+  while (m_lNextTick <= CurrentTick)
+  {
+    //nothing pending so there's no need to visit the slots
+    if (m_iNumPending == 0)
+    {
+      m_lNextTick = CurrentTick + 1;
+
+      return false;
+    }
+
+    int& head = m_Slots[m_lNextTick % (long)m_Slots.size()];
+
+    //the slot is sorted by dispatch time, so any telegram due on this tick
+    //is in front of those waiting for a later revolution of the wheel
+    if (head != -1 && m_Nodes[head].DueTick <= m_lNextTick)
+    {
+      int node = head;
+
+      telegram = m_Nodes[node].telegram;
+
+      head = m_Nodes[node].Next;
+
+      m_Nodes[node].DueTick = -1;
+      m_Nodes[node].Next    = m_iFreeList;
+      m_iFreeList           = node;
+
+      --m_iNumPending;
+
+      return true;
+    }
+
+    ++m_lNextTick;
+  }
+
+  return false;
+}
+
+//-------------------------------- Clear --------------------------------------
+//-----------------------------------------------------------------------------
+void TelegramWheel::Clear()
+{
+  m_iFreeList = -1;
+
+  for (int n=(int)m_Nodes.size()-1; n>=0; --n)
+  {
+    m_Nodes[n].DueTick = -1;
+    m_Nodes[n].Next    = m_iFreeList;
+    m_iFreeList        = n;
+  }
+
+  for (unsigned int s=0; s<m_Slots.size(); ++s)
+  {
+    m_Slots[s] = -1;
+  }
+
+  m_iNumPending = 0;
+}
@@ -0,0 +1,75 @@
+#ifndef TELEGRAM_WHEEL_H
+#define TELEGRAM_WHEEL_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   TelegramWheel.h
+//
+//  Desc:   a queue for delayed telegrams that does not allocate per
+//          message. Telegrams are bucketed by the tick they fall due on
+//          into a ring of slots (a timing wheel); a telegram due more
+//          than one revolution ahead waits in its slot until its tick
+//          comes round.
+//
+//          The telegrams themselves live in a pool of nodes linked by
+//          index, with released nodes kept on a free list. The pool only
+//          grows if more telegrams are pending at once than ever before.
+//
+//------------------------------------------------------------------------
+#include <vector>
+
+#include "Messaging/Telegram.h"
+
+
+class TelegramWheel
+{
+private:
+
+  struct Node
+  {
+    Telegram  telegram;
+
+    //the tick the telegram is to be dispatched on. -1 if the node is free
+    long      DueTick;
+
+    //the next node in the same slot (or on the free list). -1 ends a list
+    int       Next;
+  };
+
+  std::vector<Node>  m_Nodes;
+
+  //the first node of each slot. Each slot is kept sorted by dispatch time
+  std::vector<int>   m_Slots;
+
+  int                m_iFreeList;
+
+  int                m_iNumPending;
+
+  //the earliest tick that may still have telegrams to hand out
+  long               m_lNextTick;
+
+
+  int   AllocateNode();
+
+public:
+
+  TelegramWheel(int NumSlots = 256, int InitialCapacity = 64);
+
+  //adds a telegram to be dispatched on DueTick. Returns false (and the
+  //telegram is discarded) if an equal telegram is already pending
+  bool  Insert(const Telegram& telegram, long DueTick);
+
+  //removes the next telegram due on or before CurrentTick, copying it to
+  //telegram. Returns false if there are none. Telegrams are handed out
+  //in order of dispatch time, so call this until it returns false
+  bool  PopDue(long CurrentTick, Telegram& telegram);
+
+  //discards every pending telegram
+  void  Clear();
+
+  int   NumPending()const{return m_iNumPending;}
+};
+
+
+
+#endif
@@ -1,9 +1,9 @@
-#include "CrudeTimer.h"
-
-
-CrudeTimer* CrudeTimer::Instance()
-{
-  static CrudeTimer instance;
-
-  return &instance;
+#include "CrudeTimer.h"
+
+
+CrudeTimer* CrudeTimer::Instance()
+{
+  static CrudeTimer instance;
+
+  return &instance;
 }
\ No newline at end of file
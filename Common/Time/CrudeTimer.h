@@ -1,52 +1,49 @@
-#ifndef CRUDETIMER_H
-#define CRUDETIMER_H
-//------------------------------------------------------------------------
-//
-//  Name:   CrudeTimer.h
-//
-//  Desc:   timer to measure time in seconds
-//
-//  Author: Mat Buckland 2002 (fup@ai-junkie.com)
-//
-//------------------------------------------------------------------------
-
-//this library must be included
-#pragma comment(lib, "winmm.lib")
-
-#include <windows.h>
-
-
-
-#define Clock CrudeTimer::Instance()
-
-class CrudeTimer
-{
-private:
-  
-
-  //set to the time (in seconds) when class is instantiated
-  double m_dStartTime;
-
-  //set the start time
-  CrudeTimer(){m_dStartTime = timeGetTime() * 0.001;}
-
-  //copy ctor and assignment should be private
-  CrudeTimer(const CrudeTimer&);
-  CrudeTimer& operator=(const CrudeTimer&);
-  
-public:
-
-  static CrudeTimer* Instance();
-
-  //returns how much time has elapsed since the timer was started
-  double GetCurrentTime(){return timeGetTime() * 0.001 - m_dStartTime;}
-
-};
-
-
-
-
-
-
-
+#ifndef CRUDETIMER_H
+#define CRUDETIMER_H
+//------------------------------------------------------------------------
+//
+//  Name:   CrudeTimer.h
+//
+//  Desc:   timer to measure time in seconds. The time is taken from the
+//          simulation clock so it advances once per game update
+//
+//  Author: Mat Buckland 2002 (fup@ai-junkie.com)
+//
+//------------------------------------------------------------------------
+#include "Time/SimClock.h"
+
+
+
+#define Clock CrudeTimer::Instance()
+
+class CrudeTimer
+{
+private:
+  
+
+  //set to the time (in seconds) when class is instantiated
+  double m_dStartTime;
+
+  //set the start time
+  CrudeTimer(){m_dStartTime = SimTime->GetCurrentTime();}
+
+  //copy ctor and assignment should be private
+  CrudeTimer(const CrudeTimer&);
+  CrudeTimer& operator=(const CrudeTimer&);
+  
+public:
+
+  static CrudeTimer* Instance();
+
+  //returns how much time has elapsed since the timer was started
+  double GetCurrentTime(){return SimTime->GetCurrentTime() - m_dStartTime;}
+
+};
+
+
+
+
+
+
+
 #endif
\ No newline at end of file
@@ -0,0 +1,29 @@
+#include "SimClock.h"
+#include "Game/GameWorld.h"
+
+
+//--------------------------- Instance ----------------------------------------
+//
+//   returns the clock of the current world
+//-----------------------------------------------------------------------------
+SimClock* SimClock::Instance()
+{
+  return GameWorld::Current()->GetClock();
+}
+
+//----------------------------- Reset -----------------------------------------
+//-----------------------------------------------------------------------------
+void SimClock::Reset(double TicksPerSecond, double TimeStep)
+{
+  m_lTick = 0;
+
+  if (TimeStep > 0)
+  {
+    m_dTimeStep = TimeStep;
+  }
+
+  if (TicksPerSecond > 0)
+  {
+    m_dSecondsPerTick = m_dTimeStep / TicksPerSecond;
+  }
+}
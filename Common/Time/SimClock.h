@@ -0,0 +1,80 @@
+#ifndef SIMCLOCK_H
+#define SIMCLOCK_H
+//------------------------------------------------------------------------
+//
+//  Name:   SimClock.h
+//
+//  Desc:   the simulation clock. Time only moves forward when Update is
+//          called (once per game update) so anything that reads this
+//          clock behaves identically whether the game is stepped at the
+//          display frame rate or as fast as the CPU allows. Each
+//          GameWorld has its own clock.
+//
+//------------------------------------------------------------------------
+
+
+#include <math.h>
+
+
+#define SimTime SimClock::Instance()
+
+class SimClock
+{
+private:
+
+  //the number of updates since the clock was last reset
+  long   m_lTick;
+
+  //the amount of simulated time each update represents
+  double m_dSecondsPerTick;
+
+  //the number of ticks, at the rate the simulation is designed for, each
+  //update stands in for
+  double m_dTimeStep;
+
+  SimClock():m_lTick(0), m_dSecondsPerTick(1.0 / 60.0), m_dTimeStep(1.0){}
+
+  friend class GameWorld;
+
+  //copy ctor and assignment should be private
+  SimClock(const SimClock&);
+  SimClock& operator=(const SimClock&);
+
+public:
+
+  static SimClock* Instance();
+
+  //sets the clock back to zero. TicksPerSecond is the fixed rate the
+  //simulation is designed to be updated at. Each update may stand in for
+  //TimeStep of those ticks, to run the simulation faster and coarser
+  void   Reset(double TicksPerSecond, double TimeStep = 1.0);
+
+  //advances the clock by one tick
+  void   Update(){++m_lTick;}
+
+  //moves the clock to the given tick, for restoring a saved game
+  void   SetCurrentTick(long tick){m_lTick = tick;}
+
+  long   GetCurrentTick()const{return m_lTick;}
+
+  double SecondsPerTick()const{return m_dSecondsPerTick;}
+
+  double TimeStep()const{return m_dTimeStep;}
+
+  //returns the time in milliseconds of the first of the designed ticks
+  //at or after time, which the updates may have stepped over
+  double FirstTickAtOrAfterMs(double time)const
+  {
+    double MsPerTick = m_dSecondsPerTick * 1000.0 / m_dTimeStep;
+
+    return ceil(time / MsPerTick) * MsPerTick;
+  }
+
+  //returns the simulated time in seconds since the clock was reset
+  double GetCurrentTime()const{return m_lTick * m_dSecondsPerTick;}
+
+  //returns the simulated time in milliseconds since the clock was reset
+  double GetCurrentTimeMs()const{return GetCurrentTime() * 1000.0;}
+};
+
+#endif
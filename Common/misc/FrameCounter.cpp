@@ -1,9 +1,9 @@
-#include "framecounter.h"
-
-
-FrameCounter* FrameCounter::Instance()
-{
-  static FrameCounter instance;
-
-  return &instance;
+#include "FrameCounter.h"
+#include "Game/GameWorld.h"
+
+
+//returns the frame counter of the current world
+FrameCounter* FrameCounter::Instance()
+{
+  return GameWorld::Current()->GetFrameCounter();
 }
\ No newline at end of file
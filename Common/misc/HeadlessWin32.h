@@ -0,0 +1,56 @@
+#ifndef HEADLESS_WIN32_H
+#define HEADLESS_WIN32_H
+//------------------------------------------------------------------------
+//
+//  Name:   HeadlessWin32.h
+//
+//  Desc:   stands in for <windows.h> when the code is compiled with
+//          HEADLESS defined. Only the few types, macros and functions
+//          the simulation code relies upon are provided, so the game
+//          logic can be built on any platform without a window or GDI.
+//
+//------------------------------------------------------------------------
+#include <chrono>
+
+
+typedef unsigned long DWORD;
+typedef unsigned long COLORREF;
+
+#ifndef TRUE
+#define TRUE  1
+#endif
+
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+struct POINT
+{
+  long x;
+  long y;
+};
+
+struct POINTS
+{
+  short x;
+  short y;
+};
+
+#define RGB(r,g,b) ((COLORREF)(((DWORD)(unsigned char)(r))        | \
+                               (((DWORD)(unsigned char)(g)) << 8) | \
+                               (((DWORD)(unsigned char)(b)) << 16)))
+
+
+//returns the number of milliseconds elapsed since the first call. Used
+//in place of the winmm function of the same name
+inline DWORD timeGetTime()
+{
+  static const std::chrono::steady_clock::time_point start =
+                                         std::chrono::steady_clock::now();
+
+  return (DWORD)std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - start).count();
+}
+
+
+#endif
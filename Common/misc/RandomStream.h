@@ -0,0 +1,136 @@
+#ifndef RANDOMSTREAM_H
+#define RANDOMSTREAM_H
+//------------------------------------------------------------------------
+//
+//  Name:   RandomStream.h
+//
+//  Desc:   a small, fast, seedable random number generator
+//          (xoshiro256**, by Blackman and Vigna). Unlike rand() each
+//          stream holds its own state, so every match can be given a
+//          stream of its own and replayed exactly from its seed however
+//          many matches are being run alongside it.
+//
+//          The state is expanded from a 64 bit seed with SplitMix64, as
+//          its authors recommend, so any seed (even 0) gives a good
+//          stream, and seeds that differ by one give unrelated streams.
+//
+//------------------------------------------------------------------------
+#include <math.h>
+#include <cassert>
+
+
+class RandomStream
+{
+private:
+
+  unsigned long long  m_State[4];
+
+  //RandGaussian makes its values in pairs; the second is kept here
+  double              m_dSpareGaussian;
+  bool                m_bHasSpareGaussian;
+
+  static unsigned long long RotateLeft(unsigned long long x, int k)
+  {
+    return (x << k) | (x >> (64 - k));
+  }
+
+public:
+
+  explicit RandomStream(unsigned long long seed = 0){Seed(seed);}
+
+  //one step of SplitMix64. Also handy for deriving the seeds of several
+  //streams from one
+  static unsigned long long SplitMix64(unsigned long long& x)
+  {
+    unsigned long long z = (x += 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+    return z ^ (z >> 31);
+  }
+
+  void Seed(unsigned long long seed)
+  {
+    for (int i=0; i<4; ++i)
+    {
+      m_State[i] = SplitMix64(seed);
+    }
+
+    m_bHasSpareGaussian = false;
+    m_dSpareGaussian    = 0.0;
+  }
+
+  //returns the next 64 random bits
+  unsigned long long Next()
+  {
+    const unsigned long long result = RotateLeft(m_State[1] * 5, 7) * 9;
+    const unsigned long long t      = m_State[1] << 17;
+
+    m_State[2] ^= m_State[0];
+    m_State[3] ^= m_State[1];
+    m_State[1] ^= m_State[2];
+    m_State[0] ^= m_State[3];
+
+    m_State[2] ^= t;
+
+    m_State[3] = RotateLeft(m_State[3], 45);
+
+    return result;
+  }
+
+  //returns a random double in the range 0 <= n < 1
+  double RandFloat()
+  {
+    return (double)(Next() >> 11) * (1.0 / 9007199254740992.0);
+  }
+
+  //returns a random integer between x and y inclusive
+  int RandInt(int x, int y)
+  {
+    assert(y>=x && "<RandomStream::RandInt>: y is less than x");
+
+    //scales the top 32 bits into the range rather than taking a modulus
+    unsigned long long range = (unsigned long long)((long long)y - x + 1);
+
+    return x + (int)(((Next() >> 32) * range) >> 32);
+  }
+
+  //returns a random number with a normal distribution. See method at
+  //http://www.taygeta.com/random/gaussian.html
+  double RandGaussian(double mean, double standard_deviation)
+  {
+    double y1;
+
+    if (m_bHasSpareGaussian)
+    {
+      y1 = m_dSpareGaussian;
+
+      m_bHasSpareGaussian = false;
+    }
+    else
+    {
+      double x1, x2, w;
+
+      do
+      {
+        x1 = 2.0 * RandFloat() - 1.0;
+        x2 = 2.0 * RandFloat() - 1.0;
+        w  = x1 * x1 + x2 * x2;
+      }
+      while ( w >= 1.0 || w == 0.0 );
+
+      w = sqrt( (-2.0 * log( w ) ) / w );
+
+      y1 = x1 * w;
+
+      m_dSpareGaussian    = x2 * w;
+      m_bHasSpareGaussian = true;
+    }
+
+    return( mean + y1 * standard_deviation );
+  }
+};
+
+
+#endif
@@ -0,0 +1,211 @@
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+//-----------------------------------------------------------------------------
+//
+//  Name:   SpatialGrid.h
+//
+//  Desc:   a uniform grid for fast proximity queries, intended to be rebuilt
+//          from scratch once per update from a container of entity
+//          pointers.
+//
+//          Unlike CellSpacePartition the cells do not own lists. Build
+//          counting sorts the entities by cell into one contiguous array
+//          so a query only walks the few cells overlapping the query box
+//          and touches consecutive memory. Nothing is allocated once the
+//          grid has grown to the number of entities it is given.
+//
+//          Entities may keep moving after the grid is built (the players
+//          update one after the other). MaxDrift is the furthest an entity
+//          is expected to move before the next Build; the cells searched
+//          are widened by it and the distance test is made against each
+//          entity's current position, so the neighbours found are exactly
+//          those a brute force search would find.
+//
+//-----------------------------------------------------------------------------
+#include <vector>
+#include <cassert>
+
+#include "2D/Vector2D.h"
+
+
+
+template <class entity>
+class SpatialGrid
+{
+private:
+
+  //the top left corner of the space and its division into cells
+  double  m_dLeft;
+  double  m_dTop;
+
+  double  m_dCellSize;
+
+  int     m_iNumCellsX;
+  int     m_iNumCellsY;
+
+  //how far an entity may move between builds
+  double  m_dMaxDrift;
+
+  //the entities of cell i are m_Entities[m_CellStart[i]] up to (but not
+  //including) m_Entities[m_CellStart[i+1]]
+  std::vector<int>     m_CellStart;
+
+  //the entities, sorted by cell
+  std::vector<entity>  m_Entities;
+
+  //the cell of each entity in the order they were handed to Build
+  std::vector<int>     m_EntityCell;
+
+
+  int  CellX(double x)const
+  {
+    int cx = (int)((x - m_dLeft) / m_dCellSize);
+
+    if (cx < 0) return 0;
+    if (cx >= m_iNumCellsX) return m_iNumCellsX-1;
+
+    return cx;
+  }
+
+  int  CellY(double y)const
+  {
+    int cy = (int)((y - m_dTop) / m_dCellSize);
+
+    if (cy < 0) return 0;
+    if (cy >= m_iNumCellsY) return m_iNumCellsY-1;
+
+    return cy;
+  }
+
+public:
+
+  SpatialGrid(double left,
+              double top,
+              double width,
+              double height,
+              double CellSize,
+              double MaxDrift);
+
+  //sorts the entities of the container into the cells according to their
+  //current positions. Any previous contents are discarded
+  template <class conT>
+  void Build(const conT& entities);
+
+  //appends to Neighbors every entity currently within QueryRadius of
+  //TargetPos. The order they are appended in depends on the layout of the
+  //grid, so sort them if the order matters
+  void CalculateNeighbors(Vector2D             TargetPos,
+                          double               QueryRadius,
+                          std::vector<entity>& Neighbors)const;
+
+  int  NumCellsX()const{return m_iNumCellsX;}
+  int  NumCellsY()const{return m_iNumCellsY;}
+  int  NumEntities()const{return (int)m_Entities.size();}
+};
+
+
+//----------------------------- ctor ------------------------------------------
+//-----------------------------------------------------------------------------
+template <class entity>
+SpatialGrid<entity>::SpatialGrid(double left,
+                                 double top,
+                                 double width,
+                                 double height,
+                                 double CellSize,
+                                 double MaxDrift):m_dLeft(left),
+                                                  m_dTop(top),
+                                                  m_dCellSize(CellSize),
+                                                  m_dMaxDrift(MaxDrift)
+{
+  assert (CellSize > 0 && "<SpatialGrid::SpatialGrid>: invalid cell size");
+
+  m_iNumCellsX = (int)(width  / CellSize) + 1;
+  m_iNumCellsY = (int)(height / CellSize) + 1;
+
+  m_CellStart.assign(m_iNumCellsX * m_iNumCellsY + 1, 0);
+}
+
+//----------------------------- Build -----------------------------------------
+//-----------------------------------------------------------------------------
+template <class entity>
+template <class conT>
+void SpatialGrid<entity>::Build(const conT& entities)
+{
+  const int NumCells = m_iNumCellsX * m_iNumCellsY;
+
+  m_CellStart.assign(NumCells + 1, 0);
+  m_EntityCell.clear();
+
+  //count the entities in each cell
+  typename conT::const_iterator it;
+  for (it=entities.begin(); it!=entities.end(); ++it)
+  {
+    Vector2D pos = (*it)->Pos();
+
+    int cell = CellY(pos.y) * m_iNumCellsX + CellX(pos.x);
+
+    m_EntityCell.push_back(cell);
+
+    ++m_CellStart[cell+1];
+  }
+
+  //turn the counts into offsets
+  for (int cell=0; cell<NumCells; ++cell)
+  {
+    m_CellStart[cell+1] += m_CellStart[cell];
+  }
+
+  //and drop each entity into its cell's slot. m_CellStart[cell] is used
+  //as the insertion point and ends up at the start of the next cell, so
+  //it is shifted back afterwards
+  m_Entities.resize(m_EntityCell.size());
+
+  int idx = 0;
+  for (it=entities.begin(); it!=entities.end(); ++it, ++idx)
+  {
+    m_Entities[m_CellStart[m_EntityCell[idx]]++] = *it;
+  }
+
+  for (int cell=NumCells; cell>0; --cell)
+  {
+    m_CellStart[cell] = m_CellStart[cell-1];
+  }
+
+  m_CellStart[0] = 0;
+}
+
+//----------------------- CalculateNeighbors ----------------------------------
+//-----------------------------------------------------------------------------
+template <class entity>
+void SpatialGrid<entity>::CalculateNeighbors(Vector2D             TargetPos,
+                                             double               QueryRadius,
+                                             std::vector<entity>& Neighbors)const
+{
+  double SearchRadius = QueryRadius + m_dMaxDrift;
+
+  int MinX = CellX(TargetPos.x - SearchRadius);
+  int MaxX = CellX(TargetPos.x + SearchRadius);
+  int MinY = CellY(TargetPos.y - SearchRadius);
+  int MaxY = CellY(TargetPos.y + SearchRadius);
+
+  double RadiusSq = QueryRadius * QueryRadius;
+
+  for (int cy=MinY; cy<=MaxY; ++cy)
+  {
+    //the cells of a row are adjacent in m_Entities, so each row is a
+    //single run
+    int first = m_CellStart[cy * m_iNumCellsX + MinX];
+    int last  = m_CellStart[cy * m_iNumCellsX + MaxX + 1];
+
+    for (int idx=first; idx<last; ++idx)
+    {
+      if (Vec2DDistanceSq(m_Entities[idx]->Pos(), TargetPos) < RadiusSq)
+      {
+        Neighbors.push_back(m_Entities[idx]);
+      }
+    }
+  }
+}
+
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef SPSCRING_H
+#define SPSCRING_H
+//-----------------------------------------------------------------------------
+//
+//  Name:   SpscRing.h
+//
+//  Desc:   a fixed size ring buffer passing items from one producer thread
+//          to one consumer thread without locks.
+//
+//          The producer only ever writes the head and the consumer only
+//          ever writes the tail, each publishing its progress to the other
+//          with a release store. Neither waits for the other: a push to a
+//          full ring fails (and is counted) rather than blocking, and a pop
+//          from an empty one returns nothing. Each thread keeps its own
+//          copy of the other's index and reads the shared one only when
+//          that copy says the ring is full (or empty), so most calls touch
+//          no memory the other thread is writing.
+//
+//          The two indices are on cache lines of their own so that the
+//          threads don't slow each other down by writing to the same one.
+//
+//-----------------------------------------------------------------------------
+#include <vector>
+#include <atomic>
+#include <cstddef>
+
+
+template <class T>
+class SpscRing
+{
+private:
+
+  enum {CacheLineSize = 64};
+
+  //the capacity is a power of two so an index is wrapped with a mask. The
+  //indices themselves just count up
+  std::vector<T>       m_Slots;
+  size_t               m_Mask;
+
+  char                 m_Pad0[CacheLineSize];
+
+  //the producer's: the next slot to write, its copy of the tail, and the
+  //number of items dropped because the ring was full
+  std::atomic<size_t>  m_Head;
+  size_t               m_CachedTail;
+  std::atomic<size_t>  m_NumDropped;
+
+  char                 m_Pad1[CacheLineSize];
+
+  //the consumer's: the next slot to read and its copy of the head
+  std::atomic<size_t>  m_Tail;
+  size_t               m_CachedHead;
+
+  char                 m_Pad2[CacheLineSize];
+
+  SpscRing(const SpscRing&);
+  SpscRing& operator=(const SpscRing&);
+
+public:
+
+  //the ring holds at least MinCapacity items
+  explicit SpscRing(size_t MinCapacity):m_Head(0),
+                                        m_CachedTail(0),
+                                        m_NumDropped(0),
+                                        m_Tail(0),
+                                        m_CachedHead(0)
+  {
+    size_t capacity = 1;
+
+    while (capacity < MinCapacity) capacity <<= 1;
+
+    m_Slots.resize(capacity);
+
+    m_Mask = capacity - 1;
+  }
+
+  size_t  Capacity()const{return m_Slots.size();}
+
+  //-------------------------- producer only ---------------------------------
+
+  //adds a copy of item, or returns false (and counts it dropped) if the
+  //ring is full
+  bool    TryPush(const T& item)
+  {
+    const size_t head = m_Head.load(std::memory_order_relaxed);
+
+    if (head - m_CachedTail > m_Mask)
+    {
+      m_CachedTail = m_Tail.load(std::memory_order_acquire);
+
+      if (head - m_CachedTail > m_Mask)
+      {
+        m_NumDropped.store(m_NumDropped.load(std::memory_order_relaxed) + 1,
+                           std::memory_order_relaxed);
+
+        return false;
+      }
+    }
+
+    m_Slots[head & m_Mask] = item;
+
+    m_Head.store(head + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  //-------------------------- consumer only ---------------------------------
+
+  //copies up to MaxItems of the oldest items to items, removing them from
+  //the ring, and returns how many were copied
+  size_t  Pop(T* items, size_t MaxItems)
+  {
+    size_t tail = m_Tail.load(std::memory_order_relaxed);
+
+    if (m_CachedHead == tail)
+    {
+      m_CachedHead = m_Head.load(std::memory_order_acquire);
+
+      if (m_CachedHead == tail) return 0;
+    }
+
+    size_t count = m_CachedHead - tail;
+
+    if (count > MaxItems) count = MaxItems;
+
+    for (size_t i=0; i<count; ++i)
+    {
+      items[i] = m_Slots[(tail + i) & m_Mask];
+    }
+
+    m_Tail.store(tail + count, std::memory_order_release);
+
+    return count;
+  }
+
+  //-------------------------- either thread ---------------------------------
+
+  //the number of pushes that failed because the ring was full
+  size_t  NumDropped()const{return m_NumDropped.load(std::memory_order_relaxed);}
+};
+
+
+#endif
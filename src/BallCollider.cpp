@@ -0,0 +1,145 @@
+#include "BallCollider.h"
+
+
+//------------------------------- AddWall -------------------------------------
+//-----------------------------------------------------------------------------
+void BallCollider::AddWall(const Wall2D& wall)
+{
+  Segment seg;
+
+  seg.From   = wall.From();
+  seg.Normal = wall.Normal();
+  seg.Length = Vec2DDistance(wall.From(), wall.To());
+  seg.Along  = Vec2DNormalize(wall.To() - wall.From());
+
+  m_Segments.push_back(seg);
+}
+
+//------------------------------- AddPost -------------------------------------
+//-----------------------------------------------------------------------------
+void BallCollider::AddPost(Vector2D pos)
+{
+  m_Posts.push_back(pos);
+}
+
+//-------------------------------- Sweep --------------------------------------
+//
+//  a circle at pos + t*displacement touches the line of a wall when its
+//  distance from the line equals the radius, and touches a post when
+//  |pos + t*displacement - post| = radius, a quadratic in t. The smallest
+//  t in [0, 1] over everything is the first contact. A circle already
+//  overlapping something it is moving into touches it at t = 0.
+//-----------------------------------------------------------------------------
+bool BallCollider::Sweep(Vector2D  pos,
+                         Vector2D  displacement,
+                         double    radius,
+                         double&   TimeOfImpact,
+                         Vector2D& normal)const
+{
+  double ClosestSoFar = 1.0;
+  bool   hit          = false;
+
+  for (unsigned int s=0; s<m_Segments.size(); ++s)
+  {
+    const Segment& seg = m_Segments[s];
+
+    double approach = displacement.Dot(seg.Normal);
+
+    //moving away from or along the wall
+    if (approach >= 0.0) continue;
+
+    double dist = (pos - seg.From).Dot(seg.Normal);
+
+    //behind the wall
+    if (dist < 0.0) continue;
+
+    double t = (dist - radius) / -approach;
+
+    if (t > ClosestSoFar) continue;
+
+    if (t < 0.0) t = 0.0;
+
+    //the point of the wall touched must lie between its ends. Beyond them
+    //there is either another wall or a post
+    double along = (pos + displacement * t - seg.From).Dot(seg.Along);
+
+    if (along < 0.0 || along > seg.Length) continue;
+
+    ClosestSoFar = t;
+    normal       = seg.Normal;
+    hit          = true;
+  }
+
+  double a = displacement.LengthSq();
+
+  for (unsigned int p=0; p<m_Posts.size(); ++p)
+  {
+    Vector2D ToBall = pos - m_Posts[p];
+
+    double b = ToBall.Dot(displacement);
+
+    //moving away from the post
+    if (b >= 0.0) continue;
+
+    double c = ToBall.LengthSq() - radius*radius;
+
+    double t = 0.0;
+
+    if (c > 0.0)
+    {
+      double discriminant = b*b - a*c;
+
+      //passes wide of the post
+      if (discriminant < 0.0) continue;
+
+      t = (-b - sqrt(discriminant)) / a;
+    }
+
+    if (t > ClosestSoFar) continue;
+
+    ClosestSoFar = t;
+    normal       = Vec2DNormalize(ToBall + displacement * t);
+    hit          = true;
+  }
+
+  TimeOfImpact = ClosestSoFar;
+
+  return hit;
+}
+
+//--------------------------------- Move --------------------------------------
+//-----------------------------------------------------------------------------
+int BallCollider::Move(Vector2D&              pos,
+                       Vector2D&              velocity,
+                       double                 radius,
+                       double                 TimeStep,
+                       std::vector<Vector2D>* contacts)const
+{
+  double remaining = TimeStep;
+
+  for (int bounce=0; bounce<MaxBounces; ++bounce)
+  {
+    Vector2D displacement = velocity * remaining;
+
+    double   t;
+    Vector2D normal;
+
+    if (!Sweep(pos, displacement, radius, t, normal))
+    {
+      pos += displacement;
+
+      return bounce;
+    }
+
+    //move up to the contact and bounce
+    pos += displacement * t;
+
+    if (contacts) contacts->push_back(pos);
+
+    velocity.Reflect(normal);
+
+    remaining *= 1.0 - t;
+  }
+
+  return MaxBounces;
+}
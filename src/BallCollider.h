@@ -0,0 +1,86 @@
+#ifndef BALLCOLLIDER_H
+#define BALLCOLLIDER_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   BallCollider.h
+//
+//  Desc:   continuous collision detection for the ball. The ball is swept
+//          as a circle along the whole of its movement for a step and the
+//          first wall or goalpost it touches is found exactly, so it
+//          cannot pass through anything however fast it moves. It is
+//          then moved to the point of contact, its velocity reflected, and
+//          the rest of the step swept again from there.
+//
+//          The walls are one sided: only a ball in front of a wall and
+//          moving towards it can hit it, so a ball that has gone through
+//          a goal mouth is free to leave the pitch. The ends of the walls
+//          at the goal mouths are added as posts, so a ball glancing off
+//          the end of a wall bounces off the post rather than clipping
+//          through the corner.
+//
+//          Everything about a wall that doesn't change (its direction,
+//          normal and length) is worked out once when it is added.
+//
+//------------------------------------------------------------------------
+#include <vector>
+
+#include "2D/Vector2D.h"
+#include "2D/Wall2D.h"
+
+
+class BallCollider
+{
+private:
+
+  struct Segment
+  {
+    Vector2D  From;
+
+    //the normal, pointing to the side the ball may be on
+    Vector2D  Normal;
+
+    //the unit vector from From to the other end, and the distance there
+    Vector2D  Along;
+    double    Length;
+  };
+
+  std::vector<Segment>   m_Segments;
+  std::vector<Vector2D>  m_Posts;
+
+  //the number of times the ball may bounce in one step. Any movement left
+  //after that is dropped (it can only happen in a corner)
+  enum {MaxBounces = 4};
+
+public:
+
+  void  AddWall(const Wall2D& wall);
+
+  void  AddPost(Vector2D pos);
+
+  void  Clear(){m_Segments.clear(); m_Posts.clear();}
+
+  //sweeps a circle of the given radius from pos along displacement. If
+  //it touches a wall or post on the way this returns true, with
+  //TimeOfImpact set to the fraction of the displacement covered before
+  //it does and normal to the normal of the surface it touched
+  bool  Sweep(Vector2D  pos,
+              Vector2D  displacement,
+              double    radius,
+              double&   TimeOfImpact,
+              Vector2D& normal)const;
+
+  //moves a circle at pos by velocity*TimeStep, bouncing it off anything
+  //in the way. pos and velocity are updated. Returns the number of
+  //bounces. If contacts is given the position of the circle at each
+  //bounce is appended to it
+  int   Move(Vector2D&              pos,
+             Vector2D&              velocity,
+             double                 radius,
+             double                 TimeStep,
+             std::vector<Vector2D>* contacts = NULL)const;
+};
+
+
+
+#endif
@@ -0,0 +1,59 @@
+#include "BallTrajectory.h"
+
+
+//-------------------------------- Build --------------------------------------
+//-----------------------------------------------------------------------------
+void BallTrajectory::Build(Vector2D pos,
+                           Vector2D velocity,
+                           double   mass,
+                           double   friction)
+{
+  m_vOrigin   = pos;
+  m_vVelocity = velocity;
+
+  m_vHeading  = Vec2DNormalize(velocity);
+  m_dSpeed    = velocity.Length();
+
+  //the cached kick speed depends on the mass, so forget it if that changes
+  //(a zero force gives a zero speed whatever the mass)
+  if (mass != m_dMass)
+  {
+    m_dKickForce   = 0.0;
+    m_dKickSpeed   = 0.0;
+    m_dKickSpeedSq = 0.0;
+  }
+
+  m_dMass         = mass;
+  m_dFriction     = friction;
+  m_dHalfFriction = 0.5 * friction;
+}
+
+//------------------------- TimesToCoverDistances -----------------------------
+//-----------------------------------------------------------------------------
+void BallTrajectory::TimesToCoverDistances(Vector2D        from,
+                                           const Vector2D* to,
+                                           int             count,
+                                           double          force,
+                                           double*         times)const
+{
+  SetKickForce(force);
+
+  for (int i=0; i<count; ++i)
+  {
+    double term = m_dKickSpeedSq + 2.0*Vec2DDistance(from, to[i])*m_dFriction;
+
+    times[i] = (term <= 0.0) ? -1.0 : (sqrt(term) - m_dKickSpeed) / m_dFriction;
+  }
+}
+
+//------------------------------ PositionsAt ----------------------------------
+//-----------------------------------------------------------------------------
+void BallTrajectory::PositionsAt(const double* times,
+                                 int           count,
+                                 Vector2D*     positions)const
+{
+  for (int i=0; i<count; ++i)
+  {
+    positions[i] = PositionAt(times[i]);
+  }
+}
@@ -0,0 +1,137 @@
+#ifndef BALLTRAJECTORY_H
+#define BALLTRAJECTORY_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   BallTrajectory.h
+//
+//  Desc:   the path of the ball under friction, worked out once from its
+//          position and velocity so the many predictions made each tick
+//          (pass safety, pursuit, shots, interceptions) cost a few
+//          multiplies instead of a normalisation each.
+//
+//          The ball decelerates at a constant rate (Prm.Friction is the
+//          negative acceleration) along its heading, so
+//
+//            position(t) = origin + velocity*t + 1/2*friction*t^2*heading
+//
+//          and a ball kicked with force f leaves the foot at f/mass and
+//          covers a distance s in
+//
+//            t = (sqrt(u^2 + 2*friction*s) - u) / friction
+//
+//          The answers are computed with the same operations, in the same
+//          order, as SoccerBall did before so they are bit for bit the
+//          same.
+//
+//------------------------------------------------------------------------
+#include <math.h>
+
+#include "2D/Vector2D.h"
+
+
+class BallTrajectory
+{
+private:
+
+  //the state of the ball the trajectory was built from
+  Vector2D  m_vOrigin;
+  Vector2D  m_vVelocity;
+
+  //the normalised velocity and the speed
+  Vector2D  m_vHeading;
+  double    m_dSpeed;
+
+  double    m_dMass;
+  double    m_dFriction;
+  double    m_dHalfFriction;
+
+  //the speed of the most recent kick force asked about and its square.
+  //Nearly every query is made with one of a handful of forces
+  //(Prm.MaxPassingForce, Prm.MaxShootingForce) so this is nearly always
+  //a hit
+  mutable double  m_dKickForce;
+  mutable double  m_dKickSpeed;
+  mutable double  m_dKickSpeedSq;
+
+  void  SetKickForce(double force)const
+  {
+    if (force != m_dKickForce)
+    {
+      m_dKickForce   = force;
+      m_dKickSpeed   = force / m_dMass;
+      m_dKickSpeedSq = m_dKickSpeed * m_dKickSpeed;
+    }
+  }
+
+public:
+
+  BallTrajectory():m_dSpeed(0.0),
+                   m_dMass(1.0),
+                   m_dFriction(0.0),
+                   m_dHalfFriction(0.0),
+                   m_dKickForce(0.0),
+                   m_dKickSpeed(0.0),
+                   m_dKickSpeedSq(0.0)
+  {}
+
+  //works out the trajectory of a ball of the given mass at pos moving
+  //with velocity
+  void      Build(Vector2D pos, Vector2D velocity, double mass, double friction);
+
+  //true if the trajectory was built from this position and velocity
+  bool      isBuiltFrom(const Vector2D& pos, const Vector2D& velocity)const
+  {
+    return pos.x == m_vOrigin.x && pos.y == m_vOrigin.y &&
+           velocity.x == m_vVelocity.x && velocity.y == m_vVelocity.y;
+  }
+
+  Vector2D  Heading()const{return m_vHeading;}
+  double    Speed()const{return m_dSpeed;}
+
+  //the position of the ball 'time' ticks from now
+  Vector2D  PositionAt(double time)const
+  {
+    //the 1/2at^2 term, applied along the heading
+    double half_a_t_squared = m_dHalfFriction * time * time;
+
+    return m_vOrigin + m_vVelocity * time + half_a_t_squared * m_vHeading;
+  }
+
+  //how long a ball kicked with the given force takes to travel distance,
+  //or -1 if it stops short
+  double    TimeToCoverDistance(double distance, double force)const
+  {
+    SetKickForce(force);
+
+    double term = m_dKickSpeedSq + 2.0*distance*m_dFriction;
+
+    if (term <= 0.0) return -1.0;
+
+    return (sqrt(term) - m_dKickSpeed) / m_dFriction;
+  }
+
+  //how long a ball kicked with the given force rolls before it stops
+  double    TimeToStop(double force)const
+  {
+    SetKickForce(force);
+
+    return m_dKickSpeed / -m_dFriction;
+  }
+
+  //the batch versions of the above: times[i] is the time to cover the
+  //distance from 'from' to to[i], positions[i] the position at times[i]
+  void      TimesToCoverDistances(Vector2D        from,
+                                  const Vector2D* to,
+                                  int             count,
+                                  double          force,
+                                  double*         times)const;
+
+  void      PositionsAt(const double* times,
+                        int           count,
+                        Vector2D*     positions)const;
+};
+
+
+
+#endif
@@ -0,0 +1,185 @@
+#include "ColumnarWriter.h"
+
+#include <string.h>
+#include <cassert>
+
+
+//the file starts with "SSCF" and ends with "SSCE"
+static const char ColumnarMagic[4]    = {'S','S','C','F'};
+static const char ColumnarEndMagic[4] = {'S','S','C','E'};
+
+static const unsigned int ColumnarVersion = 1;
+
+
+//------------------------------------------------------------------------
+//
+//  helpers for writing little endian values
+//------------------------------------------------------------------------
+static void PutU32(std::vector<unsigned char>& buf, unsigned int val)
+{
+  for (int b=0; b<4; ++b) buf.push_back((unsigned char)(val >> (8*b)));
+}
+
+static void PutU64(std::vector<unsigned char>& buf, unsigned long long val)
+{
+  for (int b=0; b<8; ++b) buf.push_back((unsigned char)(val >> (8*b)));
+}
+
+static void PutF64(std::vector<unsigned char>& buf, double val)
+{
+  unsigned long long bits;
+
+  memcpy(&bits, &val, sizeof(bits));
+
+  PutU64(buf, bits);
+}
+
+
+//------------------------------- ctor ----------------------------------------
+//-----------------------------------------------------------------------------
+ColumnarWriter::ColumnarWriter(const std::string& filename,
+                               int                RowsPerGroup):m_File(filename.c_str(), std::ios::binary),
+                                                                m_iRowsPerGroup(RowsPerGroup > 0 ? RowsPerGroup : 1),
+                                                                m_iRowsInGroup(0),
+                                                                m_iNumRows(0),
+                                                                m_bHeaderWritten(false)
+{}
+
+ColumnarWriter::~ColumnarWriter()
+{
+  Close();
+}
+
+//------------------------------ AddColumn ------------------------------------
+//-----------------------------------------------------------------------------
+int ColumnarWriter::AddColumn(const std::string& name, column_type type)
+{
+  assert (!m_bHeaderWritten && "<ColumnarWriter::AddColumn>: rows already written");
+
+  Column column;
+
+  column.Name = name;
+  column.Type = type;
+
+  m_Columns.push_back(column);
+
+  return (int)m_Columns.size() - 1;
+}
+
+//------------------------------ SetInt/Double --------------------------------
+//-----------------------------------------------------------------------------
+void ColumnarWriter::SetInt(int column, int val)
+{
+  std::vector<int>& values = m_Columns[column].Ints;
+
+  values.resize(m_iRowsInGroup + 1, 0);
+
+  values[m_iRowsInGroup] = val;
+}
+
+void ColumnarWriter::SetDouble(int column, double val)
+{
+  std::vector<double>& values = m_Columns[column].Doubles;
+
+  values.resize(m_iRowsInGroup + 1, 0.0);
+
+  values[m_iRowsInGroup] = val;
+}
+
+//-------------------------------- EndRow -------------------------------------
+//-----------------------------------------------------------------------------
+void ColumnarWriter::EndRow()
+{
+  if (!m_bHeaderWritten) WriteHeader();
+
+  //pad out the columns that weren't set
+  for (unsigned int c=0; c<m_Columns.size(); ++c)
+  {
+    if (m_Columns[c].Type == int_column)
+    {
+      m_Columns[c].Ints.resize(m_iRowsInGroup + 1, 0);
+    }
+    else
+    {
+      m_Columns[c].Doubles.resize(m_iRowsInGroup + 1, 0.0);
+    }
+  }
+
+  ++m_iRowsInGroup;
+  ++m_iNumRows;
+
+  if (m_iRowsInGroup >= m_iRowsPerGroup) WriteGroup();
+}
+
+//------------------------------ WriteHeader ----------------------------------
+//-----------------------------------------------------------------------------
+void ColumnarWriter::WriteHeader()
+{
+  m_bHeaderWritten = true;
+
+  std::vector<unsigned char> buf(ColumnarMagic, ColumnarMagic + 4);
+
+  PutU32(buf, ColumnarVersion);
+  PutU32(buf, (unsigned int)m_Columns.size());
+
+  for (unsigned int c=0; c<m_Columns.size(); ++c)
+  {
+    PutU32(buf, (unsigned int)m_Columns[c].Type);
+    PutU32(buf, (unsigned int)m_Columns[c].Name.size());
+
+    buf.insert(buf.end(), m_Columns[c].Name.begin(), m_Columns[c].Name.end());
+  }
+
+  m_File.write((const char*)&buf[0], buf.size());
+}
+
+//------------------------------ WriteGroup -----------------------------------
+//-----------------------------------------------------------------------------
+void ColumnarWriter::WriteGroup()
+{
+  std::vector<unsigned char> buf;
+
+  PutU32(buf, (unsigned int)m_iRowsInGroup);
+
+  for (unsigned int c=0; c<m_Columns.size(); ++c)
+  {
+    Column& column = m_Columns[c];
+
+    for (int row=0; row<m_iRowsInGroup; ++row)
+    {
+      if (column.Type == int_column)
+      {
+        PutU32(buf, (unsigned int)column.Ints[row]);
+      }
+      else
+      {
+        PutF64(buf, column.Doubles[row]);
+      }
+    }
+
+    column.Ints.clear();
+    column.Doubles.clear();
+  }
+
+  m_File.write((const char*)&buf[0], buf.size());
+
+  m_iRowsInGroup = 0;
+}
+
+//-------------------------------- Close --------------------------------------
+//-----------------------------------------------------------------------------
+void ColumnarWriter::Close()
+{
+  if (!m_File.is_open()) return;
+
+  if (!m_bHeaderWritten) WriteHeader();
+
+  if (m_iRowsInGroup > 0) WriteGroup();
+
+  //the empty group marks the end of the rows
+  WriteGroup();
+
+  m_File.write(ColumnarEndMagic, 4);
+
+  m_File.close();
+}
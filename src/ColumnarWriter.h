@@ -0,0 +1,95 @@
+#ifndef COLUMNARWRITER_H
+#define COLUMNARWRITER_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   ColumnarWriter.h
+//
+//  Desc:   streams rows of results to a binary file laid out by column,
+//          so a long run can be written as it goes without keeping every
+//          row in memory, and read back a column at a time for analysis.
+//
+//          The file starts with "SSCF", the format version and the number
+//          of columns, followed by each column's type and name. The rows
+//          follow in groups: a group is its row count and then, for each
+//          column in turn, that many values of the column back to back.
+//          A group of zero rows and "SSCE" end the file.
+//
+//          Integers are written as 32 bits and reals as 64 bit doubles.
+//          All multi byte values are little endian.
+//
+//------------------------------------------------------------------------
+#include <vector>
+#include <string>
+#include <fstream>
+
+
+class ColumnarWriter
+{
+public:
+
+  enum column_type {int_column = 1, double_column = 2};
+
+private:
+
+  struct Column
+  {
+    std::string          Name;
+    column_type          Type;
+
+    //the values of the rows in the group being built. Only the vector
+    //matching the type is used
+    std::vector<int>     Ints;
+    std::vector<double>  Doubles;
+  };
+
+  std::ofstream        m_File;
+
+  std::vector<Column>  m_Columns;
+
+  //the number of rows a group is allowed to grow to before it is written
+  int                  m_iRowsPerGroup;
+
+  //the rows in the current group and in the file
+  int                  m_iRowsInGroup;
+  long                 m_iNumRows;
+
+  //the header is written with the first row; no columns may be added
+  //after that
+  bool                 m_bHeaderWritten;
+
+  void  WriteHeader();
+  void  WriteGroup();
+
+  ColumnarWriter(const ColumnarWriter&);
+  ColumnarWriter& operator=(const ColumnarWriter&);
+
+public:
+
+  ColumnarWriter(const std::string& filename, int RowsPerGroup = 4096);
+
+  //closes the file if Close has not been called
+  ~ColumnarWriter();
+
+  bool  isOpen()const{return m_File.is_open();}
+
+  //adds a column and returns its index. Columns must all be added before
+  //the first row is written
+  int   AddColumn(const std::string& name, column_type type);
+
+  //set a value of the row being built
+  void  SetInt(int column, int val);
+  void  SetDouble(int column, double val);
+
+  //adds the row being built to the file. A column not set in the row is
+  //written as zero
+  void  EndRow();
+
+  //writes any rows still held and the end of the file
+  void  Close();
+
+  long  NumRows()const{return m_iNumRows;}
+};
+
+
+#endif
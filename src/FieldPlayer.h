@@ -1,89 +1,98 @@
-#pragma warning (disable:4786)
-#ifndef FIELDPLAYER_H
-#define FIELDPLAYER_H
-//------------------------------------------------------------------------
-//
-//  Name:   FieldPlayer.h
-//
-//  Desc:   Derived from a PlayerBase, this class encapsulates a player
-//          capable of moving around a soccer pitch, kicking, dribbling,
-//          shooting etc
-//
-//  Author: Mat Buckland 2003 (fup@ai-junkie.com)
-//
-//------------------------------------------------------------------------
-#include <vector>
-#include <string>
-#include <algorithm>
-#include <cassert>
-
-#include "FieldPlayerStates.h"
-#include "2D/Vector2D.h"
-#include "FSM/StateMachine.h"
-#include "PlayerBase.h"
-#include "FSM/StateMachine.h"
-#include "time/Regulator.h"
-
-class CSteeringBehavior;
-class SoccerTeam;
-class SoccerPitch;
-class Goal;
-struct Telegram;
-
-
-class FieldPlayer : public PlayerBase
-{
-
-public:
-
-  enum player_state {wait, guard, chaseball, dribble, returnhome, kickball, receiveball, supportattacker};
-
-private:
-
-   //an instance of the state machine class
-  StateMachine<FieldPlayer>*  m_pStateMachine;
-  
-  //limits the number of kicks a player may take per second
-  Regulator*                  m_pKickLimiter;
-
-  //player current state
-  player_state                m_curstate;
-
-  
-public:
-
-  FieldPlayer(SoccerTeam*    home_team,
-             int        home_region,
-             State<FieldPlayer>* start_state,
-             Vector2D  heading,
-             Vector2D      velocity,
-             double         mass,
-             double         max_force,
-             double         max_speed,
-             double         max_turn_rate,
-             double         scale,
-             FieldConst::player_role    role);   
-  
-  ~FieldPlayer();
-
-  //call this to update the player's position and orientation
-  void        Update();   
-
-  void        Render();
-
-  bool        HandleMessage(const Telegram& msg);
-
-  StateMachine<FieldPlayer>* GetFSM()const{return m_pStateMachine;}
-
-  bool        isReadyForNextKick()const{return m_pKickLimiter->isReady();}
-
-  void        SetCurrentState(player_state s) { m_curstate = s; }
-
-  player_state CurrentState()const { return m_curstate; }
-         
-};
-
-
-
-
+#pragma warning (disable:4786)
+#ifndef FIELDPLAYER_H
+#define FIELDPLAYER_H
+//------------------------------------------------------------------------
+//
+//  Name:   FieldPlayer.h
+//
+//  Desc:   Derived from a PlayerBase, this class encapsulates a player
+//          capable of moving around a soccer pitch, kicking, dribbling,
+//          shooting etc
+//
+//  Author: Mat Buckland 2003 (fup@ai-junkie.com)
+//
+//------------------------------------------------------------------------
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cassert>
+
+#include "FieldPlayerStates.h"
+#include "2D/Vector2D.h"
+#include "FSM/StateMachine.h"
+#include "PlayerBase.h"
+#include "FSM/StateMachine.h"
+#include "Time/Regulator.h"
+
+class CSteeringBehavior;
+class SoccerTeam;
+class SoccerPitch;
+class Goal;
+struct Telegram;
+
+
+class FieldPlayer : public PlayerBase, public StateChangeListener<FieldPlayer>
+{
+
+public:
+
+  enum player_state {wait, guard, chaseball, dribble, returnhome, kickball, receiveball, supportattacker};
+
+private:
+
+   //an instance of the state machine class
+  StateMachine<FieldPlayer>*  m_pStateMachine;
+  
+  //limits the number of kicks a player may take per second
+  Regulator*                  m_pKickLimiter;
+
+  //player current state
+  player_state                m_curstate;
+
+  friend class MatchSnapshot;
+
+  
+public:
+
+  FieldPlayer(SoccerTeam*    home_team,
+             int        home_region,
+             State<FieldPlayer>* start_state,
+             Vector2D  heading,
+             Vector2D      velocity,
+             double         mass,
+             double         max_force,
+             double         max_speed,
+             double         max_turn_rate,
+             double         scale,
+             FieldConst::player_role    role);   
+  
+  ~FieldPlayer();
+
+  //call this to update the player's position and orientation
+  void        Update(double TimeStep);   
+
+  void        Render();
+
+  bool        HandleMessage(const Telegram& msg);
+
+  void        RunStateMachine(double TimeStep);
+  bool        StateMachineHandleMessage(const Telegram& msg);
+
+  StateMachine<FieldPlayer>* GetFSM()const{return m_pStateMachine;}
+
+  //see StateChangeListener. Publishes the change on the pitch's bus
+  void        StateChanged(const State<FieldPlayer>* from,
+                           const State<FieldPlayer>* to);
+
+  bool        isReadyForNextKick()const{return m_pKickLimiter->isReady();}
+
+  void        SetCurrentState(player_state s) { m_curstate = s; }
+
+  player_state CurrentState()const { return m_curstate; }
+         
+};
+
+
+
+
 #endif
\ No newline at end of file
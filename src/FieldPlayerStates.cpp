@@ -1,979 +1,956 @@
-#include "FieldPlayerStates.h"
-#include "Debug/DebugConsole.h"
-#include "SoccerPitch.h"
-#include "FieldPlayer.h"
-#include "SteeringBehaviors.h"
-#include "SoccerTeam.h"
-#include "Goal.h"
-#include "2D/geometry.h"
-#include "SoccerBall.h"
-#include "ParamLoader.h"
-#include "Messaging/Telegram.h"
-#include "Messaging/MessageDispatcher.h"
-#include "SoccerMessages.h"
-
-#include "time/Regulator.h"
-
-
-//uncomment below to send state info to the debug window
-#define PLAYER_STATE_INFO_ON
-
-
-//************************************************************************ Global state
-
-GlobalPlayerState* GlobalPlayerState::Instance()
-{
-  static GlobalPlayerState instance;
-
-  return &instance;
-}
-
-
-void GlobalPlayerState::Execute(FieldPlayer* player)                                     
-{
-  //if a player is in possession and close to the ball reduce his max speed
-  if((player->BallWithinReceivingRange()) && (player->isControllingPlayer()))
-  {
-    player->SetMaxSpeed(Prm.PlayerMaxSpeedWithBall);
-  }
-
-  else
-  {
-     player->SetMaxSpeed(Prm.PlayerMaxSpeedWithoutBall);
-  }
-
-  // game off, just fall back...
-  if((FALSE == player->Pitch()->GameOn() || TRUE == player->Pitch()->GoalKeeperHasBall())
-        && player->CurrentState() != FieldPlayer::wait)
-  {
-    //when game is off, message is unusable.. @ning
-    //player->GetFSM()->ChangeState(ReturnToHomeRegion::Instance());
-    player->GetFSM()->ChangeState(Wait::Instance());
-    /*
-    Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
-                              player->ID(),
-                              player->ID(),
-                              Msg_GoCurrentHome,
-                              NULL);
-    */
-    return;
-  }
-  
-  //if a player is closest to the ball, and his team is not in control, or he is 
-  //the controlling player, then chase it! @ning
-  // use guard mode .. @ning
-  //if(TRUE == player->Pitch()->InSameRegion(player, player->Ball()))
-  //{
-  //  player->GetFSM()->ChangeState(Guard::Instance());
-  //}
-  /*
-  if(player->Pitch()->GameOn()
-        && player->isClosestTeamMemberToBall() && player->Team()->InControl() == FALSE
-        && player->CurrentState() != FieldPlayer::chaseball)
-   //   && player->GetFSM()->GetNameOfCurrentState() != "ReturnToHomeRegion")
-  {
-    Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
-                              player->ID(),
-                              player->ID(),
-                              Msg_ChaseBall,
-                              NULL);
-  }
-  */
-}
-
-
-bool GlobalPlayerState::OnMessage(FieldPlayer* player, const Telegram& telegram)
-{
-  switch(telegram.Msg)
-  {
-  case Msg_ReceiveBall:
-    {
-      //set the target
-      player->Steering()->SetTarget(*(static_cast<Vector2D*>(telegram.ExtraInfo)));
-
-      //change state 
-      player->GetFSM()->ChangeState(ReceiveBall::Instance());
-
-      return true;
-    }
-
-    break;
-
-  case Msg_ChaseBall:
-    {
-      player->GetFSM()->ChangeState(ChaseBall::Instance());
-    }
-
-    break;
-
-  case Msg_SupportAttacker:
-    {
-      //if already supporting just return
-      if (player->GetFSM()->isInState(*SupportAttacker::Instance()))
-      {
-        return true;
-      }
-      
-      //set the target to be the best supporting position
-      player->Steering()->SetTarget(player->Team()->GetSupportSpot());
-
-      //change the state
-      player->GetFSM()->ChangeState(SupportAttacker::Instance());
-
-      return true;
-    }
-
-    break;
-
- case Msg_Wait:
-    {
-      //change the state
-      player->GetFSM()->ChangeState(Wait::Instance());
-
-      return true;
-    }
-
-    break;
-
-  case Msg_GoHome:
-    {
-      player->SetDefaultHomeRegion();
-      
-      player->GetFSM()->ChangeState(ReturnToHomeRegion::Instance());
-
-      return true;
-    }
-
-    break;
-
-  case Msg_GoCurrentHome:
-  {
-	  player->GetFSM()->ChangeState(ReturnToHomeRegion::Instance());
-  }
-  break;
-
-  case Msg_PassToMe:
-    {  
-      
-      //get the position of the player requesting the pass 
-      FieldPlayer* receiver = static_cast<FieldPlayer*>(telegram.ExtraInfo);
-
-      #ifdef PLAYER_STATE_INFO_ON
-      debug_con << "Player " << player->ID() << " received request from " <<
-                    receiver->ID() << " to make pass" << "";
-      #endif
-
-      //if the ball is not within kicking range or their is already a 
-      //receiving player, this player cannot pass the ball to the player
-      //making the request.
-      if (player->Team()->Receiver() != NULL ||
-         !player->BallWithinKickingRange() )
-      {
-        #ifdef PLAYER_STATE_INFO_ON
-        debug_con << "Player " << player->ID() << " cannot make requested pass <cannot kick ball>" << "";
-        #endif
-
-        return true;
-      }
-      
-      //make the pass   
-      player->Ball()->Kick(receiver->Pos() - player->Ball()->Pos(),
-                           Prm.MaxPassingForce);
-
-          
-     #ifdef PLAYER_STATE_INFO_ON
-     debug_con << "Player " << player->ID() << " Passed ball to requesting player" << "";
-     #endif
-        
-      //let the receiver know a pass is coming 
-      Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
-                              player->ID(),
-                              receiver->ID(),
-                              Msg_ReceiveBall,
-                              &receiver->Pos());
-
-   
-
-      //change state   
-      player->GetFSM()->ChangeState(Wait::Instance());
-
-      player->FindSupport();
-
-      return true;
-    }
-
-    break;
-
-  }//end switch
-
-  return false;
-}
-                                
-
-       
-
-//***************************************************************************** CHASEBALL
-
-ChaseBall* ChaseBall::Instance()
-{
-  static ChaseBall instance;
-
-  return &instance;
-}
-
-
-void ChaseBall::Enter(FieldPlayer* player)
-{
-  player->Steering()->SeekOn();
-  
-  player->SetCurrentState(FieldPlayer::chaseball);
-
-  #ifdef PLAYER_STATE_INFO_ON
-  debug_con << "Player " << player->ID() << " enters chase state" << "";
-  #endif
-}
-
-void ChaseBall::Execute(FieldPlayer* player)                                     
-{
-  //if the ball is within kicking range the player changes state to KickBall.
-  if (player->BallWithinKickingRange())
-  {
-    player->GetFSM()->ChangeState(KickBall::Instance());
-    
-    return;
-  }
-
-  //if team is control the ball and player isn't the closest member, and, the ball is not in his region,
-  //then he can go into wait status.
-  //if player is near his home region, or is closest to ball, or is in the same region with ball,
-  //go and chase it.. @ning
-  if (false == player->isControllingPlayer() && false == player->isClosestTeamMemberToBall()
-		&& false == player->Pitch()->InSameRegion(player, player->Ball()))
-  {
-	  //our team is attacking, so guard the position to support attack..@ning
-	  if (true == player->Team()->InControl())
-	  {
-		  player->GetFSM()->ChangeState(Guard::Instance());
-
-		  return;
-	  }
-
-	  if (true == player->isFarFromHomeRegion())
-	  {
-		  player->GetFSM()->ChangeState(Wait::Instance());
-
-		  return;
-	  }
-  }
-
-  player->Steering()->SetTarget(player->Ball()->Pos());
-
-  return;
-
-  //if the player is the closest player to the ball, or the controller, or is in guard, then 
-  //he should keep chasing it
-  // just try another plan, see the end of this function...
-  /*
-  if (player->isClosestTeamMemberToBall() || player->isControllingPlayer()
-	  || TRUE == player->Pitch()->InSameRegion(player, player->Ball()))
-  {
-    player->Steering()->SetTarget(player->Ball()->Pos());
-
-    return;
-  }
-  */
-
-  // if the player is far from his home region, then get back.
-  // just for red team...MUST BE after closest process...
-  /*
-  if (player->Team()->Color() == SoccerTeam::red &&
-	  player->isFarFromHomeRegion())
-  {
-#ifdef PLAYER_STATE_INFO_ON
-	  debug_con << "Player " << player->ID() << " is far from his home " << player->HomeRegionIndex();
-#endif
-	  player->GetFSM()->ChangeState(ReturnToHomeRegion::Instance());
-	  return;
-  }
-  */
-  
-  //if the player is not closest to the ball anymore, he should return back
-  //to his home region and wait for another opportunity
-  //player->GetFSM()->ChangeState(ReturnToHomeRegion::Instance());
-  // because wait is the central state, so get back to wait..
-  //player->GetFSM()->ChangeState(Wait::Instance());
-
-  //return;
-  //or try another plan: if one is return to home, then he lose control.
-  //if team is lost control, then he will chase back, that will lead to a
-  //dead loop ... so, the plan is bad, give it up...
-  //if (player->isControllingPlayer()) {
-  //  player->Team()->LostControl();
-  //}
-}
-
-
-void ChaseBall::Exit(FieldPlayer* player)
-{
-  player->Steering()->SeekOff();
-}
-
-
-
-//*****************************************************************************SUPPORT ATTACKING PLAYER
-
-SupportAttacker* SupportAttacker::Instance()
-{
-  static SupportAttacker instance;
-
-  return &instance;
-}
-
-
-void SupportAttacker::Enter(FieldPlayer* player)
-{
-  player->Steering()->ArriveOn();
-
-  player->Steering()->SetTarget(player->Team()->GetSupportSpot());
-  
-  player->SetCurrentState(FieldPlayer::supportattacker);
-
-  #ifdef PLAYER_STATE_INFO_ON
-  debug_con << "Player " << player->ID() << " enters support state" << "";
-  #endif
-}
-
-void SupportAttacker::Execute(FieldPlayer* player)                                     
-{
-  //if his team loses control go back home
-  if (!player->Team()->InControl())
-  {
-    player->GetFSM()->ChangeState(ReturnToHomeRegion::Instance());
-    return;
-  }
-
-  // if he is controller, then change state to chase ball
-  // ok ... useless...
-  //if (player->isControllingPlayer())
-  //{
-  //  player->GetFSM()->ChangeState(ChaseBall::Instance());
-  //  return;
-  //}
-
-
-  //if the best supporting spot changes, change the steering target
-  if (player->Team()->GetSupportSpot() != player->Steering()->Target())
-  {    
-    player->Steering()->SetTarget(player->Team()->GetSupportSpot());
-
-    player->Steering()->ArriveOn();
-  }
-
-  //if this player has a shot at the goal AND the attacker can pass
-  //the ball to him the attacker should pass the ball to this player
-  if( player->Team()->CanShoot(player->Pos(),
-                               Prm.MaxShootingForce))
-  {
-    player->Team()->RequestPass(player);
-  }
-
-
-  //if this player is located at the support spot and his team still have
-  //possession, he should remain still and turn to face the ball
-  if (player->AtTarget())
-  {
-    player->Steering()->ArriveOff();
-        
-    //the player should keep his eyes on the ball!
-    player->TrackBall();
-
-    player->SetVelocity(Vector2D(0,0));
-
-    //if not threatened by another player request a pass
-    if (!player->isThreatened())
-    {
-      player->Team()->RequestPass(player);
-    }
-  }
-}
-
-
-void SupportAttacker::Exit(FieldPlayer* player)
-{
-  //set supporting player to null so that the team knows it has to 
-  //determine a new one.
-  player->Team()->SetSupportingPlayer(NULL);
-
-  player->Steering()->ArriveOff();
-}
-
-
-
-
-//************************************************************************ RETURN TO HOME REGION
-
-ReturnToHomeRegion* ReturnToHomeRegion::Instance()
-{
-  static ReturnToHomeRegion instance;
-
-  return &instance;
-}
-
-
-void ReturnToHomeRegion::Enter(FieldPlayer* player)
-{
-  player->Steering()->ArriveOn();
-
-  if (!player->HomeRegion()->Inside(player->Steering()->Target(), Region::halfsize))
-  {
-    player->Steering()->SetTarget(player->HomeRegion()->Center());
-  }
-
-  player->SetCurrentState(FieldPlayer::returnhome);
-
-  #ifdef PLAYER_STATE_INFO_ON
-  debug_con << "Player " << player->ID() << " enters ReturnToHome state" << "";
-  #endif
-}
-
-void ReturnToHomeRegion::Execute(FieldPlayer* player)
-{
-  if (player->Pitch()->GameOn())
-  {
-    //if the ball is nearer this player than any other team member  &&
-    //there is not an assigned receiver && the goalkeeper does not gave
-    //the ball, go chase it
-    if ( player->isClosestTeamMemberToBall() &&
-         (player->Team()->Receiver() == NULL) &&
-         !player->Pitch()->GoalKeeperHasBall())
-    {
-      player->GetFSM()->ChangeState(ChaseBall::Instance());
-
-      return;
-    }
-  }
-
-  //if game is on and close enough to home, change state to wait and set the 
-  //player target to his current position.(so that if he gets jostled out of 
-  //position he can move back to it)
-  if (player->Pitch()->GameOn() && player->HomeRegion()->Inside(player->Pos(),
-                                                             Region::halfsize))
-  {
-    player->Steering()->SetTarget(player->Pos());
-    player->GetFSM()->ChangeState(Wait::Instance());
-  }
-  //if game is not on the player must return much closer to the center of his
-  //home region
-  else if(!player->Pitch()->GameOn() && player->AtTarget())
-  {
-    player->GetFSM()->ChangeState(Wait::Instance());
-  }
-}
-
-void ReturnToHomeRegion::Exit(FieldPlayer* player)
-{
-  player->Steering()->ArriveOff();
-}
-
-
-
-
-//***************************************************************************** WAIT
-
-Wait* Wait::Instance()
-{
-  static Wait instance;
-
-  return &instance;
-}
-
-
-void Wait::Enter(FieldPlayer* player)
-{
-  player->SetCurrentState(FieldPlayer::wait);
-
-  #ifdef PLAYER_STATE_INFO_ON
-  debug_con << "Player " << player->ID() << " enters wait state" << "";
-  #endif
-
-  //if the game is not on make sure the target is the center of the player's
-  //home region. This is ensure all the players are in the correct positions
-  //ready for kick off
-  //if (!player->Pitch()->GameOn())
-  //{
-  //  player->Steering()->SetTarget(player->HomeRegion()->Center());
-  //}
-  //when player is in waing, he always need to return to his region. @ning
-  player->Steering()->SetTarget(player->HomeRegion()->Center());
-}
-
-void Wait::Execute(FieldPlayer* player)
-{    
-  //if the player has been jostled out of position, get back in position  
-  if (!player->AtTarget())
-  {
-    player->Steering()->ArriveOn();
-
-    //we don't need to return immediately, let the bullet fly for a while,
-    //but maybe lead to fail passing ball.. @ning
-    //return;
-  }
-
-  else
-  {
-    player->Steering()->ArriveOff();
-
-    player->SetVelocity(Vector2D(0,0));
-
-    //the player should keep his eyes on the ball!
-    player->TrackBall();
-  }
-
-  //if this player's team is controlling AND this player is not the attacker
-  //AND is further up the field than the attacker he should request a pass.
-  if ( player->Team()->InControl()    &&
-     (!player->isControllingPlayer()) &&
-       player->isAheadOfAttacker() )
-  {
-    player->Team()->RequestPass(player);
-
-    return;
-  }
-
-  //add guard mode .. @ning
-  if(player->Pitch()->GameOn() && true == player->InGuardRegion())
-  {
-    if (false == player->Team()->InControl())
-    {
-      player->GetFSM()->ChangeState(Guard::Instance());
-
-      return;
-    }
-    //to avoid player chasing ball when he just pass it to others.. @ning
-    //else if (true == player->isClosestTeamMemberToBall() && false == player->isControllingPlayer())
-    else if (true == player->isReceivePlayer() || true == player->isClosestTeamMemberToBall())
-    {
-      player->GetFSM()->ChangeState(ChaseBall::Instance());
-
-      return;
-    }
-  }
-  
-  //if (player->Pitch()->GameOn())
-  //{
-   //if the ball is nearer this player than any other team member  AND
-    //there is not an assigned receiver AND neither goalkeeper has
-    //the ball, go chase it
-    /*try guard mode ...
-    if (player->isClosestTeamMemberToBall() &&
-       player->Team()->Receiver() == NULL  &&
-       !player->Pitch()->GoalKeeperHasBall())
-   {
-     player->GetFSM()->ChangeState(ChaseBall::Instance());
-
-     return;
-   }
-   */
-    
-
-    //we don't need to go home here, we set it when enter wait state.. @ning
-    /*
-    if (player->InHomeRegion() == FALSE)
-    {
-      Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
-                            player->ID(),
-                            player->ID(),
-                            Msg_GoCurrentHome,
-                            NULL);
-    }
-    */
-  //}
-}
-
-void Wait::Exit(FieldPlayer* player){}
-
-
-//************************************************************************ GUARD
-
-Guard* Guard::Instance()
-{
-	static Guard instance;
-	
-	return &instance;
-}
-
-void Guard::Enter(FieldPlayer *player)
-{
-	player->SetCurrentState(FieldPlayer::guard);
-
-#ifdef PLAYER_STATE_INFO_ON
-	debug_con << "Player " << player->ID() << " enters guard state" << "";
-#endif
-}
-
-void Guard::Execute(FieldPlayer *player)
-{
-	//if the game is on, then guard the field, or, go back home region.
-	//here we treat wait state as central state...
-	if (player->Pitch()->GameOn())
-	{
-			if (false == player->Team()->InControl() && false == player->Pitch()->GoalKeeperHasBall()
-            && (true == player->Pitch()->InSameRegion(player, player->Ball())
-               || true == player->isClosestTeamMemberToBall()))
-			{
-				player->GetFSM()->ChangeState(ChaseBall::Instance());
-
-				return;
-			}
-      
-      if(true == player->Pitch()->GoalKeeperHasBall() || true == player->Team()->InControl()
-            || false == player->InGuardRegion())
-      {
-        player->GetFSM()->ChangeState(Wait::Instance());
-
-        return;
-      }
-
-      player->Steering()->ArriveOff();
-
-      player->SetVelocity(Vector2D(0,0));
-
-      //the player should keep his eyes on the ball!
-      player->TrackBall();
-	}
-  else
-  {
-    player->GetFSM()->ChangeState(Wait::Instance());
-
-    return;
-  }
-}
-
-void Guard::Exit(FieldPlayer *player)
-{
-
-}
-
-//************************************************************************ KICK BALL
-
-KickBall* KickBall::Instance()
-{
-  static KickBall instance;
-
-  return &instance;
-}
-
-
-void KickBall::Enter(FieldPlayer* player)
-{
-  //let the team know this player is controlling
-   player->Team()->SetControllingPlayer(player);
-   
-   //the player can only make so many kick attempts per second.
-   bool ready = player->isReadyForNextKick();
-   if (FALSE == ready) 
-   {
-     player->GetFSM()->ChangeState(ChaseBall::Instance());
-   }
-
-  player->SetCurrentState(FieldPlayer::kickball);
-
-  #ifdef PLAYER_STATE_INFO_ON
-  debug_con << "Player " << player->ID() << " enters kick state " << ready << "";
-  #endif
-}
-
-void KickBall::Execute(FieldPlayer* player)
-{ 
-  //calculate the dot product of the vector pointing to the ball
-  //and the player's heading
-  Vector2D ToBall = player->Ball()->Pos() - player->Pos();
-  double   dot    = player->Heading().Dot(Vec2DNormalize(ToBall)); 
-
-  //cannot kick the ball if the goalkeeper is in possession or if it is 
-  //behind the player or if there is already an assigned receiver. So just
-  //continue chasing the ball
-  if (player->Team()->Receiver() != NULL   ||
-      player->Pitch()->GoalKeeperHasBall() ||
-      (dot < 0) ) 
-  {
-    #ifdef PLAYER_STATE_INFO_ON
-    debug_con << "Goaly has ball " << player->Pitch()->GoalKeeperHasBall() << " / ball behind player" << "";
-    #endif
-    
-    player->GetFSM()->ChangeState(ChaseBall::Instance());
-
-    return;
-  }
-
-  /* Attempt a shot at the goal */
-
-  //if a shot is possible, this vector will hold the position along the 
-  //opponent's goal line the player should aim for.
-  Vector2D    BallTarget;
-
-  //the dot product is used to adjust the shooting force. The more
-  //directly the ball is ahead, the more forceful the kick
-  double power = Prm.MaxShootingForce * dot;
-
-  //if it is determined that the player could score a goal from this position
-  //OR if he should just kick the ball anyway, the player will attempt
-  //to make the shot
-  if (player->Team()->CanShoot(player->Ball()->Pos(),
-                               power,
-                               BallTarget)                   || 
-     (RandFloat() < Prm.ChancePlayerAttemptsPotShot))
-  {
-   #ifdef PLAYER_STATE_INFO_ON
-   debug_con << "Player " << player->ID() << " attempts a shot at " << BallTarget << "";
-   #endif
-
-   //add some noise to the kick. We don't want players who are 
-   //too accurate! The amount of noise can be adjusted by altering
-   //Prm.PlayerKickingAccuracy
-   BallTarget = AddNoiseToKick(player->Ball()->Pos(), BallTarget);
-
-   //this is the direction the ball will be kicked in
-   Vector2D KickDirection = BallTarget - player->Ball()->Pos();
-   
-   player->Ball()->Kick(KickDirection, power);
-    
-   //change state   
-   player->GetFSM()->ChangeState(Guard::Instance());
-   
-   player->FindSupport();
-  
-   return;
- }
-
-
-  /* Attempt a pass to a player */
-
-  //if a receiver is found this will point to it
-  PlayerBase* receiver = NULL;
-
-  power = Prm.MaxPassingForce * dot;
-  
-  //test if there are any potential candidates available to receive a pass
-  if (player->isThreatened()  &&
-      player->Team()->FindPass(player,
-                              receiver,
-                              BallTarget,
-                              power,
-                              Prm.MinPassDist))
-  {     
-    //add some noise to the kick
-    BallTarget = AddNoiseToKick(player->Ball()->Pos(), BallTarget);
-
-    Vector2D KickDirection = BallTarget - player->Ball()->Pos();
-   
-    player->Ball()->Kick(KickDirection, power);
-
-    #ifdef PLAYER_STATE_INFO_ON
-    debug_con << "Player " << player->ID() << " passes the ball with force " << power << "  to player " 
-              << receiver->ID() << "  Target is " << BallTarget << "";
-    #endif
-
-    
-    //let the receiver know a pass is coming 
-    Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
-                            player->ID(),
-                            receiver->ID(),
-                            Msg_ReceiveBall,
-                            &BallTarget);                            
-   
-
-    //the player should wait at his current position unless instruced
-    //otherwise  
-    player->GetFSM()->ChangeState(Wait::Instance());
-
-    player->FindSupport();
-
-    return;
-  }
-
-  //cannot shoot or pass, so dribble the ball upfield
-  else
-  {   
-    player->FindSupport();
-
-    player->GetFSM()->ChangeState(Dribble::Instance());
-  }   
-}
-
-
-//*************************************************************************** DRIBBLE
-
-Dribble* Dribble::Instance()
-{
-  static Dribble instance;
-
-  return &instance;
-}
-
-
-void Dribble::Enter(FieldPlayer* player)
-{
-  //let the team know this player is controlling
-  player->Team()->SetControllingPlayer(player);
-
-  player->SetCurrentState(FieldPlayer::dribble);
-
-#ifdef PLAYER_STATE_INFO_ON
-  debug_con << "Player " << player->ID() << " enters dribble state" << "";
-  #endif
-}
-
-void Dribble::Execute(FieldPlayer* player)
-{
-  double dot = player->Team()->HomeGoal()->Facing().Dot(player->Heading());
-
-  double distantFromWall = player->DistToOppGoal();
-
-  //if the ball is between the player and the home goal, it needs to swivel
-  // the ball around by doing multiple small kicks and turns until the player 
-  //is facing in the correct direction
-  if (dot < 0 && distantFromWall > FieldConst::MinTurnRadius())
-  {
-    //the player's heading is going to be rotated by a small amount (Pi/4) 
-    //and then the ball will be kicked in that direction
-    Vector2D direction = player->Heading();
-
-    //calculate the sign (+/-) of the angle between the player heading and the 
-    //facing direction of the goal so that the player rotates around in the 
-    //correct direction
-    double angle = QuarterPi * -1 *
-                 player->Team()->HomeGoal()->Facing().Sign(player->Heading());
-
-    Vec2DRotateAroundOrigin(direction, angle);
-
-    //this value works well whjen the player is attempting to control the
-    //ball and turn at the same time
-    const double KickingForce = 0.8;
-
-    player->Ball()->Kick(direction, KickingForce);
-  }
-
-  // turn back to wait supportor
-  else if (distantFromWall <= FieldConst::MinTurnRadius())
-  {
-    Vector2D direction = player->Heading();
-
-    double angle = QuarterPi * -1 *
-                 player->Team()->OpponentsGoal()->Facing().Sign(player->Heading());
-
-    Vec2DRotateAroundOrigin(direction, angle);
-
-    const double KickingForce = 0.8;
-
-    player->Ball()->Kick(direction, KickingForce);
-  }
-
-  //kick the ball down the field
-  else
-  {
-    Vector2D dir = player->Team()->HomeGoal()->Facing();
-
-    player->Ball()->Kick(dir, Prm.MaxDribbleForce);  
-  }
-
-  //the player has kicked the ball so he must now change state to follow it
-  player->GetFSM()->ChangeState(ChaseBall::Instance());
-    
-  return;  
-}
-
-
-
-//************************************************************************     RECEIVEBALL
-
-ReceiveBall* ReceiveBall::Instance()
-{
-  static ReceiveBall instance;
-
-  return &instance;
-}
-
-
-void ReceiveBall::Enter(FieldPlayer* player)
-{
-  //let the team know this player is receiving the ball
-  player->Team()->SetReceiver(player);
-  
-  //this player is also now the controlling player
-  player->Team()->SetControllingPlayer(player);
-
-  player->SetCurrentState(FieldPlayer::receiveball);
-
-  //there are two types of receive behavior. One uses arrive to direct
-  //the receiver to the position sent by the passer in its telegram. The
-  //other uses the pursuit behavior to pursue the ball. 
-  //This statement selects between them dependent on the probability
-  //ChanceOfUsingArriveTypeReceiveBehavior, whether or not an opposing
-  //player is close to the receiving player, and whether or not the receiving
-  //player is in the opponents 'hot region' (the third of the pitch closest
-  //to the opponent's goal
-  const double PassThreatRadius = 70.0;
-
-  if (( player->InHotRegion() ||
-        RandFloat() < Prm.ChanceOfUsingArriveTypeReceiveBehavior) &&
-     !player->Team()->isOpponentWithinRadius(player->Pos(), PassThreatRadius))
-  {
-    player->Steering()->ArriveOn();
-    
-    #ifdef PLAYER_STATE_INFO_ON
-    debug_con << "Player " << player->ID() << " enters receive state (Using Arrive)" << "";
-    #endif
-  }
-  else
-  {
-    player->Steering()->PursuitOn();
-
-    #ifdef PLAYER_STATE_INFO_ON
-    debug_con << "Player " << player->ID() << " enters receive state (Using Pursuit)" << "";
-    #endif
-  }
-}
-
-void ReceiveBall::Execute(FieldPlayer* player)
-{
-  //if the ball comes close enough to the player or if his team lose control, or if the ball is stopped
-  //he should change state to chase the ball
-  if (player->BallWithinReceivingRange() || !player->Team()->InControl() || player->Pitch()->Ball()->Velocity().LengthSq() <= FieldConst::MinBallSpeed() )
-  {
-    player->GetFSM()->ChangeState(ChaseBall::Instance());
-
-    return;
-  }  
-
-  if (player->Steering()->PursuitIsOn())
-  {
-    player->Steering()->SetTarget(player->Ball()->Pos());
-  }
-
-  //if the player has 'arrived' at the steering target he should wait and
-  //turn to face the ball
-  if (player->AtTarget())
-  {
-    player->Steering()->ArriveOff();
-    player->Steering()->PursuitOff();
-    player->TrackBall();    
-    player->SetVelocity(Vector2D(0,0));
-  } 
-}
-
-void ReceiveBall::Exit(FieldPlayer* player)
-{
-  player->Steering()->ArriveOff();
-  player->Steering()->PursuitOff();
-
-  player->Team()->SetReceiver(NULL);
-}
-
-
-
-
- 
-
-
-
+#include "FieldPlayerStates.h"
+#include "LogMessages.h"
+#include "SoccerPitch.h"
+#include "FieldPlayer.h"
+#include "SteeringBehaviors.h"
+#include "SoccerTeam.h"
+#include "Goal.h"
+#include "2D/geometry.h"
+#include "SoccerBall.h"
+#include "ParamLoader.h"
+#include "Messaging/Telegram.h"
+#include "Messaging/MessageDispatcher.h"
+#include "SoccerMessages.h"
+#include "MatchEvents.h"
+
+#include "Time/Regulator.h"
+
+
+//************************************************************************ Global state
+
+GlobalPlayerState* GlobalPlayerState::Instance()
+{
+  static GlobalPlayerState instance;
+
+  return &instance;
+}
+
+
+void GlobalPlayerState::Execute(FieldPlayer* player)                                     
+{
+  //if a player is in possession and close to the ball reduce his max speed
+  if((player->BallWithinReceivingRange()) && (player->isControllingPlayer()))
+  {
+    player->SetBaseMaxSpeed(Prm.PlayerMaxSpeedWithBall);
+  }
+
+  else
+  {
+     player->SetBaseMaxSpeed(Prm.PlayerMaxSpeedWithoutBall);
+  }
+
+  // game off, just fall back...
+  if((FALSE == player->Pitch()->GameOn() || TRUE == player->Pitch()->GoalKeeperHasBall())
+        && player->CurrentState() != FieldPlayer::wait)
+  {
+    //when game is off, message is unusable.. @ning
+    //player->GetFSM()->ChangeState(ReturnToHomeRegion::Instance());
+    player->GetFSM()->ChangeState(Wait::Instance());
+    /*
+    Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
+                              player->ID(),
+                              player->ID(),
+                              Msg_GoCurrentHome,
+                              NULL);
+    */
+    return;
+  }
+  
+  //if a player is closest to the ball, and his team is not in control, or he is 
+  //the controlling player, then chase it! @ning
+  // use guard mode .. @ning
+  //if(TRUE == player->Pitch()->InSameRegion(player, player->Ball()))
+  //{
+  //  player->GetFSM()->ChangeState(Guard::Instance());
+  //}
+  /*
+  if(player->Pitch()->GameOn()
+        && player->isClosestTeamMemberToBall() && player->Team()->InControl() == FALSE
+        && player->CurrentState() != FieldPlayer::chaseball)
+   //   && player->GetFSM()->GetNameOfCurrentState() != "ReturnToHomeRegion")
+  {
+    Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
+                              player->ID(),
+                              player->ID(),
+                              Msg_ChaseBall,
+                              NULL);
+  }
+  */
+}
+
+
+bool GlobalPlayerState::OnMessage(FieldPlayer* player, const Telegram& telegram)
+{
+  switch(telegram.Msg)
+  {
+  case Msg_ReceiveBall:
+    {
+      //set the target
+      player->Steering()->SetTarget(*(static_cast<Vector2D*>(telegram.ExtraInfo)));
+
+      //change state 
+      player->GetFSM()->ChangeState(ReceiveBall::Instance());
+
+      return true;
+    }
+
+    break;
+
+  case Msg_ChaseBall:
+    {
+      player->GetFSM()->ChangeState(ChaseBall::Instance());
+    }
+
+    break;
+
+  case Msg_SupportAttacker:
+    {
+      //if already supporting just return
+      if (player->GetFSM()->isInState(*SupportAttacker::Instance()))
+      {
+        return true;
+      }
+      
+      //set the target to be the best supporting position
+      player->Steering()->SetTarget(player->Team()->GetSupportSpot());
+
+      //change the state
+      player->GetFSM()->ChangeState(SupportAttacker::Instance());
+
+      return true;
+    }
+
+    break;
+
+ case Msg_Wait:
+    {
+      //change the state
+      player->GetFSM()->ChangeState(Wait::Instance());
+
+      return true;
+    }
+
+    break;
+
+  case Msg_GoHome:
+    {
+      player->SetDefaultHomeRegion();
+      
+      player->GetFSM()->ChangeState(ReturnToHomeRegion::Instance());
+
+      return true;
+    }
+
+    break;
+
+  case Msg_GoCurrentHome:
+  {
+	  player->GetFSM()->ChangeState(ReturnToHomeRegion::Instance());
+  }
+  break;
+
+  case Msg_PassToMe:
+    {  
+      
+      //get the position of the player requesting the pass 
+      FieldPlayer* receiver = static_cast<FieldPlayer*>(telegram.ExtraInfo);
+
+      binlog(log_debug, Log_PassRequested, player->ID(), receiver->ID());
+
+      //if the ball is not within kicking range or their is already a 
+      //receiving player, this player cannot pass the ball to the player
+      //making the request.
+      if (player->Team()->Receiver() != NULL ||
+         !player->BallWithinKickingRange() )
+      {
+        binlog(log_debug, Log_CannotMakeRequestedPass, player->ID());
+
+        return true;
+      }
+      
+      //make the pass   
+      player->Ball()->Kick(receiver->Pos() - player->Ball()->Pos(),
+                           Prm.MaxPassingForce);
+
+      player->PublishEvent(MatchEvent::pass, receiver->ID(), Prm.MaxPassingForce);
+
+          
+     binlog(log_debug, Log_PassedToRequester, player->ID());
+        
+      //let the receiver know a pass is coming 
+      Vector2D ReceivingPos = receiver->Pos();
+
+      Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
+                              player->ID(),
+                              receiver->ID(),
+                              Msg_ReceiveBall,
+                              &ReceivingPos);
+
+   
+
+      //change state   
+      player->GetFSM()->ChangeState(Wait::Instance());
+
+      player->FindSupport();
+
+      return true;
+    }
+
+    break;
+
+  }//end switch
+
+  return false;
+}
+                                
+
+       
+
+//***************************************************************************** CHASEBALL
+
+ChaseBall* ChaseBall::Instance()
+{
+  static ChaseBall instance;
+
+  return &instance;
+}
+
+
+void ChaseBall::Enter(FieldPlayer* player)
+{
+  player->Steering()->SeekOn();
+  
+  player->SetCurrentState(FieldPlayer::chaseball);
+
+  binlog(log_debug, Log_EnterChaseBall, player->ID());
+}
+
+void ChaseBall::Execute(FieldPlayer* player)                                     
+{
+  //if the ball is within kicking range the player changes state to KickBall.
+  if (player->ReachForBall(Prm.PlayerKickingDistanceSq))
+  {
+    player->GetFSM()->ChangeState(KickBall::Instance());
+    
+    return;
+  }
+
+  //if team is control the ball and player isn't the closest member, and, the ball is not in his region,
+  //then he can go into wait status.
+  //if player is near his home region, or is closest to ball, or is in the same region with ball,
+  //go and chase it.. @ning
+  if (false == player->isControllingPlayer() && false == player->isClosestTeamMemberToBall()
+		&& false == player->InSameRegionAsBall())
+  {
+	  //our team is attacking, so guard the position to support attack..@ning
+	  if (true == player->Team()->InControl())
+	  {
+		  player->GetFSM()->ChangeState(Guard::Instance());
+
+		  return;
+	  }
+
+	  if (true == player->isFarFromHomeRegion())
+	  {
+		  player->GetFSM()->ChangeState(Wait::Instance());
+
+		  return;
+	  }
+  }
+
+  player->Steering()->SetTarget(player->Ball()->Pos());
+
+  return;
+
+  //if the player is the closest player to the ball, or the controller, or is in guard, then 
+  //he should keep chasing it
+  // just try another plan, see the end of this function...
+  /*
+  if (player->isClosestTeamMemberToBall() || player->isControllingPlayer()
+	  || TRUE == player->InSameRegionAsBall())
+  {
+    player->Steering()->SetTarget(player->Ball()->Pos());
+
+    return;
+  }
+  */
+
+  // if the player is far from his home region, then get back.
+  // just for red team...MUST BE after closest process...
+  /*
+  if (player->Team()->Color() == SoccerTeam::red &&
+	  player->isFarFromHomeRegion())
+  {
+    binlog(log_debug, Log_FarFromHome, player->ID(), player->HomeRegionIndex());
+	  player->GetFSM()->ChangeState(ReturnToHomeRegion::Instance());
+	  return;
+  }
+  */
+  
+  //if the player is not closest to the ball anymore, he should return back
+  //to his home region and wait for another opportunity
+  //player->GetFSM()->ChangeState(ReturnToHomeRegion::Instance());
+  // because wait is the central state, so get back to wait..
+  //player->GetFSM()->ChangeState(Wait::Instance());
+
+  //return;
+  //or try another plan: if one is return to home, then he lose control.
+  //if team is lost control, then he will chase back, that will lead to a
+  //dead loop ... so, the plan is bad, give it up...
+  //if (player->isControllingPlayer()) {
+  //  player->Team()->LostControl();
+  //}
+}
+
+
+void ChaseBall::Exit(FieldPlayer* player)
+{
+  player->Steering()->SeekOff();
+}
+
+
+
+//*****************************************************************************SUPPORT ATTACKING PLAYER
+
+SupportAttacker* SupportAttacker::Instance()
+{
+  static SupportAttacker instance;
+
+  return &instance;
+}
+
+
+void SupportAttacker::Enter(FieldPlayer* player)
+{
+  player->Steering()->ArriveOn();
+
+  player->Steering()->SetTarget(player->Team()->GetSupportSpot());
+  
+  player->SetCurrentState(FieldPlayer::supportattacker);
+
+  binlog(log_debug, Log_EnterSupportAttacker, player->ID());
+}
+
+void SupportAttacker::Execute(FieldPlayer* player)                                     
+{
+  //if his team loses control go back home
+  if (!player->Team()->InControl())
+  {
+    player->GetFSM()->ChangeState(ReturnToHomeRegion::Instance());
+    return;
+  }
+
+  // if he is controller, then change state to chase ball
+  // ok ... useless...
+  //if (player->isControllingPlayer())
+  //{
+  //  player->GetFSM()->ChangeState(ChaseBall::Instance());
+  //  return;
+  //}
+
+
+  //if the best supporting spot changes, change the steering target
+  if (player->Team()->GetSupportSpot() != player->Steering()->Target())
+  {    
+    player->Steering()->SetTarget(player->Team()->GetSupportSpot());
+
+    player->Steering()->ArriveOn();
+  }
+
+  //if this player has a shot at the goal AND the attacker can pass
+  //the ball to him the attacker should pass the ball to this player
+  if( player->Team()->CanShoot(player->Pos(),
+                               Prm.MaxShootingForce))
+  {
+    player->Team()->RequestPass(player);
+  }
+
+
+  //if this player is located at the support spot and his team still have
+  //possession, he should remain still and turn to face the ball
+  if (player->AtTarget())
+  {
+    player->Steering()->ArriveOff();
+        
+    //the player should keep his eyes on the ball!
+    player->TrackBall();
+
+    player->SetVelocity(Vector2D(0,0));
+
+    //if not threatened by another player request a pass
+    if (!player->isThreatened())
+    {
+      player->Team()->RequestPass(player);
+    }
+  }
+}
+
+
+void SupportAttacker::Exit(FieldPlayer* player)
+{
+  //set supporting player to null so that the team knows it has to 
+  //determine a new one.
+  player->Team()->SetSupportingPlayer(NULL);
+
+  player->Steering()->ArriveOff();
+}
+
+
+
+
+//************************************************************************ RETURN TO HOME REGION
+
+ReturnToHomeRegion* ReturnToHomeRegion::Instance()
+{
+  static ReturnToHomeRegion instance;
+
+  return &instance;
+}
+
+
+void ReturnToHomeRegion::Enter(FieldPlayer* player)
+{
+  player->Steering()->ArriveOn();
+
+  if (!player->HomeRegion()->Inside(player->Steering()->Target(), Region::halfsize))
+  {
+    player->Steering()->SetTarget(player->HomeRegion()->Center());
+  }
+
+  player->SetCurrentState(FieldPlayer::returnhome);
+
+  binlog(log_debug, Log_EnterReturnToHomeRegion, player->ID());
+}
+
+void ReturnToHomeRegion::Execute(FieldPlayer* player)
+{
+  if (player->Pitch()->GameOn())
+  {
+    //if the ball is nearer this player than any other team member  &&
+    //there is not an assigned receiver && the goalkeeper does not gave
+    //the ball, go chase it
+    if ( player->isClosestTeamMemberToBall() &&
+         (player->Team()->Receiver() == NULL) &&
+         !player->Pitch()->GoalKeeperHasBall())
+    {
+      player->GetFSM()->ChangeState(ChaseBall::Instance());
+
+      return;
+    }
+  }
+
+  //if game is on and close enough to home, change state to wait and set the 
+  //player target to his current position.(so that if he gets jostled out of 
+  //position he can move back to it)
+  if (player->Pitch()->GameOn() && player->HomeRegion()->Inside(player->Pos(),
+                                                             Region::halfsize))
+  {
+    player->Steering()->SetTarget(player->Pos());
+    player->GetFSM()->ChangeState(Wait::Instance());
+  }
+  //if game is not on the player must return much closer to the center of his
+  //home region
+  else if(!player->Pitch()->GameOn() && player->AtTarget())
+  {
+    player->GetFSM()->ChangeState(Wait::Instance());
+  }
+}
+
+void ReturnToHomeRegion::Exit(FieldPlayer* player)
+{
+  player->Steering()->ArriveOff();
+}
+
+
+
+
+//***************************************************************************** WAIT
+
+Wait* Wait::Instance()
+{
+  static Wait instance;
+
+  return &instance;
+}
+
+
+void Wait::Enter(FieldPlayer* player)
+{
+  player->SetCurrentState(FieldPlayer::wait);
+
+  binlog(log_debug, Log_EnterWait, player->ID());
+
+  //if the game is not on make sure the target is the center of the player's
+  //home region. This is ensure all the players are in the correct positions
+  //ready for kick off
+  //if (!player->Pitch()->GameOn())
+  //{
+  //  player->Steering()->SetTarget(player->HomeRegion()->Center());
+  //}
+  //when player is in waing, he always need to return to his region. @ning
+  player->Steering()->SetTarget(player->HomeRegion()->Center());
+}
+
+void Wait::Execute(FieldPlayer* player)
+{    
+  //if the player has been jostled out of position, get back in position  
+  if (!player->AtTarget())
+  {
+    player->Steering()->ArriveOn();
+
+    //we don't need to return immediately, let the bullet fly for a while,
+    //but maybe lead to fail passing ball.. @ning
+    //return;
+  }
+
+  else
+  {
+    player->Steering()->ArriveOff();
+
+    player->SetVelocity(Vector2D(0,0));
+
+    //the player should keep his eyes on the ball!
+    player->TrackBall();
+  }
+
+  //if this player's team is controlling AND this player is not the attacker
+  //AND is further up the field than the attacker he should request a pass.
+  if ( player->Team()->InControl()    &&
+     (!player->isControllingPlayer()) &&
+       player->isAheadOfAttacker() )
+  {
+    player->Team()->RequestPass(player);
+
+    return;
+  }
+
+  //add guard mode .. @ning
+  if(player->Pitch()->GameOn() && true == player->InGuardRegion())
+  {
+    if (false == player->Team()->InControl())
+    {
+      player->GetFSM()->ChangeState(Guard::Instance());
+
+      return;
+    }
+    //to avoid player chasing ball when he just pass it to others.. @ning
+    //else if (true == player->isClosestTeamMemberToBall() && false == player->isControllingPlayer())
+    else if (true == player->isReceivePlayer() || true == player->isClosestTeamMemberToBall())
+    {
+      player->GetFSM()->ChangeState(ChaseBall::Instance());
+
+      return;
+    }
+  }
+  
+  //if (player->Pitch()->GameOn())
+  //{
+   //if the ball is nearer this player than any other team member  AND
+    //there is not an assigned receiver AND neither goalkeeper has
+    //the ball, go chase it
+    /*try guard mode ...
+    if (player->isClosestTeamMemberToBall() &&
+       player->Team()->Receiver() == NULL  &&
+       !player->Pitch()->GoalKeeperHasBall())
+   {
+     player->GetFSM()->ChangeState(ChaseBall::Instance());
+
+     return;
+   }
+   */
+    
+
+    //we don't need to go home here, we set it when enter wait state.. @ning
+    /*
+    if (player->InHomeRegion() == FALSE)
+    {
+      Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
+                            player->ID(),
+                            player->ID(),
+                            Msg_GoCurrentHome,
+                            NULL);
+    }
+    */
+  //}
+}
+
+void Wait::Exit(FieldPlayer* player){}
+
+
+//************************************************************************ GUARD
+
+Guard* Guard::Instance()
+{
+	static Guard instance;
+	
+	return &instance;
+}
+
+void Guard::Enter(FieldPlayer *player)
+{
+	player->SetCurrentState(FieldPlayer::guard);
+
+  binlog(log_debug, Log_EnterGuard, player->ID());
+}
+
+void Guard::Execute(FieldPlayer *player)
+{
+	//if the game is on, then guard the field, or, go back home region.
+	//here we treat wait state as central state...
+	if (player->Pitch()->GameOn())
+	{
+			if (false == player->Team()->InControl() && false == player->Pitch()->GoalKeeperHasBall()
+            && (true == player->InSameRegionAsBall()
+               || true == player->isClosestTeamMemberToBall()))
+			{
+				player->GetFSM()->ChangeState(ChaseBall::Instance());
+
+				return;
+			}
+      
+      if(true == player->Pitch()->GoalKeeperHasBall() || true == player->Team()->InControl()
+            || false == player->InGuardRegion())
+      {
+        player->GetFSM()->ChangeState(Wait::Instance());
+
+        return;
+      }
+
+      player->Steering()->ArriveOff();
+
+      player->SetVelocity(Vector2D(0,0));
+
+      //the player should keep his eyes on the ball!
+      player->TrackBall();
+	}
+  else
+  {
+    player->GetFSM()->ChangeState(Wait::Instance());
+
+    return;
+  }
+}
+
+void Guard::Exit(FieldPlayer *player)
+{
+
+}
+
+//************************************************************************ KICK BALL
+
+KickBall* KickBall::Instance()
+{
+  static KickBall instance;
+
+  return &instance;
+}
+
+
+void KickBall::Enter(FieldPlayer* player)
+{
+  //let the team know this player is controlling
+   player->Team()->SetControllingPlayer(player);
+   
+   //the player can only make so many kick attempts per second.
+   bool ready = player->isReadyForNextKick();
+   if (FALSE == ready) 
+   {
+     player->GetFSM()->ChangeState(ChaseBall::Instance());
+   }
+
+  player->SetCurrentState(FieldPlayer::kickball);
+
+  binlog(log_debug, Log_EnterKickBall, player->ID(), ready);
+}
+
+void KickBall::Execute(FieldPlayer* player)
+{ 
+  //calculate the dot product of the vector pointing to the ball
+  //and the player's heading
+  Vector2D ToBall = player->Ball()->Pos() - player->Pos();
+  double   dot    = player->Heading().Dot(Vec2DNormalize(ToBall)); 
+
+  //cannot kick the ball if the goalkeeper is in possession or if it is 
+  //behind the player or if there is already an assigned receiver. So just
+  //continue chasing the ball
+  if (player->Team()->Receiver() != NULL   ||
+      player->Pitch()->GoalKeeperHasBall() ||
+      (dot < 0) ) 
+  {
+    binlog(log_debug, Log_BallBehindPlayer, player->Pitch()->GoalKeeperHasBall());
+    
+    player->GetFSM()->ChangeState(ChaseBall::Instance());
+
+    return;
+  }
+
+  /* Attempt a shot at the goal */
+
+  //if a shot is possible, this vector will hold the position along the 
+  //opponent's goal line the player should aim for.
+  Vector2D    BallTarget;
+
+  //the dot product is used to adjust the shooting force. The more
+  //directly the ball is ahead, the more forceful the kick
+  double power = Prm.MaxShootingForce * dot;
+
+  //if it is determined that the player could score a goal from this position
+  //OR if he should just kick the ball anyway, the player will attempt
+  //to make the shot
+  if (player->Team()->CanShoot(player->Ball()->Pos(),
+                               power,
+                               BallTarget)                   || 
+     (RandFloat() < Prm.ChancePlayerAttemptsPotShot))
+  {
+   binlog(log_debug, Log_Shot, player->ID(), BallTarget);
+
+   //add some noise to the kick. We don't want players who are 
+   //too accurate! The amount of noise can be adjusted by altering
+   //Prm.PlayerKickingAccuracy
+   BallTarget = AddNoiseToKick(player->Ball()->Pos(), BallTarget);
+
+   //this is the direction the ball will be kicked in
+   Vector2D KickDirection = BallTarget - player->Ball()->Pos();
+   
+   player->Ball()->Kick(KickDirection, power);
+
+   player->PublishEvent(MatchEvent::shot, -1, power);
+    
+   //change state   
+   player->GetFSM()->ChangeState(Guard::Instance());
+   
+   player->FindSupport();
+  
+   return;
+ }
+
+
+  /* Attempt a pass to a player */
+
+  //if a receiver is found this will point to it
+  PlayerBase* receiver = NULL;
+
+  power = Prm.MaxPassingForce * dot;
+  
+  //test if there are any potential candidates available to receive a pass
+  if (player->isThreatened()  &&
+      player->Team()->FindPass(player,
+                              receiver,
+                              BallTarget,
+                              power,
+                              Prm.MinPassDist))
+  {     
+    //add some noise to the kick
+    BallTarget = AddNoiseToKick(player->Ball()->Pos(), BallTarget);
+
+    Vector2D KickDirection = BallTarget - player->Ball()->Pos();
+   
+    player->Ball()->Kick(KickDirection, power);
+
+    player->PublishEvent(MatchEvent::pass, receiver->ID(), power);
+
+    binlog(log_debug, Log_Pass, player->ID(), power, receiver->ID(), BallTarget);
+
+    
+    //let the receiver know a pass is coming 
+    Dispatcher->DispatchMsg(SEND_MSG_IMMEDIATELY,
+                            player->ID(),
+                            receiver->ID(),
+                            Msg_ReceiveBall,
+                            &BallTarget);                            
+   
+
+    //the player should wait at his current position unless instruced
+    //otherwise  
+    player->GetFSM()->ChangeState(Wait::Instance());
+
+    player->FindSupport();
+
+    return;
+  }
+
+  //cannot shoot or pass, so dribble the ball upfield
+  else
+  {   
+    player->FindSupport();
+
+    player->GetFSM()->ChangeState(Dribble::Instance());
+  }   
+}
+
+
+//*************************************************************************** DRIBBLE
+
+Dribble* Dribble::Instance()
+{
+  static Dribble instance;
+
+  return &instance;
+}
+
+
+void Dribble::Enter(FieldPlayer* player)
+{
+  //let the team know this player is controlling
+  player->Team()->SetControllingPlayer(player);
+
+  player->SetCurrentState(FieldPlayer::dribble);
+
+  binlog(log_debug, Log_EnterDribble, player->ID());
+}
+
+void Dribble::Execute(FieldPlayer* player)
+{
+  double dot = player->Team()->HomeGoal()->Facing().Dot(player->Heading());
+
+  double distantFromWall = player->DistToOppGoal();
+
+  //if the ball is between the player and the home goal, it needs to swivel
+  // the ball around by doing multiple small kicks and turns until the player 
+  //is facing in the correct direction
+  if (dot < 0 && distantFromWall > FieldConst::MinTurnRadius())
+  {
+    //the player's heading is going to be rotated by a small amount (Pi/4) 
+    //and then the ball will be kicked in that direction
+    Vector2D direction = player->Heading();
+
+    //calculate the sign (+/-) of the angle between the player heading and the 
+    //facing direction of the goal so that the player rotates around in the 
+    //correct direction
+    double angle = QuarterPi * -1 *
+                 player->Team()->HomeGoal()->Facing().Sign(player->Heading());
+
+    Vec2DRotateAroundOrigin(direction, angle);
+
+    //this value works well whjen the player is attempting to control the
+    //ball and turn at the same time
+    const double KickingForce = 0.8;
+
+    player->Ball()->Kick(direction, KickingForce);
+
+    player->PublishEvent(MatchEvent::kick, -1, KickingForce);
+  }
+
+  // turn back to wait supportor
+  else if (distantFromWall <= FieldConst::MinTurnRadius())
+  {
+    Vector2D direction = player->Heading();
+
+    double angle = QuarterPi * -1 *
+                 player->Team()->OpponentsGoal()->Facing().Sign(player->Heading());
+
+    Vec2DRotateAroundOrigin(direction, angle);
+
+    const double KickingForce = 0.8;
+
+    player->Ball()->Kick(direction, KickingForce);
+
+    player->PublishEvent(MatchEvent::kick, -1, KickingForce);
+  }
+
+  //kick the ball down the field
+  else
+  {
+    Vector2D dir = player->Team()->HomeGoal()->Facing();
+
+    player->Ball()->Kick(dir, Prm.MaxDribbleForce);  
+
+    player->PublishEvent(MatchEvent::kick, -1, Prm.MaxDribbleForce);
+  }
+
+  //the player has kicked the ball so he must now change state to follow it
+  player->GetFSM()->ChangeState(ChaseBall::Instance());
+    
+  return;  
+}
+
+
+
+//************************************************************************     RECEIVEBALL
+
+ReceiveBall* ReceiveBall::Instance()
+{
+  static ReceiveBall instance;
+
+  return &instance;
+}
+
+
+void ReceiveBall::Enter(FieldPlayer* player)
+{
+  //let the team know this player is receiving the ball
+  player->Team()->SetReceiver(player);
+  
+  //this player is also now the controlling player
+  player->Team()->SetControllingPlayer(player);
+
+  player->SetCurrentState(FieldPlayer::receiveball);
+
+  //there are two types of receive behavior. One uses arrive to direct
+  //the receiver to the position sent by the passer in its telegram. The
+  //other uses the pursuit behavior to pursue the ball. 
+  //This statement selects between them dependent on the probability
+  //ChanceOfUsingArriveTypeReceiveBehavior, whether or not an opposing
+  //player is close to the receiving player, and whether or not the receiving
+  //player is in the opponents 'hot region' (the third of the pitch closest
+  //to the opponent's goal
+  const double PassThreatRadius = 70.0;
+
+  if (( player->InHotRegion() ||
+        RandFloat() < Prm.ChanceOfUsingArriveTypeReceiveBehavior) &&
+     !player->Team()->isOpponentWithinRadius(player->Pos(), PassThreatRadius))
+  {
+    player->Steering()->ArriveOn();
+    
+    binlog(log_debug, Log_EnterReceiveBallArrive, player->ID());
+  }
+  else
+  {
+    player->Steering()->PursuitOn();
+
+    binlog(log_debug, Log_EnterReceiveBallPursuit, player->ID());
+  }
+}
+
+void ReceiveBall::Execute(FieldPlayer* player)
+{
+  //if the ball comes close enough to the player or if his team lose control, or if the ball is stopped
+  //he should change state to chase the ball
+  if (player->BallWithinReceivingRange() || !player->Team()->InControl() || player->Pitch()->Ball()->Velocity().LengthSq() <= FieldConst::MinBallSpeed() )
+  {
+    player->GetFSM()->ChangeState(ChaseBall::Instance());
+
+    return;
+  }  
+
+  if (player->Steering()->PursuitIsOn())
+  {
+    player->Steering()->SetTarget(player->Ball()->Pos());
+  }
+
+  //if the player has 'arrived' at the steering target he should wait and
+  //turn to face the ball
+  if (player->AtTarget())
+  {
+    player->Steering()->ArriveOff();
+    player->Steering()->PursuitOff();
+    player->TrackBall();    
+    player->SetVelocity(Vector2D(0,0));
+  } 
+}
+
+void ReceiveBall::Exit(FieldPlayer* player)
+{
+  player->Steering()->ArriveOff();
+  player->Steering()->PursuitOff();
+
+  player->Team()->SetReceiver(NULL);
+}
+
+
+
+
+ 
+
+
+
@@ -0,0 +1,28 @@
+#include "Formation.h"
+#include "TeamConfig.h"
+
+
+//------------------------------- ctor ----------------------------------------
+//-----------------------------------------------------------------------------
+Formation::Formation(const TeamConfig& config,
+                     bool              mirrored):m_iNumPlayers(config.Size()),
+                                                 m_Regions(num_tactics * config.Size())
+{
+  for (int p=0; p<m_iNumPlayers; ++p)
+  {
+    const PlayerConfig& player = config.Players[p];
+
+    int regions[num_tactics];
+
+    regions[kick_off]  = player.DefaultRegion;
+    regions[attacking] = player.AttackingRegion;
+    regions[defending] = player.DefendingRegion;
+
+    for (int t=0; t<num_tactics; ++t)
+    {
+      int region = mirrored ? MirrorRegion(regions[t]) : regions[t];
+
+      m_Regions[t*m_iNumPlayers + p] = (unsigned char)region;
+    }
+  }
+}
@@ -0,0 +1,47 @@
+#ifndef FORMATION_H
+#define FORMATION_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   Formation.h
+//
+//  Desc:   the regions a team's players take up under each of its
+//          tactics, worked out once from the team's config for the side
+//          of the pitch it plays on and packed a byte per region. This is
+//          what the team states read when they move the players about.
+//
+//------------------------------------------------------------------------
+#include <vector>
+
+class TeamConfig;
+
+
+class Formation
+{
+public:
+
+  enum tactic {kick_off, attacking, defending, num_tactics};
+
+private:
+
+  int                         m_iNumPlayers;
+
+  //the regions of every player under the first tactic, then the second...
+  std::vector<unsigned char>  m_Regions;
+
+public:
+
+  //the regions of the config are as the blue team sees the pitch. If
+  //mirrored they are turned round for the red team
+  Formation(const TeamConfig& config, bool mirrored);
+
+  int   NumPlayers()const{return m_iNumPlayers;}
+
+  int   Region(tactic t, int player)const
+  {
+    return m_Regions[t*m_iNumPlayers + player];
+  }
+};
+
+
+#endif
@@ -0,0 +1,826 @@
+//------------------------------------------------------------------------
+//
+//  Name:   HeadlessMain.cpp
+//
+//  Desc:   entry point for the headless match runner. Plays a batch of
+//          matches back to back without a window and writes one result
+//          row per match to stdout (or to the file given with -out).
+//
+//          usage: SimpleSoccerHeadless [-matches n] [-ticks n] [-dt n]
+//                                      [-threads n] [-seed n] [-out file]
+//                                      [-replay dir] [-events file] [-profile]
+//                                      [-tactics file -red team -blue team]
+//                                      [-log file [-loglevel level]]
+//                 SimpleSoccerHeadless -season file [-reps n] [-ticks n]
+//                                      [-dt n] [-threads n] [-seed n]
+//                                      [-out file]
+//                 SimpleSoccerHeadless -fork tick n ticks [-seed n] [-dt n]
+//                                      [-tactics file -red team -blue team]
+//                 SimpleSoccerHeadless -env n steps [-threads n] [-seed n]
+//                                      [-ticks n] [-dt n]
+//                 SimpleSoccerHeadless -checkactions file [-ticks n] [-dt n]
+//                                      [-seed n] [-tactics file -red team
+//                                      -blue team]
+//                 SimpleSoccerHeadless -checkpasses n [-ticks n] [-dt n]
+//                                      [-seed n]
+//                 SimpleSoccerHeadless -play file
+//                 SimpleSoccerHeadless -decodelog file
+//
+//          the matches are spread over -threads worker threads (by
+//          default one per hardware thread). Each match draws its random
+//          numbers from a stream seeded from -seed and the match number,
+//          so the results depend only on the seed, not on the threads.
+//          -dt plays each update n ticks long (3 plays at 20 updates a
+//          second), trading fidelity for speed; -ticks stays the length
+//          of a match in ticks. n may be no more than 4 (MaxTimeStep).
+//          With -replay a replay of each match is written to dir. -play
+//          plays a replay back through a pitch (rendering to nowhere) and
+//          reports on it.
+//          -events writes every event of every match (see MatchEvents.h)
+//          to file as comma separated rows, from a thread of its own. The
+//          matches are then played on one thread, one after the other.
+//          -profile times the parts of each tick and writes the p50, p99
+//          and max of each to stderr once the matches are over.
+//          -tactics reads team definitions from file (see TeamConfig.h);
+//          -red and -blue pick the teams to play from it. A side not
+//          picked plays its default team.
+//          -log records the diagnostics of the states (see BinaryLog.h) at
+//          -loglevel (trace, debug, info, warning or error; debug by
+//          default) and above to file. -decodelog writes such a file out
+//          as text.
+//          -fork plays a match to tick, then plays it on for ticks from
+//          there n times over, restoring a snapshot of the match before
+//          each (see MatchSnapshot.h), and writes how often each team
+//          scored to stdout.
+//          -env steps n learning environments (see SoccerEnv.h) in
+//          lockstep for steps steps, the red team of each played by random
+//          actions, and reports the rate. -ticks is then the length of an
+//          episode.
+//          -checkactions plays a match with the red team taking random
+//          actions, recording them to file, then plays it again with the
+//          actions read back from file (see PlayerController.h) and
+//          reports whether it played out exactly the same.
+//          -checkpasses plays a match and after every update tests n
+//          random passes for each team with the pass safety kernel and
+//          with the scalar test it vectorises (see PassSafetyKernel.h),
+//          and reports how often they disagreed.
+//          -season plays the season described in file -reps times (see
+//          Season.h) and writes the chances of each result and finishing
+//          position to stdout. With -out every match's result is written
+//          to file in columnar form (see ColumnarWriter.h).
+//
+//------------------------------------------------------------------------
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+#include <chrono>
+
+#include "constants.h"
+#include "MatchRunner.h"
+#include "MatchExecutor.h"
+#include "ParamLoader.h"
+#include "MatchReplay.h"
+#include "SoccerPitch.h"
+#include "Goal.h"
+#include "Game/GameWorld.h"
+#include "TickProfiler.h"
+#include "Season.h"
+#include "ColumnarWriter.h"
+#include "MatchEvents.h"
+#include "LogMessages.h"
+#include "Debug/BinaryLog.h"
+#include "SoccerEnv.h"
+#include "misc/RandomStream.h"
+
+
+//the default match length: five minutes of play at 60 ticks a second
+const int DefaultTicksPerMatch = 60 * 60 * 5;
+
+
+//------------------------------- PlayReplay ----------------------------------
+//
+//  applies every frame of the replay to a pitch and renders it, without
+//  running the AI, then seeks back to the middle of the match
+//-----------------------------------------------------------------------------
+int PlayReplay(const char* filename)
+{
+  ReplayReader replay;
+
+  if (!replay.Open(filename))
+  {
+    std::cerr << "cannot open replay " << filename << "\n";
+
+    return 1;
+  }
+
+  GameWorld       world;
+  ScopedGameWorld bind(&world);
+
+  SoccerPitch pitch(WindowWidth, WindowHeight);
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  int NumTelegrams = 0;
+
+  while (replay.Next())
+  {
+    replay.Apply(&pitch);
+
+    pitch.Render();
+
+    NumTelegrams += (int)replay.Frame().Telegrams.size();
+  }
+
+  double seconds = std::chrono::duration<double>(
+                          std::chrono::steady_clock::now() - start).count();
+
+  //a team scores by putting the ball in the opponent's goal
+  std::cout << filename << ": " << replay.NumFrames() << " ticks, "
+            << replay.NumKeyframes() << " keyframes, "
+            << NumTelegrams << " telegrams, "
+            << replay.SizeInBytes() << " bytes ("
+            << (double)replay.SizeInBytes() / MaxOf(1, replay.NumFrames())
+            << " bytes/tick), red " << pitch.BlueGoal()->NumGoalsScored()
+            << " blue " << pitch.RedGoal()->NumGoalsScored()
+            << ", played back in " << seconds << "s\n";
+
+  return 0;
+}
+
+
+//---------------------------- FindTeamConfig ---------------------------------
+//
+//  returns the named team, or NULL if no name is given. Throws if there is
+//  no team of that name
+//-----------------------------------------------------------------------------
+const TeamConfig* FindTeamConfig(const std::vector<TeamConfig>& teams, const char* name)
+{
+  if (!name) return NULL;
+
+  for (unsigned int t=0; t<teams.size(); ++t)
+  {
+    if (teams[t].Name == name) return &teams[t];
+  }
+
+  throw std::runtime_error(std::string("no team named ") + name + " in the tactics file");
+}
+
+
+//------------------------------- PlayForks -----------------------------------
+//
+//  forks match 0 at ForkTick and writes what became of the forks to stdout
+//-----------------------------------------------------------------------------
+int PlayForks(int                ForkTick,
+              int                NumForks,
+              int                LookaheadTicks,
+              double             TimeStep,
+              unsigned long long Seed,
+              const char*        TacticsFile,
+              const char*        RedTeam,
+              const char*        BlueTeam)
+{
+  try
+  {
+    ParamLoader::Instance();
+
+    std::vector<TeamConfig> teams;
+
+    if (TacticsFile) LoadTactics(TacticsFile, teams);
+
+    MatchRunner runner(ForkTick + LookaheadTicks, WindowWidth, WindowHeight);
+
+    runner.SetSeed(Seed);
+    runner.SetTimeStep(TimeStep);
+    runner.SetTeams(FindTeamConfig(teams, RedTeam), FindTeamConfig(teams, BlueTeam));
+
+    ForkResult result = runner.Fork(0, ForkTick, NumForks, LookaheadTicks);
+
+    int forks = MaxOf(1, result.NumForks);
+
+    std::cout << "forked at tick " << ForkTick << " into " << result.NumForks
+              << " forks of " << LookaheadTicks << " ticks: red scored in "
+              << result.RedScored << " (" << 100.0 * result.RedScored / forks
+              << "%), blue scored in " << result.BlueScored << " ("
+              << 100.0 * result.BlueScored / forks << "%)\n";
+
+    std::cerr << result.NumForks << " forks in " << result.Seconds << "s ("
+              << result.NumForks / MaxOf(result.Seconds, 1e-9) << " forks/sec), "
+              << "the first fork " << (result.Reproduced ? "reproduced" : "DIVERGED FROM")
+              << " the match\n";
+
+    return result.Reproduced ? 0 : 1;
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "error: " << e.what() << "\n";
+
+    return 1;
+  }
+}
+
+
+//----------------------------- CheckActions ----------------------------------
+//
+//  records and plays back the actions of match 0 and writes whether the
+//  playback reproduced the match to stderr
+//-----------------------------------------------------------------------------
+int CheckActions(const char*        filename,
+                 int                TicksPerMatch,
+                 double             TimeStep,
+                 unsigned long long Seed,
+                 const char*        TacticsFile,
+                 const char*        RedTeam,
+                 const char*        BlueTeam)
+{
+  try
+  {
+    ParamLoader::Instance();
+
+    std::vector<TeamConfig> teams;
+
+    if (TacticsFile) LoadTactics(TacticsFile, teams);
+
+    MatchRunner runner(TicksPerMatch, WindowWidth, WindowHeight);
+
+    runner.SetSeed(Seed);
+    runner.SetTimeStep(TimeStep);
+    runner.SetTeams(FindTeamConfig(teams, RedTeam), FindTeamConfig(teams, BlueTeam));
+
+    ActionReplayResult result = runner.ReplayActions(0, filename);
+
+    if (!result.Saved)
+    {
+      std::cerr << "cannot write actions to " << filename << "\n";
+
+      return 1;
+    }
+
+    std::cerr << result.NumFrames << " updates of actions recorded to " << filename
+              << ", red " << result.RedGoals << " blue " << result.BlueGoals
+              << ", the playback " << (result.Reproduced ? "reproduced" : "DIVERGED FROM")
+              << " the match\n";
+
+    return result.Reproduced ? 0 : 1;
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "error: " << e.what() << "\n";
+
+    return 1;
+  }
+}
+
+
+//------------------------------ CheckPasses ----------------------------------
+//
+//  compares the pass safety kernel's verdicts with the scalar test's over
+//  match 0 and writes the number of disagreements to stderr
+//-----------------------------------------------------------------------------
+int CheckPasses(int                PassesPerUpdate,
+                int                TicksPerMatch,
+                double             TimeStep,
+                unsigned long long Seed)
+{
+  try
+  {
+    ParamLoader::Instance();
+
+    MatchRunner runner(TicksPerMatch, WindowWidth, WindowHeight);
+
+    runner.SetSeed(Seed);
+    runner.SetTimeStep(TimeStep);
+
+    PassCheckResult result = runner.CheckPassSafety(0, PassesPerUpdate);
+
+    std::cerr << result.NumPasses << " passes tested, " << result.NumSafe
+              << " safe, the kernel and the scalar test disagreed on "
+              << result.NumMismatches << "\n";
+
+    return result.NumMismatches == 0 ? 0 : 1;
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "error: " << e.what() << "\n";
+
+    return 1;
+  }
+}
+
+
+//------------------------------- StepEnvs ------------------------------------
+//
+//  steps vectorised environments with random actions and writes the number
+//  of steps taken a second, and the goals scored, to stderr
+//-----------------------------------------------------------------------------
+int StepEnvs(int                NumEnvs,
+             int                NumSteps,
+             int                TicksPerEpisode,
+             double             TimeStep,
+             int                NumThreads,
+             unsigned long long Seed)
+{
+  try
+  {
+    ParamLoader::Instance();
+
+    EnvSettings settings;
+
+    settings.TicksPerEpisode = TicksPerEpisode;
+    settings.TimeStep        = TimeStep;
+
+    SoccerVecEnv envs(NumEnvs, settings, NumThreads);
+
+    envs.Reset(Seed);
+
+    std::vector<float> actions(NumEnvs * envs.ActionSize());
+
+    RandomStream random(Seed);
+
+    int    NumEpisodes = 0;
+    double GoalsFor    = 0.0;
+    double GoalsAgainst = 0.0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (int step=0; step<NumSteps; ++step)
+    {
+      for (unsigned int a=0; a<actions.size(); ++a)
+      {
+        actions[a] = (float)(random.RandFloat() * 2.0 - 1.0);
+      }
+
+      envs.Step(&actions[0]);
+
+      for (int env=0; env<NumEnvs; ++env)
+      {
+        if (envs.Rewards()[env] > 0) GoalsFor     += envs.Rewards()[env];
+        if (envs.Rewards()[env] < 0) GoalsAgainst -= envs.Rewards()[env];
+
+        NumEpisodes += envs.Dones()[env];
+      }
+    }
+
+    double seconds = std::chrono::duration<double>(
+                            std::chrono::steady_clock::now() - start).count();
+
+    std::cerr << (double)NumEnvs * NumSteps << " steps of " << NumEnvs
+              << " environments on " << envs.NumThreads() << " threads in "
+              << seconds << "s (" << (double)NumEnvs * NumSteps / seconds
+              << " steps/sec), " << NumEpisodes << " episodes finished, "
+              << "the random policy scored " << GoalsFor << " and conceded "
+              << GoalsAgainst << "\n";
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "error: " << e.what() << "\n";
+
+    return 1;
+  }
+
+  return 0;
+}
+
+
+//------------------------------- PlaySeason ----------------------------------
+//
+//  plays the season NumSeasons times and writes the summary to stdout
+//-----------------------------------------------------------------------------
+int PlaySeason(const char*        filename,
+               int                NumSeasons,
+               int                TicksPerMatch,
+               double             TimeStep,
+               int                NumThreads,
+               unsigned long long Seed,
+               const char*        OutFile)
+{
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  int NumMatches     = 0;
+  int NumThreadsUsed = 0;
+
+  try
+  {
+    ParamLoader::Instance();
+
+    Season season;
+
+    season.Load(filename);
+
+    MatchRunner runner(TicksPerMatch, WindowWidth, WindowHeight);
+
+    runner.SetSeed(Seed);
+    runner.SetTimeStep(TimeStep);
+
+    ColumnarWriter* results = NULL;
+
+    if (OutFile)
+    {
+      results = new ColumnarWriter(OutFile);
+
+      if (!results->isOpen())
+      {
+        delete results;
+
+        throw std::runtime_error(std::string("cannot open ") + OutFile);
+      }
+    }
+
+    MatchExecutor   executor(NumThreads);
+    SeasonSimulator simulator(season, runner, NumSeasons);
+
+    NumMatches     = simulator.NumMatches();
+    NumThreadsUsed = executor.NumThreads();
+
+    simulator.Run(executor, results);
+
+    delete results;
+
+    simulator.WriteSummary(std::cout);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "error: " << e.what() << "\n";
+
+    return 1;
+  }
+
+  double seconds = std::chrono::duration<double>(
+                          std::chrono::steady_clock::now() - start).count();
+
+  std::cerr << NumSeasons << " seasons, " << NumMatches << " matches on "
+            << NumThreadsUsed << " threads in " << seconds << "s ("
+            << NumMatches / seconds << " matches/sec)\n";
+
+  return 0;
+}
+
+
+int main(int argc, char* argv[])
+{
+  int          NumMatches    = 1;
+  int          TicksPerMatch = DefaultTicksPerMatch;
+  double       TimeStep      = 1.0;
+  int          NumThreads    = 0;
+  unsigned long long Seed    = (unsigned long long)time(NULL);
+  const char*  OutFile       = NULL;
+  const char*  ReplayDir     = NULL;
+  const char*  EventFile     = NULL;
+  const char*  LogFile       = NULL;
+  int          LogLevel      = log_debug;
+  const char*  SeasonFile    = NULL;
+  int          NumSeasons    = 1;
+  const char*  TacticsFile   = NULL;
+  const char*  RedTeam       = NULL;
+  const char*  BlueTeam      = NULL;
+  int          ForkTick      = -1;
+  int          NumForks      = 0;
+  int          LookaheadTicks = 0;
+  int          NumEnvs       = 0;
+  int          NumEnvSteps   = 0;
+  const char*  ActionsFile   = NULL;
+  int          PassesPerUpdate = 0;
+
+  for (int arg=1; arg<argc; ++arg)
+  {
+    bool HasValue = (arg+1 < argc);
+
+    //a count of zero or less falls through to the usage message, as do
+    //those of -ticks and -threads
+    if (HasValue && strcmp(argv[arg], "-matches") == 0 && atoi(argv[arg+1]) > 0)
+    {
+      NumMatches = atoi(argv[++arg]);
+    }
+    else if (HasValue && strcmp(argv[arg], "-ticks") == 0 && atoi(argv[arg+1]) > 0)
+    {
+      TicksPerMatch = atoi(argv[++arg]);
+    }
+    //a time step out of range, or not a number, falls through to the
+    //usage message
+    else if (HasValue && strcmp(argv[arg], "-dt") == 0 &&
+             atof(argv[arg+1]) > 0.0 && atof(argv[arg+1]) <= MaxTimeStep)
+    {
+      TimeStep = atof(argv[++arg]);
+    }
+    else if (HasValue && strcmp(argv[arg], "-threads") == 0 && atoi(argv[arg+1]) > 0)
+    {
+      NumThreads = atoi(argv[++arg]);
+    }
+    else if (HasValue && strcmp(argv[arg], "-seed") == 0)
+    {
+      Seed = strtoull(argv[++arg], NULL, 10);
+    }
+    else if (HasValue && strcmp(argv[arg], "-out") == 0)
+    {
+      OutFile = argv[++arg];
+    }
+    else if (HasValue && strcmp(argv[arg], "-replay") == 0)
+    {
+      ReplayDir = argv[++arg];
+    }
+    else if (HasValue && strcmp(argv[arg], "-events") == 0)
+    {
+      EventFile = argv[++arg];
+    }
+    else if (HasValue && strcmp(argv[arg], "-log") == 0)
+    {
+      LogFile = argv[++arg];
+    }
+    else if (HasValue && strcmp(argv[arg], "-loglevel") == 0)
+    {
+      LogLevel = BinaryLog::LevelFromName(argv[++arg]);
+
+      if (LogLevel < 0)
+      {
+        std::cerr << "unknown log level " << argv[arg] << "\n";
+
+        return 1;
+      }
+    }
+    else if (HasValue && strcmp(argv[arg], "-decodelog") == 0)
+    {
+      if (!BinaryLog::Decode(argv[++arg], std::cout))
+      {
+        std::cerr << "cannot decode " << argv[arg] << "\n";
+
+        return 1;
+      }
+
+      return 0;
+    }
+    else if (HasValue && strcmp(argv[arg], "-season") == 0)
+    {
+      SeasonFile = argv[++arg];
+    }
+    else if (HasValue && strcmp(argv[arg], "-reps") == 0)
+    {
+      NumSeasons = atoi(argv[++arg]);
+    }
+    else if (HasValue && strcmp(argv[arg], "-tactics") == 0)
+    {
+      TacticsFile = argv[++arg];
+    }
+    else if (HasValue && strcmp(argv[arg], "-red") == 0)
+    {
+      RedTeam = argv[++arg];
+    }
+    else if (HasValue && strcmp(argv[arg], "-blue") == 0)
+    {
+      BlueTeam = argv[++arg];
+    }
+    //a fork tick below zero, or a count or length of zero or less, falls
+    //through to the usage message
+    else if (arg+3 < argc && strcmp(argv[arg], "-fork") == 0 &&
+             atoi(argv[arg+1]) >= 0 && atoi(argv[arg+2]) > 0 && atoi(argv[arg+3]) > 0)
+    {
+      ForkTick       = atoi(argv[++arg]);
+      NumForks       = atoi(argv[++arg]);
+      LookaheadTicks = atoi(argv[++arg]);
+    }
+    //a count of zero or less falls through to the usage message
+    else if (arg+2 < argc && strcmp(argv[arg], "-env") == 0 &&
+             atoi(argv[arg+1]) > 0 && atoi(argv[arg+2]) > 0)
+    {
+      NumEnvs     = atoi(argv[++arg]);
+      NumEnvSteps = atoi(argv[++arg]);
+    }
+    else if (HasValue && strcmp(argv[arg], "-checkactions") == 0)
+    {
+      ActionsFile = argv[++arg];
+    }
+    //a count of zero or less falls through to the usage message
+    else if (HasValue && strcmp(argv[arg], "-checkpasses") == 0 && atoi(argv[arg+1]) > 0)
+    {
+      PassesPerUpdate = atoi(argv[++arg]);
+    }
+    else if (strcmp(argv[arg], "-profile") == 0)
+    {
+      TickProf->Enable(true);
+    }
+    else if (HasValue && strcmp(argv[arg], "-play") == 0)
+    {
+      try
+      {
+        return PlayReplay(argv[++arg]);
+      }
+      catch (const std::exception& e)
+      {
+        std::cerr << "error: " << e.what() << "\n";
+
+        return 1;
+      }
+    }
+    else
+    {
+      std::cerr << "usage: " << argv[0]
+                << " [-matches n] [-ticks n] [-dt n] [-threads n] [-seed n] [-out file]"
+                   " [-replay dir] [-events file] [-profile]\n       "
+                   "    [-tactics file -red team -blue team] [-log file [-loglevel level]]\n       "
+                << argv[0] << " -season file [-reps n] [-ticks n] [-dt n] [-threads n]"
+                   " [-seed n] [-out file]\n       "
+                << argv[0] << " -fork tick n ticks [-seed n] [-dt n]"
+                   " [-tactics file -red team -blue team]\n       "
+                << argv[0] << " -env n steps [-threads n] [-seed n] [-ticks n] [-dt n]\n       "
+                << argv[0] << " -checkactions file [-ticks n] [-dt n] [-seed n]"
+                   " [-tactics file -red team -blue team]\n       "
+                << argv[0] << " -checkpasses n [-ticks n] [-dt n] [-seed n]\n       "
+                << argv[0] << " -play file\n       "
+                << argv[0] << " -decodelog file\n";
+
+      return 1;
+    }
+  }
+
+  if (LogFile)
+  {
+    BinLog->SetMessages(SoccerLogMessages, NumLogMessageTypes);
+
+    if (!BinLog->Open(LogFile, LogLevel))
+    {
+      std::cerr << "cannot open " << LogFile << "\n";
+
+      return 1;
+    }
+  }
+
+  if (ForkTick >= 0)
+  {
+    return PlayForks(ForkTick, NumForks, LookaheadTicks, TimeStep, Seed,
+                     TacticsFile, RedTeam, BlueTeam);
+  }
+
+  if (ActionsFile)
+  {
+    return CheckActions(ActionsFile, TicksPerMatch, TimeStep, Seed,
+                        TacticsFile, RedTeam, BlueTeam);
+  }
+
+  if (PassesPerUpdate > 0)
+  {
+    return CheckPasses(PassesPerUpdate, TicksPerMatch, TimeStep, Seed);
+  }
+
+  if (NumEnvs > 0)
+  {
+    return StepEnvs(NumEnvs, NumEnvSteps, TicksPerMatch, TimeStep, NumThreads, Seed);
+  }
+
+  if (SeasonFile)
+  {
+    return PlaySeason(SeasonFile, NumSeasons, TicksPerMatch, TimeStep,
+                      NumThreads, Seed, OutFile);
+  }
+
+  std::ofstream file;
+
+  if (OutFile)
+  {
+    file.open(OutFile);
+
+    if (!file)
+    {
+      std::cerr << "cannot open " << OutFile << "\n";
+
+      return 1;
+    }
+  }
+
+  std::ostream& out = OutFile ? file : std::cout;
+
+  std::ofstream EventStream;
+
+  if (EventFile)
+  {
+    EventStream.open(EventFile);
+
+    if (!EventStream)
+    {
+      std::cerr << "cannot open " << EventFile << "\n";
+
+      return 1;
+    }
+
+    //the ring has only the one producer
+    NumThreads = 1;
+  }
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  int  NumThreadsUsed = 0;
+  bool ReplayFailed   = false;
+
+  try
+  {
+    //load the parameters up front so a missing file is reported here
+    //rather than on one of the workers
+    ParamLoader::Instance();
+
+    MatchRunner   runner(TicksPerMatch, WindowWidth, WindowHeight);
+
+    runner.SetSeed(Seed);
+    runner.SetTimeStep(TimeStep);
+
+    if (ReplayDir)
+    {
+      runner.SetReplayDirectory(ReplayDir);
+
+      //found out now rather than once every match has been played. The
+      //file is rewritten by the first match
+      std::ofstream probe(runner.ReplayFilename(0).c_str());
+
+      if (!probe)
+      {
+        std::cerr << "cannot write replays to " << ReplayDir << "\n";
+
+        return 1;
+      }
+    }
+
+    //the teams are looked up once here and shared by every match
+    std::vector<TeamConfig> teams;
+
+    if (TacticsFile) LoadTactics(TacticsFile, teams);
+
+    runner.SetTeams(FindTeamConfig(teams, RedTeam), FindTeamConfig(teams, BlueTeam));
+
+    MatchEventRing    events(1 << 16);
+    MatchEventWriter* EventWriter = NULL;
+
+    if (EventFile)
+    {
+      EventWriter = new MatchEventWriter(events, EventStream);
+
+      runner.SetEventRing(&events);
+    }
+
+    MatchExecutor executor(NumThreads);
+
+    NumThreadsUsed = executor.NumThreads();
+
+    std::vector<MatchResult> results = executor.Play(NumMatches, runner);
+
+    if (EventWriter)
+    {
+      EventWriter->Stop();
+
+      delete EventWriter;
+
+      if (events.NumDropped() > 0)
+      {
+        std::cerr << events.NumDropped() << " events were dropped\n";
+      }
+    }
+
+    WriteMatchResultHeader(out);
+
+    for (unsigned int match=0; match<results.size(); ++match)
+    {
+      WriteMatchResult(out, match, results[match]);
+    }
+
+    //the results are still written if a replay is not, but the run fails
+    for (unsigned int match=0; match<results.size(); ++match)
+    {
+      if (results[match].ReplayFailed)
+      {
+        std::cerr << "cannot write replay " << runner.ReplayFilename(match) << "\n";
+
+        ReplayFailed = true;
+      }
+    }
+  }
+  catch (const std::exception& e)
+  {
+    //most likely Params.ini could not be found in the working directory
+    std::cerr << "error: " << e.what() << "\n";
+
+    return 1;
+  }
+
+  double seconds = std::chrono::duration<double>(
+                          std::chrono::steady_clock::now() - start).count();
+
+  std::cerr << NumMatches << " matches on " << NumThreadsUsed << " threads, "
+            << (double)NumMatches * TicksPerMatch << " ticks in "
+            << seconds << "s ("
+            << (double)NumMatches * TicksPerMatch / seconds << " ticks/sec)\n";
+
+  if (TickProf->isEnabled())
+  {
+    TickProf->Dump(std::cerr);
+  }
+
+  if (BinLog->isOpen())
+  {
+    BinLog->Close();
+
+    if (BinLog->NumDropped() > 0)
+    {
+      std::cerr << BinLog->NumDropped() << " log messages were dropped\n";
+    }
+  }
+
+  return ReplayFailed ? 1 : 0;
+}
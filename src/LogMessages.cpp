@@ -0,0 +1,28 @@
+#include "LogMessages.h"
+
+
+//a team is given by its colour: 0 is blue and 1 red
+const LogMessage SoccerLogMessages[NumLogMessageTypes] =
+{
+  {Log_PassRequested,           "Player {} received request from {} to make pass"},
+  {Log_CannotMakeRequestedPass, "Player {} cannot make requested pass <cannot kick ball>"},
+  {Log_PassedToRequester,       "Player {} Passed ball to requesting player"},
+  {Log_EnterChaseBall,          "Player {} enters chase state"},
+  {Log_FarFromHome,             "Player {} is far from his home {}"},
+  {Log_EnterSupportAttacker,    "Player {} enters support state"},
+  {Log_EnterReturnToHomeRegion, "Player {} enters ReturnToHome state"},
+  {Log_EnterWait,               "Player {} enters wait state"},
+  {Log_EnterGuard,              "Player {} enters guard state"},
+  {Log_EnterKickBall,           "Player {} enters kick state {}"},
+  {Log_BallBehindPlayer,        "Goaly has ball {} / ball behind player"},
+  {Log_Shot,                    "Player {} attempts a shot at ({}, {})"},
+  {Log_Pass,                    "Player {} passes the ball with force {} to player {} Target is ({}, {})"},
+  {Log_EnterDribble,            "Player {} enters dribble state"},
+  {Log_EnterReceiveBallArrive,  "Player {} enters receive state (Using Arrive)"},
+  {Log_EnterReceiveBallPursuit, "Player {} enters receive state (Using Pursuit)"},
+  {Log_KeeperEnterInterceptBall,"Goaly {} enters InterceptBall"},
+  {Log_KeeperStopIntercept,     "Goaly {} stop intercept and turn back"},
+  {Log_KeeperKickToGoal,        "Goaly {} kick the ball to the opponents goal!"},
+  {Log_TeamEnterAttacking,      "Team {} entering Attacking state"},
+  {Log_TeamEnterDefending,      "Team {} entering Defending state"}
+};
@@ -0,0 +1,42 @@
+#ifndef LOG_MESSAGES_H
+#define LOG_MESSAGES_H
+//------------------------------------------------------------------------
+//
+//  Name:   LogMessages.h
+//
+//  Desc:   the messages the states log with binlog (see BinaryLog.h)
+//
+//------------------------------------------------------------------------
+#include "Debug/BinaryLog.h"
+
+enum LogMessageType
+{
+  Log_PassRequested,
+  Log_CannotMakeRequestedPass,
+  Log_PassedToRequester,
+  Log_EnterChaseBall,
+  Log_FarFromHome,
+  Log_EnterSupportAttacker,
+  Log_EnterReturnToHomeRegion,
+  Log_EnterWait,
+  Log_EnterGuard,
+  Log_EnterKickBall,
+  Log_BallBehindPlayer,
+  Log_Shot,
+  Log_Pass,
+  Log_EnterDribble,
+  Log_EnterReceiveBallArrive,
+  Log_EnterReceiveBallPursuit,
+  Log_KeeperEnterInterceptBall,
+  Log_KeeperStopIntercept,
+  Log_KeeperKickToGoal,
+  Log_TeamEnterAttacking,
+  Log_TeamEnterDefending,
+  NumLogMessageTypes
+};
+
+//the table of the messages, for BinaryLog::SetMessages
+extern const LogMessage SoccerLogMessages[NumLogMessageTypes];
+
+
+#endif
@@ -0,0 +1,238 @@
+#include "MatchEvents.h"
+#include "FieldPlayerStates.h"
+#include "GoalKeeperStates.h"
+#include "TeamStates.h"
+#include "SoccerTeam.h"
+
+#include <ostream>
+#include <chrono>
+#include <algorithm>
+
+
+//----------------------------- Subscribe -------------------------------------
+//-----------------------------------------------------------------------------
+void MatchEventBus::Subscribe(MatchEventRing* ring)
+{
+  if (std::find(m_Rings.begin(), m_Rings.end(), ring) == m_Rings.end())
+  {
+    m_Rings.push_back(ring);
+  }
+}
+
+//---------------------------- Unsubscribe ------------------------------------
+//-----------------------------------------------------------------------------
+void MatchEventBus::Unsubscribe(MatchEventRing* ring)
+{
+  m_Rings.erase(std::remove(m_Rings.begin(), m_Rings.end(), ring), m_Rings.end());
+}
+
+
+//---------------------------- MatchStateID -----------------------------------
+//
+//  the states are singletons so a state is found by its address
+//-----------------------------------------------------------------------------
+template <class T>
+static int FindStateID(const State<T>*        state,
+                       const State<T>* const* states,
+                       const int*             ids,
+                       int                    NumStates)
+{
+  for (int s=0; s<NumStates; ++s)
+  {
+    if (states[s] == state) return ids[s];
+  }
+
+  return MatchEvent::unknown_state;
+}
+
+int MatchStateID(const State<FieldPlayer>* state)
+{
+  static const State<FieldPlayer>* const states[] = {GlobalPlayerState::Instance(),
+                                                     ChaseBall::Instance(),
+                                                     Dribble::Instance(),
+                                                     ReturnToHomeRegion::Instance(),
+                                                     Wait::Instance(),
+                                                     Guard::Instance(),
+                                                     KickBall::Instance(),
+                                                     ReceiveBall::Instance(),
+                                                     SupportAttacker::Instance()};
+
+  static const int ids[] = {MatchEvent::player_global,
+                            MatchEvent::player_chase_ball,
+                            MatchEvent::player_dribble,
+                            MatchEvent::player_return_to_home_region,
+                            MatchEvent::player_wait,
+                            MatchEvent::player_guard,
+                            MatchEvent::player_kick_ball,
+                            MatchEvent::player_receive_ball,
+                            MatchEvent::player_support_attacker};
+
+  return FindStateID(state, states, ids, sizeof(ids)/sizeof(ids[0]));
+}
+
+int MatchStateID(const State<GoalKeeper>* state)
+{
+  static const State<GoalKeeper>* const states[] = {GlobalKeeperState::Instance(),
+                                                    TendGoal::Instance(),
+                                                    InterceptBall::Instance(),
+                                                    ReturnHome::Instance(),
+                                                    PutBallBackInPlay::Instance()};
+
+  static const int ids[] = {MatchEvent::keeper_global,
+                            MatchEvent::keeper_tend_goal,
+                            MatchEvent::keeper_intercept_ball,
+                            MatchEvent::keeper_return_home,
+                            MatchEvent::keeper_put_ball_back_in_play};
+
+  return FindStateID(state, states, ids, sizeof(ids)/sizeof(ids[0]));
+}
+
+int MatchStateID(const State<SoccerTeam>* state)
+{
+  static const State<SoccerTeam>* const states[] = {Attacking::Instance(),
+                                                    Defending::Instance(),
+                                                    PrepareForKickOff::Instance()};
+
+  static const int ids[] = {MatchEvent::team_attacking,
+                            MatchEvent::team_defending,
+                            MatchEvent::team_prepare_for_kick_off};
+
+  return FindStateID(state, states, ids, sizeof(ids)/sizeof(ids[0]));
+}
+
+//--------------------------- MatchStateName ----------------------------------
+//-----------------------------------------------------------------------------
+const char* MatchStateName(int id)
+{
+  static const char* const names[MatchEvent::num_state_ids] =
+  {
+    "unknown",
+    "Attacking",
+    "Defending",
+    "PrepareForKickOff",
+    "GlobalPlayerState",
+    "ChaseBall",
+    "Dribble",
+    "ReturnToHomeRegion",
+    "Wait",
+    "Guard",
+    "KickBall",
+    "ReceiveBall",
+    "SupportAttacker",
+    "GlobalKeeperState",
+    "TendGoal",
+    "InterceptBall",
+    "ReturnHome",
+    "PutBallBackInPlay"
+  };
+
+  if (id < 0 || id >= MatchEvent::num_state_ids) return names[MatchEvent::unknown_state];
+
+  return names[id];
+}
+
+//--------------------------- MatchEventName ----------------------------------
+//-----------------------------------------------------------------------------
+const char* MatchEventName(int type)
+{
+  static const char* const names[MatchEvent::num_event_types] =
+  {
+    "match_start",
+    "match_end",
+    "kick",
+    "pass",
+    "shot",
+    "interception",
+    "goal",
+    "state_change"
+  };
+
+  if (type < 0 || type >= MatchEvent::num_event_types) return "unknown";
+
+  return names[type];
+}
+
+
+//------------------------ MatchEventWriter ctor ------------------------------
+//-----------------------------------------------------------------------------
+MatchEventWriter::MatchEventWriter(MatchEventRing& ring,
+                                   std::ostream&   out):m_Ring(ring),
+                                                        m_Out(out),
+                                                        m_bStop(false),
+                                                        m_iMatch(-1)
+{
+  m_Out << "match,tick,event,team,player,other,from,to,x,y,force\n";
+
+  m_Thread = std::thread(&MatchEventWriter::Run, this);
+}
+
+//-------------------------------- Stop ---------------------------------------
+//-----------------------------------------------------------------------------
+void MatchEventWriter::Stop()
+{
+  if (!m_Thread.joinable()) return;
+
+  m_bStop.store(true);
+
+  m_Thread.join();
+}
+
+//--------------------------------- Run ---------------------------------------
+//
+//  drains the ring a batch at a time, sleeping a little whenever it is
+//  found empty. Once asked to stop it empties the ring one last time
+//-----------------------------------------------------------------------------
+void MatchEventWriter::Run()
+{
+  const size_t BatchSize = 256;
+
+  MatchEvent batch[BatchSize];
+
+  for (;;)
+  {
+    //read before the ring is drained, so that nothing published before
+    //Stop was called can be missed
+    bool stopping = m_bStop.load();
+
+    size_t count = m_Ring.Pop(batch, BatchSize);
+
+    for (size_t i=0; i<count; ++i)
+    {
+      Write(batch[i]);
+    }
+
+    if (count == 0)
+    {
+      if (stopping) break;
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  m_Out.flush();
+}
+
+//-------------------------------- Write --------------------------------------
+//-----------------------------------------------------------------------------
+void MatchEventWriter::Write(const MatchEvent& e)
+{
+  if (e.Type == MatchEvent::match_start) m_iMatch = e.Other;
+
+  m_Out << m_iMatch << ','
+        << e.Tick << ','
+        << MatchEventName(e.Type) << ','
+        << (e.Team == SoccerTeam::red ? "red" : e.Team == SoccerTeam::blue ? "blue" : "") << ','
+        << e.Player << ','
+        << e.Other << ',';
+
+  if (e.Type == MatchEvent::state_change)
+  {
+    m_Out << MatchStateName(e.FromState) << ',' << MatchStateName(e.ToState);
+  }
+  else
+  {
+    m_Out << ',';
+  }
+
+  m_Out << ',' << e.x << ',' << e.y << ',' << e.Force << '\n';
+}
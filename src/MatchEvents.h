@@ -0,0 +1,210 @@
+#ifndef MATCHEVENTS_H
+#define MATCHEVENTS_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   MatchEvents.h
+//
+//  Desc:   typed events of a match (kicks, passes, shots, the ball being
+//          won, goals and changes of state) and the bus the pitch
+//          publishes them on.
+//
+//          Anything wanting the events (stats, replays, a live feed)
+//          subscribes a MatchEventRing to the pitch's bus and drains it
+//          on a thread of its own. An event is a few numbers copied into
+//          each ring; the simulation never waits for a consumer, never
+//          formats anything for one and, if a ring is full, drops the
+//          event (the ring counts how many). With no ring subscribed
+//          publishing costs a test.
+//
+//          The simulation thread is the one producer of every ring
+//          subscribed to its pitch, so a ring may only be subscribed to
+//          one pitch at a time.
+//
+//------------------------------------------------------------------------
+#include <vector>
+#include <iosfwd>
+#include <thread>
+#include <atomic>
+
+#include "misc/SpscRing.h"
+
+template <class entity_type> class State;
+class FieldPlayer;
+class GoalKeeper;
+class SoccerTeam;
+
+
+struct MatchEvent
+{
+  enum event_type
+  {
+    match_start,
+    match_end,
+    kick,           //any kick that isn't a pass or a shot
+    pass,           //a pass is attempted
+    shot,
+    interception,   //a player wins the ball from the other team
+    goal,
+    state_change,
+    num_event_types
+  };
+
+  //the states of the state machines, numbered so that consumers don't
+  //need to know about the classes
+  enum state_id
+  {
+    unknown_state,
+    team_attacking,
+    team_defending,
+    team_prepare_for_kick_off,
+    player_global,
+    player_chase_ball,
+    player_dribble,
+    player_return_to_home_region,
+    player_wait,
+    player_guard,
+    player_kick_ball,
+    player_receive_ball,
+    player_support_attacker,
+    keeper_global,
+    keeper_tend_goal,
+    keeper_intercept_ball,
+    keeper_return_home,
+    keeper_put_ball_back_in_play,
+    num_state_ids
+  };
+
+  int     Type;
+
+  //the tick of the simulation clock the event happened on
+  long    Tick;
+
+  //the colour of the team (SoccerTeam::team_color) and the ID of the
+  //player involved, or -1
+  int     Team;
+  int     Player;
+
+  //the receiver of a pass, the player the ball was won from, or the match
+  //number of match_start and match_end. Otherwise -1
+  int     Other;
+
+  //the states of a state_change
+  int     FromState;
+  int     ToState;
+
+  //the position of the ball
+  double  x;
+  double  y;
+
+  //the force of a kick, pass or shot
+  double  Force;
+
+  explicit MatchEvent(int type = kick):Type(type),
+                                       Tick(0),
+                                       Team(-1),
+                                       Player(-1),
+                                       Other(-1),
+                                       FromState(unknown_state),
+                                       ToState(unknown_state),
+                                       x(0.0),
+                                       y(0.0),
+                                       Force(0.0)
+  {}
+};
+
+
+typedef SpscRing<MatchEvent> MatchEventRing;
+
+
+//---------------------------- MatchEventBus -----------------------------
+//
+//  the rings subscribed to a pitch. Subscribe and Unsubscribe must not be
+//  called while the pitch is being updated
+//------------------------------------------------------------------------
+class MatchEventBus
+{
+private:
+
+  std::vector<MatchEventRing*>  m_Rings;
+
+  //stamped on each event published
+  long                          m_lTick;
+
+public:
+
+  MatchEventBus():m_lTick(0){}
+
+  void  Subscribe(MatchEventRing* ring);
+  void  Unsubscribe(MatchEventRing* ring);
+
+  //true if anyone is listening. Test this before going to the trouble of
+  //making an event
+  bool  isActive()const{return !m_Rings.empty();}
+
+  //set by the pitch at the start of each update
+  void  SetTick(long tick){m_lTick = tick;}
+
+  void  Publish(MatchEvent e)
+  {
+    e.Tick = m_lTick;
+
+    for (unsigned int r=0; r<m_Rings.size(); ++r)
+    {
+      m_Rings[r]->TryPush(e);
+    }
+  }
+};
+
+
+//the ID of a state, or unknown_state if it isn't one of the game's
+int         MatchStateID(const State<FieldPlayer>* state);
+int         MatchStateID(const State<GoalKeeper>* state);
+int         MatchStateID(const State<SoccerTeam>* state);
+
+const char* MatchStateName(int id);
+const char* MatchEventName(int type);
+
+
+//--------------------------- MatchEventWriter ---------------------------
+//
+//  a consumer that drains a ring on a thread of its own and writes the
+//  events to a stream as comma separated rows, one per event
+//------------------------------------------------------------------------
+class MatchEventWriter
+{
+private:
+
+  MatchEventRing&    m_Ring;
+
+  std::ostream&      m_Out;
+
+  //set to ask the thread to write what is left in the ring and finish
+  std::atomic<bool>  m_bStop;
+
+  //the match of the events being written, from the last match_start
+  int                m_iMatch;
+
+  std::thread        m_Thread;
+
+  void  Run();
+
+  void  Write(const MatchEvent& e);
+
+  MatchEventWriter(const MatchEventWriter&);
+  MatchEventWriter& operator=(const MatchEventWriter&);
+
+public:
+
+  //writes the column names and starts draining the ring
+  MatchEventWriter(MatchEventRing& ring, std::ostream& out);
+
+  ~MatchEventWriter(){Stop();}
+
+  //writes whatever is still in the ring and stops the thread. Call once
+  //nothing more will be published
+  void  Stop();
+};
+
+
+#endif
@@ -0,0 +1,126 @@
+#include "MatchExecutor.h"
+
+
+//------------------------------- ctor ----------------------------------------
+//-----------------------------------------------------------------------------
+MatchExecutor::MatchExecutor(int NumThreads):m_iNumJobs(0),
+                                             m_iNextJob(0),
+                                             m_iBatch(0),
+                                             m_iNumBusy(0),
+                                             m_bShutdown(false)
+{
+  if (NumThreads <= 0)
+  {
+    NumThreads = (int)std::thread::hardware_concurrency();
+
+    if (NumThreads <= 0) NumThreads = 1;
+  }
+
+  for (int t=0; t<NumThreads; ++t)
+  {
+    m_Workers.push_back(std::thread(&MatchExecutor::WorkerLoop, this));
+  }
+}
+
+//------------------------------- dtor ----------------------------------------
+//-----------------------------------------------------------------------------
+MatchExecutor::~MatchExecutor()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    m_bShutdown = true;
+  }
+
+  m_BatchPosted.notify_all();
+
+  for (unsigned int t=0; t<m_Workers.size(); ++t)
+  {
+    m_Workers[t].join();
+  }
+}
+
+//----------------------------- WorkerLoop ------------------------------------
+//
+//  waits for a batch to be posted, then takes job indices until there are
+//  none left
+//-----------------------------------------------------------------------------
+void MatchExecutor::WorkerLoop()
+{
+  unsigned int LastBatch = 0;
+
+  for (;;)
+  {
+    std::function<void(int)>* pJob;
+    int                       NumJobs;
+
+    {
+      std::unique_lock<std::mutex> lock(m_Mutex);
+
+      while (!m_bShutdown && m_iBatch == LastBatch)
+      {
+        m_BatchPosted.wait(lock);
+      }
+
+      if (m_bShutdown) return;
+
+      LastBatch = m_iBatch;
+      pJob      = &m_Job;
+      NumJobs   = m_iNumJobs;
+    }
+
+    for (int idx = m_iNextJob++; idx < NumJobs; idx = m_iNextJob++)
+    {
+      (*pJob)(idx);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+
+      if (--m_iNumBusy == 0)
+      {
+        m_BatchDone.notify_all();
+      }
+    }
+  }
+}
+
+//----------------------------- ParallelFor -----------------------------------
+//-----------------------------------------------------------------------------
+void MatchExecutor::ParallelFor(int NumJobs, const std::function<void(int)>& job)
+{
+  if (NumJobs <= 0) return;
+
+  std::unique_lock<std::mutex> lock(m_Mutex);
+
+  m_Job      = job;
+  m_iNumJobs = NumJobs;
+  m_iNextJob = 0;
+  m_iNumBusy = (int)m_Workers.size();
+
+  ++m_iBatch;
+
+  m_BatchPosted.notify_all();
+
+  while (m_iNumBusy > 0)
+  {
+    m_BatchDone.wait(lock);
+  }
+
+  m_Job = std::function<void(int)>();
+}
+
+//-------------------------------- Play ---------------------------------------
+//-----------------------------------------------------------------------------
+std::vector<MatchResult> MatchExecutor::Play(int                NumMatches,
+                                             const MatchRunner& runner)
+{
+  std::vector<MatchResult> results(NumMatches > 0 ? NumMatches : 0);
+
+  ParallelFor(NumMatches, [&](int match)
+  {
+    results[match] = runner.Play(match);
+  });
+
+  return results;
+}
@@ -0,0 +1,78 @@
+#ifndef MATCHEXECUTOR_H
+#define MATCHEXECUTOR_H
+//------------------------------------------------------------------------
+//
+//  Name:   MatchExecutor.h
+//
+//  Desc:   a pool of worker threads that plays independent matches
+//          concurrently. Each match runs start to finish on one worker in
+//          its own GameWorld so the workers share nothing but the
+//          (read only) parameters, and scale with the number of cores.
+//
+//------------------------------------------------------------------------
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+#include "MatchRunner.h"
+
+
+class MatchExecutor
+{
+private:
+
+  std::vector<std::thread>  m_Workers;
+
+  std::mutex                m_Mutex;
+
+  //signalled when a new batch of jobs is posted or the pool shuts down
+  std::condition_variable   m_BatchPosted;
+
+  //signalled when the last worker finishes its share of a batch
+  std::condition_variable   m_BatchDone;
+
+  //the current batch: Job is called once for every index in [0, NumJobs)
+  std::function<void(int)>  m_Job;
+  int                       m_iNumJobs;
+
+  //the next index to be handed out. Workers take indices one at a time
+  //so a slow match does not hold up the others
+  std::atomic<int>          m_iNextJob;
+
+  //incremented for each batch so that workers can tell a new one apart
+  //from a spurious wake up
+  unsigned int              m_iBatch;
+
+  //the number of workers still busy with the current batch
+  int                       m_iNumBusy;
+
+  bool                      m_bShutdown;
+
+  void  WorkerLoop();
+
+  MatchExecutor(const MatchExecutor&);
+  MatchExecutor& operator=(const MatchExecutor&);
+
+public:
+
+  //NumThreads <= 0 creates one worker per hardware thread
+  explicit MatchExecutor(int NumThreads = 0);
+
+  ~MatchExecutor();
+
+  int   NumThreads()const{return (int)m_Workers.size();}
+
+  //calls job(i) for i in [0, NumJobs) spread over the workers and returns
+  //when every call has completed. Jobs must not touch each other's state
+  void  ParallelFor(int NumJobs, const std::function<void(int)>& job);
+
+  //plays NumMatches independent matches with the settings of the given
+  //runner and returns the results in match order
+  std::vector<MatchResult> Play(int NumMatches, const MatchRunner& runner);
+};
+
+
+#endif
@@ -0,0 +1,910 @@
+#include "MatchReplay.h"
+#include "SoccerPitch.h"
+#include "SoccerTeam.h"
+#include "SoccerBall.h"
+#include "Goal.h"
+#include "FieldPlayer.h"
+#include "Goalkeeper.h"
+#include "FieldPlayerStates.h"
+#include "GoalKeeperStates.h"
+#include "TeamStates.h"
+#include "MatchEvents.h"
+#include "Time/SimClock.h"
+#include "constants.h"
+#include "misc/utils.h"
+
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+//the windowed build maps the file with the Win32 API, the headless build
+//with POSIX mmap
+#ifndef HEADLESS
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+//the file starts with "SSRP" and ends with "SSRE"
+static const char ReplayMagic[4]    = {'S','S','R','P'};
+static const char ReplayEndMagic[4] = {'S','S','R','E'};
+
+//version 2 records states by their fixed IDs rather than by name
+static const unsigned int ReplayVersion = 2;
+
+//the size of the header and of the trailer (the footer offset and the end
+//magic)
+static const int ReplayHeaderSize  = 40;
+static const int ReplayTrailerSize = 12;
+
+//the resolution values are quantised to
+static const int PosQuantaPerUnit = 16;
+static const int HeadingSteps     = 4096;
+
+
+//------------------------------------------------------------------------
+//
+//  helpers for writing and reading little endian values and variable
+//  length integers (7 bits per byte, high bit set if more bytes follow)
+//------------------------------------------------------------------------
+static void PutU32(std::vector<unsigned char>& buf, unsigned int val)
+{
+  for (int b=0; b<4; ++b) buf.push_back((unsigned char)(val >> (8*b)));
+}
+
+static void PutU64(std::vector<unsigned char>& buf, unsigned long long val)
+{
+  for (int b=0; b<8; ++b) buf.push_back((unsigned char)(val >> (8*b)));
+}
+
+static void PutF64(std::vector<unsigned char>& buf, double val)
+{
+  unsigned long long bits;
+
+  memcpy(&bits, &val, sizeof(bits));
+
+  PutU64(buf, bits);
+}
+
+static void PutVarint(std::vector<unsigned char>& buf, unsigned int val)
+{
+  while (val >= 0x80)
+  {
+    buf.push_back((unsigned char)(val | 0x80));
+
+    val >>= 7;
+  }
+
+  buf.push_back((unsigned char)val);
+}
+
+//small negative numbers are mapped to small positive ones (zigzag) so they
+//encode in few bytes too
+static void PutSigned(std::vector<unsigned char>& buf, int val)
+{
+  PutVarint(buf, ((unsigned int)val << 1) ^ (unsigned int)(val >> 31));
+}
+
+static unsigned int GetU32(const unsigned char* p)
+{
+  return  (unsigned int)p[0]        | ((unsigned int)p[1] << 8) |
+         ((unsigned int)p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+static unsigned long long GetU64(const unsigned char* p)
+{
+  return (unsigned long long)GetU32(p) |
+        ((unsigned long long)GetU32(p+4) << 32);
+}
+
+static double GetF64(const unsigned char* p)
+{
+  unsigned long long bits = GetU64(p);
+
+  double val;
+
+  memcpy(&val, &bits, sizeof(val));
+
+  return val;
+}
+
+//reads a variable length integer starting at offset, advancing offset.
+//Returns false if it runs past end
+static bool GetVarint(const unsigned char* data,
+                      unsigned long long&  offset,
+                      unsigned long long   end,
+                      unsigned int&        val)
+{
+  val = 0;
+
+  for (int shift=0; shift<35; shift+=7)
+  {
+    if (offset >= end) return false;
+
+    unsigned char byte = data[offset++];
+
+    val |= (unsigned int)(byte & 0x7f) << shift;
+
+    if (!(byte & 0x80)) return true;
+  }
+
+  return false;
+}
+
+static bool GetSigned(const unsigned char* data,
+                      unsigned long long&  offset,
+                      unsigned long long   end,
+                      int&                 val)
+{
+  unsigned int zigzag;
+
+  if (!GetVarint(data, offset, end, zigzag)) return false;
+
+  val = (int)(zigzag >> 1) ^ -(int)(zigzag & 1);
+
+  return true;
+}
+
+
+//------------------------------------------------------------------------
+//
+//  the prediction each value is coded against. Positions are predicted
+//  to carry on at the velocity of the last tick, anything else to stay
+//  the same. Headings wrap around
+//------------------------------------------------------------------------
+static bool isPositionField(int field)
+{
+  if (field == ReplayFrame::ball_x || field == ReplayFrame::ball_y) return true;
+
+  if (field < ReplayFrame::num_pitch_fields) return false;
+
+  int PlayerField = (field - ReplayFrame::num_pitch_fields) % ReplayFrame::num_player_fields;
+
+  return PlayerField == ReplayFrame::player_x || PlayerField == ReplayFrame::player_y;
+}
+
+static bool isHeadingField(int field)
+{
+  if (field < ReplayFrame::num_pitch_fields) return false;
+
+  return (field - ReplayFrame::num_pitch_fields) % ReplayFrame::num_player_fields ==
+          ReplayFrame::player_heading;
+}
+
+static int Predict(int field, const std::vector<int>& prev, const std::vector<int>& PrevPrev)
+{
+  if (isPositionField(field))
+  {
+    return 2 * prev[field] - PrevPrev[field];
+  }
+
+  return prev[field];
+}
+
+//maps a change of heading into [-steps/2, steps/2)
+static int WrapHeading(int delta, int steps)
+{
+  delta %= steps;
+
+  if (delta >= steps/2) delta -= steps;
+  if (delta < -steps/2) delta += steps;
+
+  return delta;
+}
+
+
+//------------------------------------------------------------------------
+//
+//  the states players and teams can be in, looked up by the ID recorded
+//  in the replay
+//------------------------------------------------------------------------
+template <class T>
+static State<T>* FindState(int id, State<T>* const* states, int NumStates)
+{
+  for (int s=0; s<NumStates; ++s)
+  {
+    if (MatchStateID(states[s]) == id) return states[s];
+  }
+
+  return NULL;
+}
+
+static State<FieldPlayer>* FieldPlayerState(int id)
+{
+  static State<FieldPlayer>* const states[] = {GlobalPlayerState::Instance(),
+                                               ChaseBall::Instance(),
+                                               Dribble::Instance(),
+                                               ReturnToHomeRegion::Instance(),
+                                               Wait::Instance(),
+                                               Guard::Instance(),
+                                               KickBall::Instance(),
+                                               ReceiveBall::Instance(),
+                                               SupportAttacker::Instance()};
+
+  return FindState(id, states, sizeof(states)/sizeof(states[0]));
+}
+
+static State<GoalKeeper>* GoalKeeperState(int id)
+{
+  static State<GoalKeeper>* const states[] = {GlobalKeeperState::Instance(),
+                                              TendGoal::Instance(),
+                                              InterceptBall::Instance(),
+                                              ReturnHome::Instance(),
+                                              PutBallBackInPlay::Instance()};
+
+  return FindState(id, states, sizeof(states)/sizeof(states[0]));
+}
+
+static State<SoccerTeam>* TeamState(int id)
+{
+  static State<SoccerTeam>* const states[] = {Attacking::Instance(),
+                                              Defending::Instance(),
+                                              PrepareForKickOff::Instance()};
+
+  return FindState(id, states, sizeof(states)/sizeof(states[0]));
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  ReplayWriter
+//
+///////////////////////////////////////////////////////////////////////////
+
+//------------------------------- ctor -----------------------------------
+//------------------------------------------------------------------------
+ReplayWriter::ReplayWriter(const std::string& filename,
+                           int                KeyframeInterval):m_iKeyframeInterval(KeyframeInterval),
+                                                                m_iNumPlayers(0),
+                                                                m_iNumFrames(0),
+                                                                m_Offset(0)
+{
+  if (m_iKeyframeInterval < 1) m_iKeyframeInterval = 1;
+
+  m_File.open(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+}
+
+//------------------------------- dtor -----------------------------------
+//------------------------------------------------------------------------
+ReplayWriter::~ReplayWriter()
+{
+  Close();
+}
+
+//---------------------------- OnTelegram --------------------------------
+//------------------------------------------------------------------------
+void ReplayWriter::OnTelegram(const Telegram& msg)
+{
+  m_Frame.Telegrams.push_back(msg);
+}
+
+//---------------------------- CaptureFrame ------------------------------
+//------------------------------------------------------------------------
+void ReplayWriter::CaptureFrame(const SoccerPitch* pitch)
+{
+  const PlayerStateStore& players = pitch->PlayerStates();
+
+  m_iNumPlayers = players.NumPlayers();
+
+  m_Frame.Tick = SimTime->GetCurrentTick();
+  m_Frame.Fields.resize(ReplayFrame::num_pitch_fields +
+                        m_iNumPlayers * ReplayFrame::num_player_fields);
+
+  int flags = 0;
+  if (pitch->GameOn())            flags |= ReplayFrame::game_on;
+  if (pitch->GoalKeeperHasBall()) flags |= ReplayFrame::keeper_has_ball;
+
+  const State<SoccerTeam>* RedState  = pitch->RedTeam()->GetFSM()->CurrentState();
+  const State<SoccerTeam>* BlueState = pitch->BlueTeam()->GetFSM()->CurrentState();
+
+  m_Frame.Fields[ReplayFrame::flags]           = flags;
+  m_Frame.Fields[ReplayFrame::red_goal_count]  = pitch->RedGoal()->NumGoalsScored();
+  m_Frame.Fields[ReplayFrame::blue_goal_count] = pitch->BlueGoal()->NumGoalsScored();
+  m_Frame.Fields[ReplayFrame::red_team_state]  = MatchStateID(RedState);
+  m_Frame.Fields[ReplayFrame::blue_team_state] = MatchStateID(BlueState);
+  m_Frame.Fields[ReplayFrame::ball_x] = (int)floor(pitch->Ball()->Pos().x * PosQuantaPerUnit + 0.5);
+  m_Frame.Fields[ReplayFrame::ball_y] = (int)floor(pitch->Ball()->Pos().y * PosQuantaPerUnit + 0.5);
+
+  for (int plyr=0; plyr<m_iNumPlayers; ++plyr)
+  {
+    const PlayerBase* player = players.Player(plyr);
+
+    //the slot of a player that has been removed is recorded as empty
+    if (player == NULL)
+    {
+      for (int f=0; f<ReplayFrame::num_player_fields; ++f)
+      {
+        m_Frame.PlayerField(plyr, f) = 0;
+      }
+
+      m_Frame.PlayerField(plyr, ReplayFrame::player_state) = -1;
+
+      continue;
+    }
+
+    m_Frame.PlayerField(plyr, ReplayFrame::player_x) = (int)floor(player->Pos().x * PosQuantaPerUnit + 0.5);
+    m_Frame.PlayerField(plyr, ReplayFrame::player_y) = (int)floor(player->Pos().y * PosQuantaPerUnit + 0.5);
+
+    double angle = atan2(player->Heading().y, player->Heading().x);
+
+    int heading = (int)floor(angle / TwoPi * HeadingSteps + 0.5) % HeadingSteps;
+
+    if (heading < 0) heading += HeadingSteps;
+
+    m_Frame.PlayerField(plyr, ReplayFrame::player_heading) = heading;
+
+    int state = -1;
+
+    if (player->Role() == FieldConst::goal_keeper)
+    {
+      const State<GoalKeeper>* s = static_cast<const GoalKeeper*>(player)->GetFSM()->CurrentState();
+
+      if (s) state = MatchStateID(s);
+    }
+    else
+    {
+      const State<FieldPlayer>* s = static_cast<const FieldPlayer*>(player)->GetFSM()->CurrentState();
+
+      if (s) state = MatchStateID(s);
+    }
+
+    m_Frame.PlayerField(plyr, ReplayFrame::player_state) = state;
+  }
+}
+
+//---------------------------- WriteHeader -------------------------------
+//------------------------------------------------------------------------
+void ReplayWriter::WriteHeader(long FirstTick)
+{
+  m_Buffer.clear();
+
+  for (int c=0; c<4; ++c) m_Buffer.push_back((unsigned char)ReplayMagic[c]);
+  PutU32(m_Buffer, ReplayVersion);
+  PutU32(m_Buffer, m_iNumPlayers);
+  PutU32(m_Buffer, m_iKeyframeInterval);
+  PutU32(m_Buffer, PosQuantaPerUnit);
+  PutU32(m_Buffer, HeadingSteps);
+  PutF64(m_Buffer, SimTime->SecondsPerTick());
+  PutU64(m_Buffer, (unsigned long long)FirstTick);
+
+  m_File.write((const char*)&m_Buffer[0], m_Buffer.size());
+
+  m_Offset += m_Buffer.size();
+}
+
+//----------------------------- RecordTick -------------------------------
+//------------------------------------------------------------------------
+void ReplayWriter::RecordTick(const SoccerPitch* pitch)
+{
+  if (!isOpen()) return;
+
+  CaptureFrame(pitch);
+
+  if (m_iNumFrames == 0)
+  {
+    WriteHeader(m_Frame.Tick);
+  }
+
+  const int NumFields = (int)m_Frame.Fields.size();
+
+  m_Buffer.clear();
+
+  if (m_iNumFrames % m_iKeyframeInterval == 0)
+  {
+    m_KeyframeFrames.push_back(m_iNumFrames);
+    m_KeyframeOffsets.push_back(m_Offset);
+
+    //the values outright. The prediction for the next frame is that
+    //nothing moves
+    for (int f=0; f<NumFields; ++f)
+    {
+      PutSigned(m_Buffer, m_Frame.Fields[f]);
+    }
+
+    m_PrevPrev = m_Frame.Fields;
+  }
+
+  else
+  {
+    //a bit per value set if it differs from the prediction, followed by
+    //the differences
+    const int NumMaskBytes = (NumFields + 7) / 8;
+
+    m_Buffer.resize(NumMaskBytes, 0);
+
+    for (int f=0; f<NumFields; ++f)
+    {
+      int residual = m_Frame.Fields[f] - Predict(f, m_Prev, m_PrevPrev);
+
+      if (isHeadingField(f)) residual = WrapHeading(residual, HeadingSteps);
+
+      if (residual != 0)
+      {
+        m_Buffer[f/8] |= (unsigned char)(1 << (f%8));
+
+        PutSigned(m_Buffer, residual);
+      }
+    }
+
+    m_PrevPrev = m_Prev;
+  }
+
+  m_Prev = m_Frame.Fields;
+
+  //the telegrams
+  PutVarint(m_Buffer, (unsigned int)m_Frame.Telegrams.size());
+
+  for (unsigned int t=0; t<m_Frame.Telegrams.size(); ++t)
+  {
+    PutSigned(m_Buffer, m_Frame.Telegrams[t].Sender);
+    PutSigned(m_Buffer, m_Frame.Telegrams[t].Receiver);
+    PutSigned(m_Buffer, m_Frame.Telegrams[t].Msg);
+  }
+
+  m_Frame.Telegrams.clear();
+
+  m_File.write((const char*)&m_Buffer[0], m_Buffer.size());
+
+  m_Offset += m_Buffer.size();
+
+  ++m_iNumFrames;
+}
+
+//------------------------------- Close ----------------------------------
+//------------------------------------------------------------------------
+bool ReplayWriter::Close()
+{
+  if (!isOpen()) return false;
+
+  if (m_iNumFrames == 0)
+  {
+    WriteHeader(SimTime->GetCurrentTick());
+  }
+
+  //the index
+  unsigned long long FooterOffset = m_Offset;
+
+  m_Buffer.clear();
+
+  PutU32(m_Buffer, m_iNumFrames);
+  PutU32(m_Buffer, (unsigned int)m_KeyframeFrames.size());
+
+  for (unsigned int k=0; k<m_KeyframeFrames.size(); ++k)
+  {
+    PutU32(m_Buffer, m_KeyframeFrames[k]);
+    PutU64(m_Buffer, m_KeyframeOffsets[k]);
+  }
+
+  PutU64(m_Buffer, FooterOffset);
+  m_Buffer.insert(m_Buffer.end(), ReplayEndMagic, ReplayEndMagic+4);
+
+  m_File.write((const char*)&m_Buffer[0], m_Buffer.size());
+
+  //closing flushes what is left, which may fail too
+  m_File.close();
+
+  return !m_File.fail();
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  ReplayReader
+//
+///////////////////////////////////////////////////////////////////////////
+
+//------------------------------- ctor -----------------------------------
+//------------------------------------------------------------------------
+ReplayReader::ReplayReader():m_pData(NULL),
+                             m_Size(0),
+                             m_hFile(NULL),
+                             m_hMapping(NULL),
+                             m_iNumPlayers(0),
+                             m_iKeyframeInterval(1),
+                             m_iPosQuantaPerUnit(1),
+                             m_iHeadingSteps(1),
+                             m_dSecondsPerTick(0.0),
+                             m_lFirstTick(0),
+                             m_iNumFrames(0),
+                             m_iFrame(-1),
+                             m_NextOffset(0)
+{}
+
+//------------------------------- dtor -----------------------------------
+//------------------------------------------------------------------------
+ReplayReader::~ReplayReader()
+{
+  Close();
+}
+
+//-------------------------------- Open ----------------------------------
+//------------------------------------------------------------------------
+bool ReplayReader::Open(const std::string& filename)
+{
+  Close();
+
+#ifndef HEADLESS
+
+  HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+  if (file == INVALID_HANDLE_VALUE) return false;
+
+  LARGE_INTEGER size;
+
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+  {
+    CloseHandle(file);
+
+    return false;
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+  if (mapping == NULL)
+  {
+    CloseHandle(file);
+
+    return false;
+  }
+
+  m_pData    = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  m_Size     = (unsigned long long)size.QuadPart;
+  m_hFile    = file;
+  m_hMapping = mapping;
+
+#else
+
+  int fd = open(filename.c_str(), O_RDONLY);
+
+  if (fd < 0) return false;
+
+  struct stat info;
+
+  if (fstat(fd, &info) != 0 || info.st_size == 0)
+  {
+    close(fd);
+
+    return false;
+  }
+
+  void* data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  //the mapping stays valid once the file is closed
+  close(fd);
+
+  if (data == MAP_FAILED) return false;
+
+  m_pData = (const unsigned char*)data;
+  m_Size  = (unsigned long long)info.st_size;
+
+#endif
+
+  if (m_pData == NULL || !ReadIndex())
+  {
+    Close();
+
+    return false;
+  }
+
+  return true;
+}
+
+//------------------------------- Close ----------------------------------
+//------------------------------------------------------------------------
+void ReplayReader::Close()
+{
+#ifndef HEADLESS
+
+  if (m_pData)    UnmapViewOfFile(m_pData);
+  if (m_hMapping) CloseHandle((HANDLE)m_hMapping);
+  if (m_hFile)    CloseHandle((HANDLE)m_hFile);
+
+#else
+
+  if (m_pData) munmap((void*)m_pData, (size_t)m_Size);
+
+#endif
+
+  m_pData    = NULL;
+  m_Size     = 0;
+  m_hFile    = NULL;
+  m_hMapping = NULL;
+
+  m_iNumFrames = 0;
+  m_iFrame     = -1;
+
+  m_KeyframeFrames.clear();
+  m_KeyframeOffsets.clear();
+}
+
+//----------------------------- ReadIndex --------------------------------
+//------------------------------------------------------------------------
+bool ReplayReader::ReadIndex()
+{
+  if (m_Size < (unsigned long long)(ReplayHeaderSize + ReplayTrailerSize)) return false;
+
+  //the header
+  if (memcmp(m_pData, ReplayMagic, 4) != 0 ||
+      GetU32(m_pData+4) != ReplayVersion)
+  {
+    return false;
+  }
+
+  m_iNumPlayers       = (int)GetU32(m_pData+8);
+  m_iKeyframeInterval = (int)GetU32(m_pData+12);
+  m_iPosQuantaPerUnit = (int)GetU32(m_pData+16);
+  m_iHeadingSteps     = (int)GetU32(m_pData+20);
+  m_dSecondsPerTick   = GetF64(m_pData+24);
+  m_lFirstTick        = (long)GetU64(m_pData+32);
+
+  //a pitch has two teams of at most MaxTeamSize
+  if (m_iNumPlayers < 0 || m_iNumPlayers > 2 * MaxTeamSize ||
+      m_iKeyframeInterval < 1 || m_iPosQuantaPerUnit < 1 || m_iHeadingSteps < 1)
+  {
+    return false;
+  }
+
+  //the trailer gives the position of the index
+  const unsigned char* trailer = m_pData + m_Size - ReplayTrailerSize;
+
+  if (memcmp(trailer+8, ReplayEndMagic, 4) != 0) return false;
+
+  unsigned long long offset = GetU64(trailer);
+  unsigned long long end    = m_Size - ReplayTrailerSize;
+
+  if (offset < ReplayHeaderSize || offset + 8 > end) return false;
+
+  m_iNumFrames = (int)GetU32(m_pData+offset);
+
+  unsigned int NumKeyframes = GetU32(m_pData+offset+4);
+
+  offset += 8;
+
+  if (offset + NumKeyframes * 12ULL > end) return false;
+
+  for (unsigned int k=0; k<NumKeyframes; ++k)
+  {
+    m_KeyframeFrames.push_back(GetU32(m_pData+offset));
+    m_KeyframeOffsets.push_back(GetU64(m_pData+offset+4));
+
+    offset += 12;
+  }
+
+  //every frame can only be reached if the first is a keyframe
+  if (m_iNumFrames > 0 && (m_KeyframeFrames.empty() || m_KeyframeFrames[0] != 0))
+  {
+    return false;
+  }
+
+  //ready to decode the first frame
+  m_iFrame     = -1;
+  m_NextOffset = ReplayHeaderSize;
+
+  return true;
+}
+
+//----------------------------- DecodeFrame ------------------------------
+//------------------------------------------------------------------------
+bool ReplayReader::DecodeFrame(bool keyframe)
+{
+  const int NumFields = ReplayFrame::num_pitch_fields +
+                        m_iNumPlayers * ReplayFrame::num_player_fields;
+
+  const unsigned long long end = m_Size - ReplayTrailerSize;
+
+  unsigned long long offset = m_NextOffset;
+
+  m_Frame.Fields.resize(NumFields);
+  m_Frame.Telegrams.clear();
+
+  if (keyframe)
+  {
+    for (int f=0; f<NumFields; ++f)
+    {
+      if (!GetSigned(m_pData, offset, end, m_Frame.Fields[f])) return false;
+    }
+
+    m_PrevPrev = m_Frame.Fields;
+  }
+
+  else
+  {
+    const int NumMaskBytes = (NumFields + 7) / 8;
+
+    if (offset + NumMaskBytes > end) return false;
+
+    const unsigned char* mask = m_pData + offset;
+
+    offset += NumMaskBytes;
+
+    for (int f=0; f<NumFields; ++f)
+    {
+      int residual = 0;
+
+      if (mask[f/8] & (1 << (f%8)))
+      {
+        if (!GetSigned(m_pData, offset, end, residual)) return false;
+      }
+
+      int val = Predict(f, m_Prev, m_PrevPrev) + residual;
+
+      if (isHeadingField(f))
+      {
+        val %= m_iHeadingSteps;
+
+        if (val < 0) val += m_iHeadingSteps;
+      }
+
+      m_Frame.Fields[f] = val;
+    }
+
+    m_PrevPrev = m_Prev;
+  }
+
+  m_Prev = m_Frame.Fields;
+
+  //the telegrams
+  unsigned int NumTelegrams;
+
+  if (!GetVarint(m_pData, offset, end, NumTelegrams)) return false;
+
+  for (unsigned int t=0; t<NumTelegrams; ++t)
+  {
+    Telegram telegram;
+
+    if (!GetSigned(m_pData, offset, end, telegram.Sender)   ||
+        !GetSigned(m_pData, offset, end, telegram.Receiver) ||
+        !GetSigned(m_pData, offset, end, telegram.Msg))
+    {
+      return false;
+    }
+
+    telegram.ExtraInfo = NULL;
+
+    m_Frame.Telegrams.push_back(telegram);
+  }
+
+  m_NextOffset = offset;
+
+  return true;
+}
+
+//-------------------------------- Next ----------------------------------
+//------------------------------------------------------------------------
+bool ReplayReader::Next()
+{
+  if (!isOpen() || m_iFrame + 1 >= m_iNumFrames) return false;
+
+  int frame = m_iFrame + 1;
+
+  if (!DecodeFrame(frame % m_iKeyframeInterval == 0))
+  {
+    //back to before the first frame, rather than part way into this one
+    m_iFrame     = -1;
+    m_NextOffset = ReplayHeaderSize;
+
+    return false;
+  }
+
+  m_iFrame     = frame;
+  m_Frame.Tick = m_lFirstTick + frame;
+
+  return true;
+}
+
+//-------------------------------- Seek ----------------------------------
+//------------------------------------------------------------------------
+bool ReplayReader::Seek(int frame)
+{
+  if (!isOpen() || frame < 0 || frame >= m_iNumFrames) return false;
+
+  if (frame == m_iFrame) return true;
+
+  //find the last keyframe at or before the frame
+  int key = (int)(std::upper_bound(m_KeyframeFrames.begin(),
+                                   m_KeyframeFrames.end(),
+                                   (unsigned int)frame) - m_KeyframeFrames.begin()) - 1;
+
+  //decode forward from the current frame if that is no further from the
+  //frame than the keyframe
+  if (m_iFrame < (int)m_KeyframeFrames[key] || m_iFrame > frame)
+  {
+    m_iFrame     = m_KeyframeFrames[key] - 1;
+    m_NextOffset = m_KeyframeOffsets[key];
+  }
+
+  while (m_iFrame < frame)
+  {
+    if (!Next()) return false;
+  }
+
+  return true;
+}
+
+//------------------------------ accessors -------------------------------
+//------------------------------------------------------------------------
+Vector2D ReplayReader::BallPos()const
+{
+  return Vector2D((double)m_Frame.Fields[ReplayFrame::ball_x] / m_iPosQuantaPerUnit,
+                  (double)m_Frame.Fields[ReplayFrame::ball_y] / m_iPosQuantaPerUnit);
+}
+
+Vector2D ReplayReader::PlayerPos(int player)const
+{
+  return Vector2D((double)m_Frame.PlayerField(player, ReplayFrame::player_x) / m_iPosQuantaPerUnit,
+                  (double)m_Frame.PlayerField(player, ReplayFrame::player_y) / m_iPosQuantaPerUnit);
+}
+
+Vector2D ReplayReader::PlayerHeading(int player)const
+{
+  double angle = TwoPi * m_Frame.PlayerField(player, ReplayFrame::player_heading) / m_iHeadingSteps;
+
+  return Vector2D(cos(angle), sin(angle));
+}
+
+//-------------------------------- Apply ---------------------------------
+//------------------------------------------------------------------------
+void ReplayReader::Apply(SoccerPitch* pitch)const
+{
+  if (m_iFrame < 0) return;
+
+  int flags = m_Frame.Fields[ReplayFrame::flags];
+
+  if (flags & ReplayFrame::game_on) pitch->SetGameOn();
+  else                              pitch->SetGameOff();
+
+  pitch->SetGoalKeeperHasBall((flags & ReplayFrame::keeper_has_ball) != 0);
+
+  pitch->RedGoal()->SetNumGoalsScored(m_Frame.Fields[ReplayFrame::red_goal_count]);
+  pitch->BlueGoal()->SetNumGoalsScored(m_Frame.Fields[ReplayFrame::blue_goal_count]);
+
+  State<SoccerTeam>* state;
+
+  state = TeamState(m_Frame.Fields[ReplayFrame::red_team_state]);
+  if (state) pitch->RedTeam()->GetFSM()->SetCurrentState(state);
+
+  state = TeamState(m_Frame.Fields[ReplayFrame::blue_team_state]);
+  if (state) pitch->BlueTeam()->GetFSM()->SetCurrentState(state);
+
+  pitch->Ball()->PlaceAtPosition(BallPos());
+
+  //the players, in the order of their handles
+  PlayerStateStore& players = pitch->PlayerStates();
+
+  int NumPlayers = MinOf(m_iNumPlayers, players.NumPlayers());
+
+  for (int plyr=0; plyr<NumPlayers; ++plyr)
+  {
+    PlayerBase* player = players.Player(plyr);
+
+    int StateID = m_Frame.PlayerField(plyr, ReplayFrame::player_state);
+
+    if (player == NULL || StateID < 0) continue;
+
+    player->SetPos(PlayerPos(plyr));
+    player->SetHeading(PlayerHeading(plyr));
+    player->SetVelocity(Vector2D(0,0));
+
+    if (player->Role() == FieldConst::goal_keeper)
+    {
+      State<GoalKeeper>* s = GoalKeeperState(StateID);
+
+      if (s) static_cast<GoalKeeper*>(player)->GetFSM()->SetCurrentState(s);
+    }
+    else
+    {
+      State<FieldPlayer>* s = FieldPlayerState(StateID);
+
+      if (s) static_cast<FieldPlayer*>(player)->GetFSM()->SetCurrentState(s);
+    }
+
+    player->WriteState();
+  }
+}
@@ -0,0 +1,241 @@
+#ifndef MATCHREPLAY_H
+#define MATCHREPLAY_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   MatchReplay.h
+//
+//  Desc:   recording of a match to a compact binary file and seekable
+//          playback of it.
+//
+//          Every tick a frame is recorded holding the ball and player
+//          positions, the players' headings, the state each player and
+//          team is in, the score and the telegrams delivered during the
+//          tick. States are recorded by their fixed IDs (see
+//          MatchEvent::state_id) so a replay can be played back by a
+//          build from any compiler. Positions are quantised to 1/PosQuantaPerUnit of a unit
+//          and headings to one of HeadingSteps directions. Every
+//          KeyframeInterval ticks a keyframe stores the values outright;
+//          in between only the difference from a prediction made from
+//          the previous frames is stored (a position is predicted to
+//          move as it did last tick), and values matching the prediction
+//          take only a bit. An index of the keyframes is written at the
+//          end of the file so playback can seek to any tick by decoding
+//          forward from the keyframe before it.
+//
+//          ReplayReader memory maps the file and applies the frames to a
+//          SoccerPitch so it can be rendered without running any AI.
+//
+//          All multi byte values are little endian.
+//
+//------------------------------------------------------------------------
+#include <vector>
+#include <string>
+#include <fstream>
+
+#include "2D/Vector2D.h"
+#include "Messaging/Telegram.h"
+#include "Messaging/MessageDispatcher.h"
+
+class SoccerPitch;
+
+
+//the values recorded for one tick
+struct ReplayFrame
+{
+  //the values of the pitch, in the order they are encoded
+  enum pitch_field {flags,
+                    red_goal_count,
+                    blue_goal_count,
+                    red_team_state,
+                    blue_team_state,
+                    ball_x,
+                    ball_y,
+                    num_pitch_fields};
+
+  //followed by these values for each player
+  enum player_field {player_x,
+                     player_y,
+                     player_heading,
+                     player_state,
+                     num_player_fields};
+
+  //the bits of the flags field
+  enum {game_on = 1, keeper_has_ball = 2};
+
+  //the tick of the simulation clock the frame was recorded on
+  long                   Tick;
+
+  //the quantised values
+  std::vector<int>       Fields;
+
+  //the telegrams delivered during the tick. ExtraInfo is not recorded
+  std::vector<Telegram>  Telegrams;
+
+  ReplayFrame():Tick(0){}
+
+  int   NumPlayers()const
+  {
+    return ((int)Fields.size() - num_pitch_fields) / num_player_fields;
+  }
+
+  int&  PlayerField(int player, int field)
+  {
+    return Fields[num_pitch_fields + player * num_player_fields + field];
+  }
+
+  int   PlayerField(int player, int field)const
+  {
+    return Fields[num_pitch_fields + player * num_player_fields + field];
+  }
+};
+
+
+//------------------------------------------------------------------------
+//
+//  records the frames of a match. Attach it to a pitch with
+//  SoccerPitch::SetReplayWriter and a frame is written at the end of each
+//  update. The index is written when the writer is closed or destroyed.
+//------------------------------------------------------------------------
+class ReplayWriter : public TelegramObserver
+{
+private:
+
+  std::ofstream               m_File;
+
+  int                         m_iKeyframeInterval;
+
+  int                         m_iNumPlayers;
+
+  int                         m_iNumFrames;
+
+  //the number of bytes written so far
+  unsigned long long          m_Offset;
+
+  //the values of the previous two frames, from which the next is predicted
+  std::vector<int>            m_Prev;
+  std::vector<int>            m_PrevPrev;
+
+  //the frame being recorded and its encoding
+  ReplayFrame                 m_Frame;
+  std::vector<unsigned char>  m_Buffer;
+
+  //the frame number and file offset of each keyframe
+  std::vector<unsigned int>        m_KeyframeFrames;
+  std::vector<unsigned long long>  m_KeyframeOffsets;
+
+  //fills in m_Frame from the pitch
+  void  CaptureFrame(const SoccerPitch* pitch);
+
+  void  WriteHeader(long FirstTick);
+
+public:
+
+  ReplayWriter(const std::string& filename, int KeyframeInterval = 300);
+
+  ~ReplayWriter();
+
+  bool  isOpen()const{return m_File.is_open();}
+
+  //records the pitch as it is at the end of this tick
+  void  RecordTick(const SoccerPitch* pitch);
+
+  //writes the index and closes the file. Returns false if the file could
+  //not be opened or written
+  bool  Close();
+
+  int   NumFrames()const{return m_iNumFrames;}
+
+  //collects the telegrams delivered during the tick
+  void  OnTelegram(const Telegram& msg);
+};
+
+
+//------------------------------------------------------------------------
+//
+//  plays back a file written by ReplayWriter
+//------------------------------------------------------------------------
+class ReplayReader
+{
+private:
+
+  //the mapped file
+  const unsigned char*        m_pData;
+  unsigned long long          m_Size;
+
+  //platform handles for the mapping
+  void*                       m_hFile;
+  void*                       m_hMapping;
+
+  int                         m_iNumPlayers;
+  int                         m_iKeyframeInterval;
+  int                         m_iPosQuantaPerUnit;
+  int                         m_iHeadingSteps;
+  double                      m_dSecondsPerTick;
+  long                        m_lFirstTick;
+  int                         m_iNumFrames;
+
+  std::vector<unsigned int>        m_KeyframeFrames;
+  std::vector<unsigned long long>  m_KeyframeOffsets;
+
+  //the frame last decoded, its number and where the next one starts
+  ReplayFrame                 m_Frame;
+  int                         m_iFrame;
+  unsigned long long          m_NextOffset;
+
+  std::vector<int>            m_Prev;
+  std::vector<int>            m_PrevPrev;
+
+  bool  ReadIndex();
+
+  //decodes the frame at m_NextOffset into m_Frame
+  bool  DecodeFrame(bool keyframe);
+
+  ReplayReader(const ReplayReader&);
+  ReplayReader& operator=(const ReplayReader&);
+
+public:
+
+  ReplayReader();
+
+  ~ReplayReader();
+
+  //maps the file and reads its index. Returns false if the file cannot
+  //be opened or is not a replay
+  bool  Open(const std::string& filename);
+
+  void  Close();
+
+  bool  isOpen()const{return m_pData != NULL;}
+
+  int   NumFrames()const{return m_iNumFrames;}
+  int   NumPlayers()const{return m_iNumPlayers;}
+  int   NumKeyframes()const{return (int)m_KeyframeFrames.size();}
+  long  FirstTick()const{return m_lFirstTick;}
+  double SecondsPerTick()const{return m_dSecondsPerTick;}
+  unsigned long long SizeInBytes()const{return m_Size;}
+
+  //decodes frame number frame (counted from zero), starting from the
+  //nearest keyframe before it unless it follows the current frame
+  bool  Seek(int frame);
+
+  //decodes the frame after the current one
+  bool  Next();
+
+  //the frame last decoded and its number (-1 if there is none)
+  const ReplayFrame&  Frame()const{return m_Frame;}
+  int                 CurrentFrame()const{return m_iFrame;}
+
+  //the decoded values in pitch units
+  Vector2D  BallPos()const;
+  Vector2D  PlayerPos(int player)const;
+  Vector2D  PlayerHeading(int player)const;
+
+  //moves the ball and players of the pitch to where they were in the
+  //current frame and puts every player and team into the state it was in,
+  //so the pitch can be rendered as it was. No AI is run.
+  void  Apply(SoccerPitch* pitch)const;
+};
+
+
+#endif
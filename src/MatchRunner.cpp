@@ -0,0 +1,522 @@
+#include "MatchRunner.h"
+#include "SoccerPitch.h"
+#include "SoccerTeam.h"
+#include "Goal.h"
+#include "Game/GameWorld.h"
+#include "MatchReplay.h"
+#include "MatchSnapshot.h"
+#include "SoccerBall.h"
+#include "PlayerController.h"
+#include "PlayerBase.h"
+#include "ParamLoader.h"
+
+#include <ostream>
+#include <sstream>
+#include <vector>
+#include <chrono>
+#include <math.h>
+
+
+//------------------------------- Possession ----------------------------------
+//-----------------------------------------------------------------------------
+double MatchResult::RedPossession()const
+{
+  int total = RedPossessionTicks + BluePossessionTicks;
+
+  if (total == 0) return 0.5;
+
+  return (double)RedPossessionTicks / (double)total;
+}
+
+double MatchResult::BluePossession()const
+{
+  int total = RedPossessionTicks + BluePossessionTicks;
+
+  if (total == 0) return 0.5;
+
+  return (double)BluePossessionTicks / (double)total;
+}
+
+
+//------------------------------- ctor ----------------------------------------
+//-----------------------------------------------------------------------------
+MatchRunner::MatchRunner(int TicksPerMatch,
+                         int cxPitch,
+                         int cyPitch):m_iTicksPerMatch(TicksPerMatch),
+                                      m_dTimeStep(1.0),
+                                      m_cxPitch(cxPitch),
+                                      m_cyPitch(cyPitch),
+                                      m_pEvents(NULL),
+                                      m_Seed(0),
+                                      m_pRedConfig(NULL),
+                                      m_pBlueConfig(NULL)
+{}
+
+//----------------------------- MatchSeed -------------------------------------
+//
+//  the runner's seed is scrambled before the match number is added so the
+//  matches of runners with consecutive seeds don't share streams
+//-----------------------------------------------------------------------------
+unsigned long long MatchRunner::MatchSeed(int MatchNumber)const
+{
+  unsigned long long seed = m_Seed;
+
+  return RandomStream::SplitMix64(seed) + (unsigned long long)MatchNumber;
+}
+
+//--------------------------- UpdatesPerMatch ---------------------------------
+//
+//  enough updates to cover the length of the match; the last may overrun
+//  it a little if the time step doesn't divide it
+//-----------------------------------------------------------------------------
+int MatchRunner::UpdatesPerMatch()const
+{
+  return UpdatesIn(m_iTicksPerMatch);
+}
+
+int MatchRunner::UpdatesIn(int ticks)const
+{
+  return (int)ceil(ticks / m_dTimeStep);
+}
+
+//------------------------------- Play ----------------------------------------
+//
+//  every match is played in a world of its own, bound to the calling thread
+//  while the match is in progress, and starts from the kick off positions
+//-----------------------------------------------------------------------------
+MatchResult MatchRunner::Play(int               MatchNumber,
+                              const TeamConfig* RedConfig,
+                              const TeamConfig* BlueConfig)const
+{
+  GameWorld       world;
+  ScopedGameWorld bind(&world);
+
+  //seeded before the pitch is made since its players draw on the stream
+  world.GetRandom()->Seed(MatchSeed(MatchNumber));
+
+  //the replay (if any) records every tick of the match
+  ReplayWriter* replay = NULL;
+
+  if (!m_strReplayDirectory.empty())
+  {
+    replay = new ReplayWriter(ReplayFilename(MatchNumber));
+  }
+
+  //the pitch must be destroyed before the world it lives in
+  SoccerPitch pitch(m_cxPitch,
+                    m_cyPitch,
+                    m_dTimeStep,
+                    RedConfig  ? RedConfig  : m_pRedConfig,
+                    BlueConfig ? BlueConfig : m_pBlueConfig);
+
+  if (replay && replay->isOpen())
+  {
+    pitch.SetReplayWriter(replay);
+  }
+
+  if (m_pEvents)
+  {
+    pitch.Events().Subscribe(m_pEvents);
+
+    MatchEvent start(MatchEvent::match_start);
+
+    start.Other = MatchNumber;
+
+    pitch.Events().Publish(start);
+  }
+
+  MatchResult result;
+
+  const int NumUpdates = UpdatesPerMatch();
+
+  for (int update=0; update<NumUpdates; ++update)
+  {
+    pitch.Update();
+
+    RecordPossession(pitch, result);
+  }
+
+  result.Ticks     = (int)floor(NumUpdates * m_dTimeStep + 0.5);
+
+  //a team scores by putting the ball in the opponent's goal
+  result.RedGoals  = pitch.BlueGoal()->NumGoalsScored();
+  result.BlueGoals = pitch.RedGoal()->NumGoalsScored();
+
+  pitch.SetReplayWriter(NULL);
+
+  if (replay)
+  {
+    result.ReplayFailed = !replay->Close();
+
+    delete replay;
+  }
+
+  if (m_pEvents)
+  {
+    MatchEvent end(MatchEvent::match_end);
+
+    end.Other = MatchNumber;
+
+    pitch.Events().Publish(end);
+
+    pitch.Events().Unsubscribe(m_pEvents);
+  }
+
+  return result;
+}
+
+//------------------------------- PlayOn --------------------------------------
+//
+//  updates the pitch NumUpdates times and records whether each team scored
+//-----------------------------------------------------------------------------
+static void PlayOn(SoccerPitch& pitch,
+                   int          NumUpdates,
+                   bool&        RedScored,
+                   bool&        BlueScored)
+{
+  int RedGoals  = pitch.BlueGoal()->NumGoalsScored();
+  int BlueGoals = pitch.RedGoal()->NumGoalsScored();
+
+  for (int update=0; update<NumUpdates; ++update)
+  {
+    pitch.Update();
+  }
+
+  RedScored  = pitch.BlueGoal()->NumGoalsScored() > RedGoals;
+  BlueScored = pitch.RedGoal()->NumGoalsScored()  > BlueGoals;
+}
+
+//----------------------------- RecordPlay ------------------------------------
+//
+//  records the position and velocity of the ball and of every player.
+//  SamePlay is true if they are all as recorded
+//-----------------------------------------------------------------------------
+static void RecordPlay(const SoccerPitch& pitch, std::vector<Vector2D>& record)
+{
+  const PlayerStateStore& store = pitch.PlayerStates();
+
+  record.clear();
+
+  record.push_back(pitch.Ball()->Pos());
+  record.push_back(pitch.Ball()->Velocity());
+
+  for (int handle=0; handle<store.NumPlayers(); ++handle)
+  {
+    record.push_back(store.Pos(handle));
+    record.push_back(store.Velocity(handle));
+  }
+}
+
+static bool SamePlay(const SoccerPitch& pitch, const std::vector<Vector2D>& record)
+{
+  std::vector<Vector2D> now;
+
+  RecordPlay(pitch, now);
+
+  if (now.size() != record.size()) return false;
+
+  //exactly, not to within the tolerance of Vector2D's ==
+  for (unsigned int i=0; i<now.size(); ++i)
+  {
+    if (now[i] != record[i]) return false;
+  }
+
+  return true;
+}
+
+//-------------------------------- Fork ---------------------------------------
+//-----------------------------------------------------------------------------
+ForkResult MatchRunner::Fork(int MatchNumber,
+                             int ForkTick,
+                             int NumForks,
+                             int LookaheadTicks)const
+{
+  GameWorld       world;
+  ScopedGameWorld bind(&world);
+
+  world.GetRandom()->Seed(MatchSeed(MatchNumber));
+
+  SoccerPitch pitch(m_cxPitch, m_cyPitch, m_dTimeStep, m_pRedConfig, m_pBlueConfig);
+
+  const int NumUpdates = UpdatesIn(ForkTick);
+
+  for (int update=0; update<NumUpdates; ++update)
+  {
+    pitch.Update();
+  }
+
+  MatchSnapshot snapshot;
+
+  snapshot.Take(pitch);
+
+  const int LookaheadUpdates = UpdatesIn(LookaheadTicks);
+
+  //the match as it plays out without being forked, for the first fork to
+  //be checked against
+  bool RedScored, BlueScored;
+
+  PlayOn(pitch, LookaheadUpdates, RedScored, BlueScored);
+
+  std::vector<Vector2D> unforked;
+
+  RecordPlay(pitch, unforked);
+
+  ForkResult result;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  for (int fork=0; fork<NumForks; ++fork)
+  {
+    snapshot.Restore(pitch);
+
+    if (fork > 0)
+    {
+      unsigned long long seed = MatchSeed(MatchNumber) + (unsigned long long)fork;
+
+      world.GetRandom()->Seed(RandomStream::SplitMix64(seed));
+    }
+
+    PlayOn(pitch, LookaheadUpdates, RedScored, BlueScored);
+
+    if (fork == 0) result.Reproduced = SamePlay(pitch, unforked);
+
+    if (RedScored)  ++result.RedScored;
+    if (BlueScored) ++result.BlueScored;
+
+    ++result.NumForks;
+  }
+
+  result.Seconds = std::chrono::duration<double>(
+                          std::chrono::steady_clock::now() - start).count();
+
+  return result;
+}
+
+//---------------------------- RandomPolicy -----------------------------------
+//
+//  a policy acting at random, from a stream of its own so that it doesn't
+//  draw on the world's
+//-----------------------------------------------------------------------------
+class RandomPolicy : public BatchPolicy
+{
+private:
+
+  RandomStream  m_Random;
+
+public:
+
+  explicit RandomPolicy(unsigned long long seed):m_Random(seed){}
+
+  void  Act(const TeamObserver& observer,
+            const float*        /*observation*/,
+            float*              actions)
+  {
+    for (int a=0; a<observer.ActionSize(); ++a)
+    {
+      actions[a] = (float)(m_Random.RandFloat() * 2.0 - 1.0);
+    }
+  }
+};
+
+//---------------------------- ReplayActions ----------------------------------
+//-----------------------------------------------------------------------------
+ActionReplayResult MatchRunner::ReplayActions(int                MatchNumber,
+                                              const std::string& filename)const
+{
+  ActionReplayResult result;
+
+  const int NumUpdates = UpdatesPerMatch();
+
+  std::vector<Vector2D> recorded;
+
+  {
+    GameWorld       world;
+    ScopedGameWorld bind(&world);
+
+    world.GetRandom()->Seed(MatchSeed(MatchNumber));
+
+    SoccerPitch pitch(m_cxPitch, m_cyPitch, m_dTimeStep, m_pRedConfig, m_pBlueConfig);
+
+    unsigned long long seed = MatchSeed(MatchNumber);
+
+    RandomPolicy policy(RandomStream::SplitMix64(seed));
+
+    //the controller must leave the pitch before the pitch is destroyed
+    BatchPolicyController controller(pitch.RedTeam(), &policy, m_iTicksPerMatch);
+
+    ActionStream stream(controller.NumPlayers());
+
+    controller.SetRecording(&stream);
+
+    for (int update=0; update<NumUpdates; ++update)
+    {
+      pitch.Update();
+    }
+
+    RecordPlay(pitch, recorded);
+
+    result.NumFrames = stream.NumFrames();
+    result.RedGoals  = pitch.BlueGoal()->NumGoalsScored();
+    result.BlueGoals = pitch.RedGoal()->NumGoalsScored();
+
+    if (!stream.Save(filename)) return result;
+  }
+
+  ActionStream stream;
+
+  if (!stream.Load(filename)) return result;
+
+  result.Saved = true;
+
+  GameWorld       world;
+  ScopedGameWorld bind(&world);
+
+  world.GetRandom()->Seed(MatchSeed(MatchNumber));
+
+  SoccerPitch pitch(m_cxPitch, m_cyPitch, m_dTimeStep, m_pRedConfig, m_pBlueConfig);
+
+  ReplayController controller(&pitch, &stream);
+
+  controller.AddTeam(pitch.RedTeam());
+
+  for (int update=0; update<NumUpdates; ++update)
+  {
+    pitch.Update();
+  }
+
+  result.Reproduced = SamePlay(pitch, recorded);
+
+  return result;
+}
+
+//--------------------------- CheckPassSafety ---------------------------------
+//-----------------------------------------------------------------------------
+PassCheckResult MatchRunner::CheckPassSafety(int MatchNumber,
+                                             int PassesPerUpdate)const
+{
+  PassCheckResult result;
+
+  GameWorld       world;
+  ScopedGameWorld bind(&world);
+
+  world.GetRandom()->Seed(MatchSeed(MatchNumber));
+
+  SoccerPitch pitch(m_cxPitch, m_cyPitch, m_dTimeStep, m_pRedConfig, m_pBlueConfig);
+
+  unsigned long long seed = MatchSeed(MatchNumber);
+
+  RandomStream random(RandomStream::SplitMix64(seed));
+
+  const Region* area = pitch.PlayingArea();
+
+  std::vector<PassQuery>          passes(PassesPerUpdate);
+  std::vector<const PlayerBase*>  receivers(PassesPerUpdate);
+  std::vector<char>               verdicts(PassesPerUpdate);
+
+  SoccerTeam* teams[2] = {pitch.RedTeam(), pitch.BlueTeam()};
+
+  const int NumUpdates = UpdatesPerMatch();
+
+  for (int update=0; update<NumUpdates; ++update)
+  {
+    pitch.Update();
+
+    for (int t=0; t<2; ++t)
+    {
+      const std::vector<PlayerBase*>& members   = teams[t]->Members();
+      const std::vector<PlayerBase*>& opponents = teams[t]->Opponents()->Members();
+
+      //passes from and to anywhere on the pitch, with and without a
+      //receiver and with any force, so every branch of the test is taken
+      for (int p=0; p<PassesPerUpdate; ++p)
+      {
+        Vector2D from(area->Left() + random.RandFloat() * area->Width(),
+                      area->Top()  + random.RandFloat() * area->Height());
+
+        Vector2D target(area->Left() + random.RandFloat() * area->Width(),
+                        area->Top()  + random.RandFloat() * area->Height());
+
+        int receiver = random.RandInt(0, (int)members.size());
+
+        receivers[p] = receiver < (int)members.size() ? members[receiver] : NULL;
+
+        passes[p] = PassQuery(from,
+                              target,
+                              receivers[p],
+                              random.RandFloat() * Prm.MaxPassingForce);
+      }
+
+      teams[t]->ArePassesSafeFromAllOpponents(&passes[0], PassesPerUpdate, &verdicts[0]);
+
+      for (int p=0; p<PassesPerUpdate; ++p)
+      {
+        bool safe = true;
+
+        for (unsigned int opp=0; opp<opponents.size(); ++opp)
+        {
+          if (!teams[t]->isPassSafeFromOpponent(passes[p].From,
+                                                passes[p].Target,
+                                                receivers[p],
+                                                opponents[opp],
+                                                passes[p].PassingForce))
+          {
+            safe = false;
+          }
+        }
+
+        ++result.NumPasses;
+
+        if (verdicts[p]) ++result.NumSafe;
+
+        if (safe != (verdicts[p] != 0)) ++result.NumMismatches;
+      }
+    }
+  }
+
+  return result;
+}
+
+//--------------------------- ReplayFilename ----------------------------------
+//-----------------------------------------------------------------------------
+std::string MatchRunner::ReplayFilename(int MatchNumber)const
+{
+  std::ostringstream name;
+
+  name << m_strReplayDirectory << "/match_" << MatchNumber << ".ssr";
+
+  return name.str();
+}
+
+//--------------------------- RecordPossession --------------------------------
+//-----------------------------------------------------------------------------
+void MatchRunner::RecordPossession(const SoccerPitch& pitch,
+                                   MatchResult&       result)const
+{
+  if (pitch.RedTeam()->InControl())
+  {
+    ++result.RedPossessionTicks;
+  }
+
+  else if (pitch.BlueTeam()->InControl())
+  {
+    ++result.BluePossessionTicks;
+  }
+}
+
+
+//----------------------------- WriteMatchResult ------------------------------
+//-----------------------------------------------------------------------------
+void WriteMatchResultHeader(std::ostream& os)
+{
+  os << "match,ticks,red_goals,blue_goals,red_possession,blue_possession\n";
+}
+
+void WriteMatchResult(std::ostream& os, int match, const MatchResult& result)
+{
+  os << match                   << ","
+     << result.Ticks            << ","
+     << result.RedGoals         << ","
+     << result.BlueGoals        << ","
+     << result.RedPossession()  << ","
+     << result.BluePossession() << "\n";
+}
@@ -0,0 +1,265 @@
+#ifndef MATCHRUNNER_H
+#define MATCHRUNNER_H
+//------------------------------------------------------------------------
+//
+//  Name:   MatchRunner.h
+//
+//  Desc:   Drives a SoccerPitch without a window. Each call to Play
+//          creates a fresh world and pitch, updates it for a fixed number
+//          of ticks as fast as the CPU allows and returns a summary of
+//          the result. Because every match has its own GameWorld, one
+//          runner per thread may be used to play matches concurrently.
+//
+//          Each world's random stream is seeded from the runner's seed and
+//          the match number, so a match plays out the same every time it
+//          is run with the same seed, whichever thread plays it.
+//
+//          The length of a match is given in ticks at Prm.FrameRate. With
+//          a time step of more than one tick the match is played in fewer,
+//          longer updates.
+//
+//------------------------------------------------------------------------
+#include <iosfwd>
+#include <string>
+#include <cassert>
+
+#include "MatchEvents.h"
+#include "constants.h"
+
+class SoccerPitch;
+class TeamConfig;
+
+
+//the outcome of one simulated match
+struct MatchResult
+{
+  //the number of ticks the match ran for. With a time step of more than
+  //a tick the last update may take it a little past the match's length
+  int  Ticks;
+
+  int  RedGoals;
+  int  BlueGoals;
+
+  //the number of updates each team had a controlling player
+  int  RedPossessionTicks;
+  int  BluePossessionTicks;
+
+  //true if a replay of the match was to be recorded but could not be
+  //written
+  bool ReplayFailed;
+
+  MatchResult():Ticks(0),
+                RedGoals(0),
+                BlueGoals(0),
+                RedPossessionTicks(0),
+                BluePossessionTicks(0),
+                ReplayFailed(false)
+  {}
+
+  //possession as a fraction of the ticks either team was in control
+  double RedPossession()const;
+  double BluePossession()const;
+};
+
+
+//what became of the forks of a match (see MatchRunner::Fork)
+struct ForkResult
+{
+  int  NumForks;
+
+  //the number of forks in which each team scored at least once
+  int  RedScored;
+  int  BlueScored;
+
+  //true if the first fork, which keeps the match's own random stream,
+  //played out exactly as the match did when it wasn't forked
+  bool Reproduced;
+
+  //the wall clock time the forks took, restoring and playing on
+  double Seconds;
+
+  ForkResult():NumForks(0),
+               RedScored(0),
+               BlueScored(0),
+               Reproduced(false),
+               Seconds(0.0)
+  {}
+};
+
+
+//what became of a match recorded and played back (see
+//MatchRunner::ReplayActions)
+struct ActionReplayResult
+{
+  //the number of updates recorded
+  int  NumFrames;
+
+  //the score of the recorded match
+  int  RedGoals;
+  int  BlueGoals;
+
+  //false if the recording could not be written to or read back from its
+  //file, in which case it was not played back
+  bool Saved;
+
+  //true if the playback ended exactly as the recorded match did
+  bool Reproduced;
+
+  ActionReplayResult():NumFrames(0),
+                       RedGoals(0),
+                       BlueGoals(0),
+                       Saved(false),
+                       Reproduced(false)
+  {}
+};
+
+
+//how the pass safety kernel's verdicts compared with the scalar test (see
+//MatchRunner::CheckPassSafety)
+struct PassCheckResult
+{
+  int  NumPasses;
+
+  //the number of passes the kernel found safe
+  int  NumSafe;
+
+  //the number of passes the kernel and the scalar test disagreed on
+  int  NumMismatches;
+
+  PassCheckResult():NumPasses(0),
+                    NumSafe(0),
+                    NumMismatches(0)
+  {}
+};
+
+
+class MatchRunner
+{
+private:
+
+  //how many ticks make up a match
+  int           m_iTicksPerMatch;
+
+  //how many ticks each update moves the match on by
+  double        m_dTimeStep;
+
+  //these are handed to the SoccerPitch ctor as the size of the playing
+  //area (there is no client window to take them from)
+  int           m_cxPitch;
+  int           m_cyPitch;
+
+  //if not empty a replay of each match is written to this directory
+  std::string   m_strReplayDirectory;
+
+  //if set, the events of every match are published to this. Not owned
+  MatchEventRing*     m_pEvents;
+
+  //the seeds of the matches' random streams are derived from this
+  unsigned long long  m_Seed;
+
+  //the teams played when Play is not given any. NULL plays the default
+  //team of the colour
+  const TeamConfig*   m_pRedConfig;
+  const TeamConfig*   m_pBlueConfig;
+
+  //tallies the possession of the pitch's teams after an update
+  void          RecordPossession(const SoccerPitch& pitch,
+                                 MatchResult&       result)const;
+
+  //the number of updates that cover the given number of ticks
+  int           UpdatesIn(int ticks)const;
+
+public:
+
+  MatchRunner(int TicksPerMatch, int cxPitch, int cyPitch);
+
+  //plays a complete match on a new pitch and returns the result. The
+  //match number names its replay file, if replays are being recorded.
+  //Teams with no config play as set by SetTeams
+  MatchResult  Play(int               MatchNumber = 0,
+                    const TeamConfig* RedConfig   = NULL,
+                    const TeamConfig* BlueConfig  = NULL)const;
+
+  //plays a match to ForkTick, takes a snapshot of it (see MatchSnapshot.h)
+  //and plays it on for LookaheadTicks NumForks times over, each fork
+  //restored from the snapshot. The first fork keeps the match's random
+  //stream; the rest are reseeded, so they show what else might have
+  //happened. The matches are played between the teams set by SetTeams
+  ForkResult   Fork(int MatchNumber,
+                    int ForkTick,
+                    int NumForks,
+                    int LookaheadTicks)const;
+
+  //plays a match with the red team taking random actions chosen by a
+  //BatchPolicy, recording them to an ActionStream saved to filename (see
+  //PlayerController.h). Then loads the stream and plays the match again
+  //on a new pitch, the red team's actions played back by a
+  //ReplayController. The matches are played between the teams set by
+  //SetTeams
+  ActionReplayResult ReplayActions(int                MatchNumber,
+                                   const std::string& filename)const;
+
+  //plays a match and after every update tests PassesPerUpdate random
+  //passes for each team with the pass safety kernel (see
+  //PassSafetyKernel.h), and again opponent by opponent with
+  //SoccerTeam::isPassSafeFromOpponent, counting any disagreements. The
+  //passes are drawn from a stream of their own, so the match plays out as
+  //Play would play it
+  PassCheckResult CheckPassSafety(int MatchNumber, int PassesPerUpdate)const;
+
+  //records a replay of every match played from now on to
+  //directory/match_<number>.ssr. An empty directory turns recording off.
+  //A match whose replay cannot be written is still played, with
+  //MatchResult::ReplayFailed set
+  void         SetReplayDirectory(const std::string& directory){m_strReplayDirectory = directory;}
+
+  //publishes the events of every match played from now on to the ring
+  //(NULL to stop), between a match_start and a match_end event carrying
+  //the match number. The ring has a single producer so the runner must
+  //then play one match at a time
+  void         SetEventRing(MatchEventRing* ring){m_pEvents = ring;}
+
+  //the teams to play from now on. The configs must outlive the runner
+  void         SetTeams(const TeamConfig* red, const TeamConfig* blue)
+  {
+    m_pRedConfig  = red;
+    m_pBlueConfig = blue;
+  }
+
+  void         SetSeed(unsigned long long seed){m_Seed = seed;}
+  unsigned long long Seed()const{return m_Seed;}
+
+  //the seed of the random stream of a match
+  unsigned long long MatchSeed(int MatchNumber)const;
+
+  //the name of the replay file of a match
+  std::string  ReplayFilename(int MatchNumber)const;
+
+  //plays matches in updates of TimeStep ticks from now on. The step must
+  //be more than 0 and no more than MaxTimeStep
+  void         SetTimeStep(double TimeStep)
+  {
+    assert (TimeStep > 0.0 && TimeStep <= MaxTimeStep &&
+            "<MatchRunner::SetTimeStep>: time step out of range");
+
+    m_dTimeStep = TimeStep;
+  }
+  double       TimeStep()const{return m_dTimeStep;}
+
+  //the number of updates a match is played in
+  int          UpdatesPerMatch()const;
+
+  int          TicksPerMatch()const{return m_iTicksPerMatch;}
+  int          cxPitch()const{return m_cxPitch;}
+  int          cyPitch()const{return m_cyPitch;}
+};
+
+
+//writes the column names for the rows written by WriteMatchResult
+void WriteMatchResultHeader(std::ostream& os);
+
+//writes a result as a comma separated row prefixed by the match number
+void WriteMatchResult(std::ostream& os, int match, const MatchResult& result);
+
+
+#endif
@@ -0,0 +1,298 @@
+#include "MatchSnapshot.h"
+#include "SoccerPitch.h"
+#include "SoccerTeam.h"
+#include "SoccerBall.h"
+#include "FieldPlayer.h"
+#include "Goalkeeper.h"
+#include "SteeringBehaviors.h"
+#include "Goal.h"
+#include "Time/Regulator.h"
+#include "Game/GameWorld.h"
+
+#include <cassert>
+
+
+//----------------------------- helpers ---------------------------------------
+//-----------------------------------------------------------------------------
+static int HandleOf(const PlayerBase* player)
+{
+  return player ? player->StateHandle() : -1;
+}
+
+static PlayerBase* PlayerFromHandle(const SoccerPitch& pitch, int handle)
+{
+  return handle < 0 ? NULL : pitch.PlayerStates().Player(handle);
+}
+
+
+//---------------------------- SaveEntity -------------------------------------
+//-----------------------------------------------------------------------------
+void MatchSnapshot::SaveEntity(const MovingEntity* entity, SavedEntity& saved)
+{
+  saved.Pos         = entity->Pos();
+  saved.Velocity    = entity->Velocity();
+  saved.Heading     = entity->Heading();
+  saved.MaxSpeed    = entity->MaxSpeed();
+  saved.MaxForce    = entity->MaxForce();
+  saved.MaxTurnRate = entity->MaxTurnRate();
+}
+
+void MatchSnapshot::RestoreEntity(const SavedEntity& saved, MovingEntity* entity)
+{
+  entity->SetPos(saved.Pos);
+  entity->SetVelocity(saved.Velocity);
+  entity->SetHeading(saved.Heading);
+  entity->SetMaxSpeed(saved.MaxSpeed);
+  entity->SetMaxForce(saved.MaxForce);
+  entity->SetMaxTurnRate(saved.MaxTurnRate);
+}
+
+//---------------------------- SavePlayer -------------------------------------
+//-----------------------------------------------------------------------------
+void MatchSnapshot::SavePlayer(const PlayerBase* player, SavedPlayer& saved)
+{
+  SaveEntity(player, saved.Body);
+
+  saved.HomeRegion     = player->m_iHomeRegion;
+  saved.DefaultRegion  = player->m_iDefaultRegion;
+  saved.GuardRegionMin = player->m_iGuardRegionMin;
+  saved.GuardRegionMax = player->m_iGuardRegionMax;
+
+  const SteeringBehaviors* steering = player->m_pSteering;
+
+  saved.SteeringFlags = steering->m_iFlags;
+  saved.Target        = steering->m_vTarget;
+  saved.SteeringForce = steering->m_vSteeringForce;
+  saved.InterposeDist = steering->m_dInterposeDist;
+  saved.TimeStep      = steering->m_dTimeStep;
+  saved.VelocityGain  = steering->m_dVelocityGain;
+
+  if (player->Role() == FieldConst::goal_keeper)
+  {
+    const StateMachine<GoalKeeper>* fsm = static_cast<const GoalKeeper*>(player)->GetFSM();
+
+    saved.KeeperStates[0] = fsm->CurrentState();
+    saved.KeeperStates[1] = fsm->PreviousState();
+    saved.KeeperStates[2] = fsm->GlobalState();
+
+    saved.LookAt = static_cast<const GoalKeeper*>(player)->LookAt();
+  }
+  else
+  {
+    const FieldPlayer* fp = static_cast<const FieldPlayer*>(player);
+
+    const StateMachine<FieldPlayer>* fsm = fp->GetFSM();
+
+    saved.FieldStates[0] = fsm->CurrentState();
+    saved.FieldStates[1] = fsm->PreviousState();
+    saved.FieldStates[2] = fsm->GlobalState();
+
+    saved.NextKickTime = fp->m_pKickLimiter->NextUpdateTime();
+    saved.CurrentState = fp->m_curstate;
+  }
+}
+
+void MatchSnapshot::RestorePlayer(const SavedPlayer& saved, PlayerBase* player)
+{
+  RestoreEntity(saved.Body, player);
+
+  player->m_iHomeRegion     = saved.HomeRegion;
+  player->m_iDefaultRegion  = saved.DefaultRegion;
+  player->m_iGuardRegionMin = saved.GuardRegionMin;
+  player->m_iGuardRegionMax = saved.GuardRegionMax;
+
+  SteeringBehaviors* steering = player->m_pSteering;
+
+  steering->m_iFlags         = saved.SteeringFlags;
+  steering->m_vTarget        = saved.Target;
+  steering->m_vSteeringForce = saved.SteeringForce;
+  steering->m_dInterposeDist = saved.InterposeDist;
+  steering->m_dTimeStep      = saved.TimeStep;
+  steering->m_dVelocityGain  = saved.VelocityGain;
+
+  if (player->Role() == FieldConst::goal_keeper)
+  {
+    GoalKeeper* keeper = static_cast<GoalKeeper*>(player);
+
+    keeper->GetFSM()->SetCurrentState(saved.KeeperStates[0]);
+    keeper->GetFSM()->SetPreviousState(saved.KeeperStates[1]);
+    keeper->GetFSM()->SetGlobalState(saved.KeeperStates[2]);
+
+    keeper->SetLookAt(saved.LookAt);
+  }
+  else
+  {
+    FieldPlayer* fp = static_cast<FieldPlayer*>(player);
+
+    fp->GetFSM()->SetCurrentState(saved.FieldStates[0]);
+    fp->GetFSM()->SetPreviousState(saved.FieldStates[1]);
+    fp->GetFSM()->SetGlobalState(saved.FieldStates[2]);
+
+    fp->m_pKickLimiter->SetNextUpdateTime(saved.NextKickTime);
+    fp->m_curstate = (FieldPlayer::player_state)saved.CurrentState;
+  }
+}
+
+//----------------------------- SaveTeam --------------------------------------
+//
+//  the best support spot is kept as its index into the spots
+//-----------------------------------------------------------------------------
+void MatchSnapshot::SaveTeam(const SoccerTeam* team, SavedTeam& saved)
+{
+  saved.States[0] = team->GetFSM()->CurrentState();
+  saved.States[1] = team->GetFSM()->PreviousState();
+  saved.States[2] = team->GetFSM()->GlobalState();
+
+  saved.ControllingPlayer   = HandleOf(team->m_pControllingPlayer);
+  saved.SupportingPlayer    = HandleOf(team->m_pSupportingPlayer);
+  saved.ReceivingPlayer     = HandleOf(team->m_pReceivingPlayer);
+  saved.PlayerClosestToBall = HandleOf(team->m_pPlayerClosestToBall);
+
+  const SupportSpotCalculator* calc = team->m_pSupportSpotCalc;
+
+  saved.Spots               = calc->m_Spots;
+  saved.BestSpot            = calc->m_pBestSupportingSpot ?
+                              (int)(calc->m_pBestSupportingSpot - &calc->m_Spots[0]) : -1;
+  saved.TermsAreValid       = calc->m_bTermsAreValid;
+  saved.PassFrom            = calc->m_vPassFrom;
+  saved.HadSupportingPlayer = calc->m_bHadSupportingPlayer;
+  saved.OpponentPos         = calc->m_OpponentPos;
+  saved.OpponentMaxSpeed    = calc->m_OpponentMaxSpeed;
+  saved.NextSpotUpdateTime  = calc->m_pRegulator->NextUpdateTime();
+}
+
+void MatchSnapshot::RestoreTeam(const SavedTeam& saved, SoccerTeam* team)
+{
+  team->GetFSM()->SetCurrentState(saved.States[0]);
+  team->GetFSM()->SetPreviousState(saved.States[1]);
+  team->GetFSM()->SetGlobalState(saved.States[2]);
+
+  const SoccerPitch& pitch = *team->Pitch();
+
+  team->m_pControllingPlayer   = PlayerFromHandle(pitch, saved.ControllingPlayer);
+  team->m_pSupportingPlayer    = PlayerFromHandle(pitch, saved.SupportingPlayer);
+  team->m_pReceivingPlayer     = PlayerFromHandle(pitch, saved.ReceivingPlayer);
+  team->m_pPlayerClosestToBall = PlayerFromHandle(pitch, saved.PlayerClosestToBall);
+
+  SupportSpotCalculator* calc = team->m_pSupportSpotCalc;
+
+  assert (calc->m_Spots.size() == saved.Spots.size() &&
+          "<MatchSnapshot::RestoreTeam>: the team was made differently");
+
+  calc->m_Spots                = saved.Spots;
+  calc->m_pBestSupportingSpot  = saved.BestSpot < 0 ? NULL : &calc->m_Spots[saved.BestSpot];
+  calc->m_bTermsAreValid       = saved.TermsAreValid;
+  calc->m_vPassFrom            = saved.PassFrom;
+  calc->m_bHadSupportingPlayer = saved.HadSupportingPlayer;
+  calc->m_OpponentPos          = saved.OpponentPos;
+  calc->m_OpponentMaxSpeed     = saved.OpponentMaxSpeed;
+  calc->m_pRegulator->SetNextUpdateTime(saved.NextSpotUpdateTime);
+}
+
+
+//-------------------------------- Take ---------------------------------------
+//-----------------------------------------------------------------------------
+void MatchSnapshot::Take(const SoccerPitch& pitch)
+{
+  GameWorld* world = GameWorld::Current();
+
+  m_lTick           = SimTime->GetCurrentTick();
+  m_Random          = *world->GetRandom();
+  m_PendingMessages = Dispatcher->PendingMessages();
+
+  const SoccerBall* ball = pitch.Ball();
+
+  SaveEntity(ball, m_Ball);
+
+  m_vBallOldPos = ball->m_vOldPos;
+  m_BallPath    = ball->m_Path;
+  m_bBallKicked = ball->m_bKicked;
+
+  const PlayerStateStore& store = pitch.PlayerStates();
+
+  m_Players.resize(store.NumPlayers());
+
+  for (int handle=0; handle<store.NumPlayers(); ++handle)
+  {
+    if (store.Flags(handle) & PlayerStateStore::active)
+    {
+      SavePlayer(store.Player(handle), m_Players[handle]);
+    }
+  }
+
+  SaveTeam(pitch.RedTeam(),  m_Teams[0]);
+  SaveTeam(pitch.BlueTeam(), m_Teams[1]);
+
+  m_iRedGoalCount      = pitch.RedGoal()->NumGoalsScored();
+  m_iBlueGoalCount     = pitch.BlueGoal()->NumGoalsScored();
+  m_bGoalKeeperHasBall = pitch.GoalKeeperHasBall();
+  m_bGameOn            = pitch.GameOn();
+  m_iBallRegion        = pitch.m_iBallRegion;
+  m_vBallRegionPos     = pitch.m_vBallRegionPos;
+
+  m_PlayerStates = store;
+
+  m_bTaken = true;
+}
+
+//------------------------------- Restore -------------------------------------
+//-----------------------------------------------------------------------------
+void MatchSnapshot::Restore(SoccerPitch& pitch)const
+{
+  assert (m_bTaken && "<MatchSnapshot::Restore>: nothing has been taken");
+
+  PlayerStateStore& store = pitch.m_PlayerStates;
+
+  assert (store.NumPlayers() == (int)m_Players.size() &&
+          "<MatchSnapshot::Restore>: the pitch was made differently");
+
+  GameWorld* world = GameWorld::Current();
+
+  SimTime->SetCurrentTick(m_lTick);
+  *world->GetRandom() = m_Random;
+  Dispatcher->SetPendingMessages(m_PendingMessages);
+
+  SoccerBall* ball = pitch.Ball();
+
+  RestoreEntity(m_Ball, ball);
+
+  ball->m_vOldPos = m_vBallOldPos;
+  ball->m_Path    = m_BallPath;
+  ball->m_bKicked = m_bBallKicked;
+
+  for (int handle=0; handle<store.NumPlayers(); ++handle)
+  {
+    if (store.Flags(handle) & PlayerStateStore::active)
+    {
+      RestorePlayer(m_Players[handle], store.Player(handle));
+    }
+  }
+
+  RestoreTeam(m_Teams[0], pitch.RedTeam());
+  RestoreTeam(m_Teams[1], pitch.BlueTeam());
+
+  pitch.RedGoal()->SetNumGoalsScored(m_iRedGoalCount);
+  pitch.BlueGoal()->SetNumGoalsScored(m_iBlueGoalCount);
+
+  pitch.m_bGoalKeeperHasBall = m_bGoalKeeperHasBall;
+  pitch.m_bGameOn            = m_bGameOn;
+  pitch.m_iBallRegion        = m_iBallRegion;
+  pitch.m_vBallRegionPos     = m_vBallRegionPos;
+
+  //everything but the pointers to the players, which belong to the pitch
+  store.m_PosX         = m_PlayerStates.m_PosX;
+  store.m_PosY         = m_PlayerStates.m_PosY;
+  store.m_VelX         = m_PlayerStates.m_VelX;
+  store.m_VelY         = m_PlayerStates.m_VelY;
+  store.m_HeadingX     = m_PlayerStates.m_HeadingX;
+  store.m_HeadingY     = m_PlayerStates.m_HeadingY;
+  store.m_MaxSpeed     = m_PlayerStates.m_MaxSpeed;
+  store.m_DistSqToBall = m_PlayerStates.m_DistSqToBall;
+  store.m_TimeToBall   = m_PlayerStates.m_TimeToBall;
+  store.m_Region       = m_PlayerStates.m_Region;
+  store.m_Role         = m_PlayerStates.m_Role;
+  store.m_Flags        = m_PlayerStates.m_Flags;
+  store.m_RedRanking   = m_PlayerStates.m_RedRanking;
+  store.m_BlueRanking  = m_PlayerStates.m_BlueRanking;
+  store.m_PitchRanking = m_PlayerStates.m_PitchRanking;
+}
@@ -0,0 +1,186 @@
+#ifndef MATCHSNAPSHOT_H
+#define MATCHSNAPSHOT_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   MatchSnapshot.h
+//
+//  Desc:   a copy of everything a match's future depends on: the ball,
+//          every player (its kinematics, steering, state machine and
+//          regulators), the teams (their state machines, key players and
+//          support spots), the score and the services of the world the
+//          match is played in (the clock, the random stream and the
+//          pending telegrams).
+//
+//          Restoring a snapshot puts the pitch back exactly as it was when
+//          the snapshot was taken, so a match can be forked: played on to
+//          see what happens, rewound, and played on again, perhaps after
+//          reseeding the random stream or changing something to see what
+//          difference it makes.
+//
+//          A snapshot may be restored to the pitch it was taken from or to
+//          any pitch made the same way (the same teams and time step, in a
+//          new world), since players are referred to by their handles and
+//          telegrams by entity ID. The pitch's world must be bound to the
+//          calling thread when taking or restoring.
+//
+//          The players' controllers (see PlayerController.h) are not part
+//          of the snapshot. Restoring leaves an ActionController's actions
+//          and a ReplayController's place in its stream as they are, so
+//          whoever owns one must set it again after restoring: SoccerEnv
+//          writes fresh actions each step, and a ReplayController must be
+//          rewound to the frame of the snapshot's update.
+//
+//          The snapshot is a handful of flat arrays. Once it has been
+//          taken the storage is reused, so taking and restoring it again
+//          just copies them.
+//
+//------------------------------------------------------------------------
+#include <vector>
+
+#include "2D/Vector2D.h"
+#include "misc/RandomStream.h"
+#include "Messaging/TelegramWheel.h"
+#include "SupportSpotCalculator.h"
+#include "PlayerStateStore.h"
+
+template <class entity_type> class State;
+class SoccerPitch;
+class SoccerTeam;
+class PlayerBase;
+class FieldPlayer;
+class GoalKeeper;
+class MovingEntity;
+
+
+class MatchSnapshot
+{
+private:
+
+  //what a moving entity's future depends on
+  struct SavedEntity
+  {
+    Vector2D  Pos;
+    Vector2D  Velocity;
+    Vector2D  Heading;
+    double    MaxSpeed;
+    double    MaxForce;
+    double    MaxTurnRate;
+  };
+
+  struct SavedPlayer
+  {
+    SavedEntity  Body;
+
+    int       HomeRegion;
+    int       DefaultRegion;
+    int       GuardRegionMin;
+    int       GuardRegionMax;
+
+    //the steering behaviors
+    int       SteeringFlags;
+    Vector2D  Target;
+    Vector2D  SteeringForce;
+    double    InterposeDist;
+    double    TimeStep;
+    double    VelocityGain;
+
+    //the current, previous and global states of the player's state
+    //machine. Only those of the player's own kind are used
+    State<FieldPlayer>*  FieldStates[3];
+    State<GoalKeeper>*   KeeperStates[3];
+
+    //field players only
+    double    NextKickTime;
+    int       CurrentState;
+
+    //goal keepers only
+    Vector2D  LookAt;
+  };
+
+  struct SavedTeam
+  {
+    State<SoccerTeam>*  States[3];
+
+    //the handles of the key players, or -1
+    int       ControllingPlayer;
+    int       SupportingPlayer;
+    int       ReceivingPlayer;
+    int       PlayerClosestToBall;
+
+    //the support spots and the inputs their scores were calculated from
+    std::vector<SupportSpotCalculator::SupportSpot> Spots;
+    int                   BestSpot;
+    bool                  TermsAreValid;
+    Vector2D              PassFrom;
+    bool                  HadSupportingPlayer;
+    std::vector<Vector2D> OpponentPos;
+    std::vector<double>   OpponentMaxSpeed;
+    double                NextSpotUpdateTime;
+  };
+
+  //the world
+  long                      m_lTick;
+  RandomStream              m_Random;
+  TelegramWheel             m_PendingMessages;
+
+  //the ball
+  SavedEntity               m_Ball;
+  Vector2D                  m_vBallOldPos;
+  std::vector<Vector2D>     m_BallPath;
+  bool                      m_bBallKicked;
+
+  //the players, indexed by handle
+  std::vector<SavedPlayer>  m_Players;
+
+  //red then blue
+  SavedTeam                 m_Teams[2];
+
+  //the pitch
+  int                       m_iRedGoalCount;
+  int                       m_iBlueGoalCount;
+  bool                      m_bGoalKeeperHasBall;
+  bool                      m_bGameOn;
+  int                       m_iBallRegion;
+  Vector2D                  m_vBallRegionPos;
+
+  //the player state store, rankings and all. Its pointers to the players
+  //are not restored
+  PlayerStateStore          m_PlayerStates;
+
+  bool                      m_bTaken;
+
+  static void  SaveEntity(const MovingEntity* entity, SavedEntity& saved);
+  static void  RestoreEntity(const SavedEntity& saved, MovingEntity* entity);
+
+  static void  SavePlayer(const PlayerBase* player, SavedPlayer& saved);
+  static void  RestorePlayer(const SavedPlayer& saved, PlayerBase* player);
+
+  static void  SaveTeam(const SoccerTeam* team, SavedTeam& saved);
+  static void  RestoreTeam(const SavedTeam& saved, SoccerTeam* team);
+
+public:
+
+  MatchSnapshot():m_lTick(0), m_bTaken(false){}
+
+  //copies the state of the pitch, and of the world bound to the calling
+  //thread, into the snapshot
+  void  Take(const SoccerPitch& pitch);
+
+  //puts the pitch (and the world bound to the calling thread) back as they
+  //were when the snapshot was taken. The pitch must have been made the
+  //same way as the one the snapshot was taken from
+  void  Restore(SoccerPitch& pitch)const;
+
+  bool  isTaken()const{return m_bTaken;}
+
+  //the tick of the world's clock when the snapshot was taken
+  long  Tick()const{return m_lTick;}
+
+  //the random stream as it was when the snapshot was taken. Reseed the
+  //world's stream after restoring to send a fork down another path
+  const RandomStream& Random()const{return m_Random;}
+};
+
+
+#endif
@@ -1,8 +1,8 @@
-#include "ParamLoader.h"
-
-ParamLoader* ParamLoader::Instance()
-{
-  static ParamLoader instance;
-
-  return &instance;
+#include "ParamLoader.h"
+
+ParamLoader* ParamLoader::Instance()
+{
+  static ParamLoader instance;
+
+  return &instance;
 }
\ No newline at end of file
@@ -0,0 +1,331 @@
+#include "PassSafetyKernel.h"
+#include "PlayerBase.h"
+
+#include <math.h>
+
+//building with PASS_KERNEL_SCALAR defined tests every opponent with the
+//scalar code, as a reference for the vectorised paths
+#if defined(PASS_KERNEL_SCALAR)
+#elif defined(__AVX__)
+  #include <immintrin.h>
+  #define PASS_KERNEL_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define PASS_KERNEL_SSE2
+#endif
+
+
+//------------------------------- PassQuery -----------------------------------
+//-----------------------------------------------------------------------------
+PassQuery::PassQuery(Vector2D                from,
+                     Vector2D                target,
+                     const PlayerBase* const receiver,
+                     double                  force):From(from),
+                                                    Target(target),
+                                                    HasReceiver(receiver != NULL),
+                                                    PassingForce(force)
+{
+  if (receiver) ReceiverPos = receiver->Pos();
+}
+
+
+//the values needed to test a pass which do not depend on the opponent
+struct PassFrame
+{
+  //the local space of the pass: the heading points from the passer to
+  //the target
+  double HeadingX, HeadingY;
+  double SideX,    SideY;
+  double Tx,       Ty;
+
+  double FromX,    FromY;
+  double TargetX,  TargetY;
+
+  double DistSqFromTarget;
+  double DistSqTargetReceiver;
+  bool   HasReceiver;
+
+  //the speed the ball leaves the passer's foot at
+  double Speed;
+
+  PassFrame(const PassQuery& pass, double BallMass)
+  {
+    //these are calculated exactly as PointToLocalSpace does
+    Vector2D ToTargetNormalized = Vec2DNormalize(pass.Target - pass.From);
+    Vector2D Side               = ToTargetNormalized.Perp();
+
+    HeadingX = ToTargetNormalized.x; HeadingY = ToTargetNormalized.y;
+    SideX    = Side.x;               SideY    = Side.y;
+
+    Tx = -pass.From.Dot(ToTargetNormalized);
+    Ty = -pass.From.Dot(Side);
+
+    FromX   = pass.From.x;   FromY   = pass.From.y;
+    TargetX = pass.Target.x; TargetY = pass.Target.y;
+
+    DistSqFromTarget     = Vec2DDistanceSq(pass.From, pass.Target);
+    HasReceiver          = pass.HasReceiver;
+    DistSqTargetReceiver = HasReceiver ? Vec2DDistanceSq(pass.Target, pass.ReceiverPos) : 0.0;
+
+    Speed = pass.PassingForce / BallMass;
+  }
+};
+
+
+//------------------------- OpponentCanIntercept -----------------------------
+//
+//  the scalar test, as SoccerTeam::isPassSafeFromOpponent (negated). Used
+//  for the opponents left over when the count isn't a multiple of the
+//  lane width
+//-----------------------------------------------------------------------------
+static inline bool OpponentCanIntercept(const PassFrame& f,
+                                        double           OppX,
+                                        double           OppY,
+                                        double           OppMaxSpeed,
+                                        double           OppBRadius,
+                                        double           BallRadius,
+                                        double           Friction)
+{
+  double LocalX = (f.HeadingX*OppX) + (f.HeadingY*OppY) + (f.Tx);
+  double LocalY = (f.SideX*OppX) + (f.SideY*OppY) + (f.Ty);
+
+  //the opponent is behind the kicker
+  if (LocalX < 0) return false;
+
+  double ySep = f.FromY - OppY;
+  double xSep = f.FromX - OppX;
+
+  //the opponent is further away than the target
+  if (f.DistSqFromTarget < ySep*ySep + xSep*xSep)
+  {
+    if (!f.HasReceiver) return false;
+
+    ySep = OppY - f.TargetY;
+    xSep = OppX - f.TargetX;
+
+    return !(ySep*ySep + xSep*xSep > f.DistSqTargetReceiver);
+  }
+
+  //the time the ball takes to draw level with the opponent, as
+  //SoccerBall::TimeToCoverDistance
+  double DistanceToCover = sqrt(LocalX*LocalX);
+
+  double term = f.Speed*f.Speed + 2.0*DistanceToCover*Friction;
+
+  double TimeForBall = (term <= 0.0) ? -1.0 : (sqrt(term)-f.Speed)/Friction;
+
+  double reach = OppMaxSpeed * TimeForBall + BallRadius + OppBRadius;
+
+  return fabs(LocalY) < reach;
+}
+
+
+//---------------------------- LoadOpponents ----------------------------------
+//-----------------------------------------------------------------------------
+void PassSafetyKernel::LoadOpponents(const std::vector<PlayerBase*>& opponents,
+                                     double                          BallRadius,
+                                     double                          BallMass,
+                                     double                          Friction)
+{
+  m_iNumOpponents = (int)opponents.size();
+
+  m_PosX.resize(m_iNumOpponents);
+  m_PosY.resize(m_iNumOpponents);
+  m_MaxSpeed.resize(m_iNumOpponents);
+  m_BRadius.resize(m_iNumOpponents);
+
+  for (int i=0; i<m_iNumOpponents; ++i)
+  {
+    Vector2D pos = opponents[i]->Pos();
+
+    m_PosX[i]     = pos.x;
+    m_PosY[i]     = pos.y;
+    m_MaxSpeed[i] = opponents[i]->MaxSpeed();
+    m_BRadius[i]  = opponents[i]->BRadius();
+  }
+
+  m_dBallRadius = BallRadius;
+  m_dBallMass   = BallMass;
+  m_dFriction   = Friction;
+}
+
+//-------------------------------- IsSafe -------------------------------------
+//-----------------------------------------------------------------------------
+bool PassSafetyKernel::IsSafe(const PassQuery& pass)const
+{
+  const PassFrame f(pass, m_dBallMass);
+
+  int opp = 0;
+
+#if defined(PASS_KERNEL_AVX)
+
+  const __m256d HeadingX = _mm256_set1_pd(f.HeadingX);
+  const __m256d HeadingY = _mm256_set1_pd(f.HeadingY);
+  const __m256d SideX    = _mm256_set1_pd(f.SideX);
+  const __m256d SideY    = _mm256_set1_pd(f.SideY);
+  const __m256d Tx       = _mm256_set1_pd(f.Tx);
+  const __m256d Ty       = _mm256_set1_pd(f.Ty);
+  const __m256d FromX    = _mm256_set1_pd(f.FromX);
+  const __m256d FromY    = _mm256_set1_pd(f.FromY);
+  const __m256d TargetX  = _mm256_set1_pd(f.TargetX);
+  const __m256d TargetY  = _mm256_set1_pd(f.TargetY);
+  const __m256d DistFT   = _mm256_set1_pd(f.DistSqFromTarget);
+  const __m256d DistTR   = _mm256_set1_pd(f.DistSqTargetReceiver);
+  const __m256d Receiver = f.HasReceiver ? _mm256_castsi256_pd(_mm256_set1_epi64x(-1))
+                                         : _mm256_setzero_pd();
+  const __m256d Speed    = _mm256_set1_pd(f.Speed);
+  const __m256d SpeedSq  = _mm256_mul_pd(Speed, Speed);
+  const __m256d Friction = _mm256_set1_pd(m_dFriction);
+  const __m256d BallR    = _mm256_set1_pd(m_dBallRadius);
+  const __m256d Two      = _mm256_set1_pd(2.0);
+  const __m256d MinusOne = _mm256_set1_pd(-1.0);
+  const __m256d Zero     = _mm256_setzero_pd();
+  const __m256d SignBit  = _mm256_set1_pd(-0.0);
+
+  for (; opp+4 <= m_iNumOpponents; opp += 4)
+  {
+    __m256d OppX = _mm256_loadu_pd(&m_PosX[opp]);
+    __m256d OppY = _mm256_loadu_pd(&m_PosY[opp]);
+
+    __m256d LocalX = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(HeadingX, OppX),
+                                                 _mm256_mul_pd(HeadingY, OppY)),
+                                   Tx);
+    __m256d LocalY = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(SideX, OppX),
+                                                 _mm256_mul_pd(SideY, OppY)),
+                                   Ty);
+
+    __m256d InFront = _mm256_cmp_pd(LocalX, Zero, _CMP_NLT_UQ);
+
+    __m256d ySep = _mm256_sub_pd(FromY, OppY);
+    __m256d xSep = _mm256_sub_pd(FromX, OppX);
+    __m256d Beyond = _mm256_cmp_pd(DistFT,
+                                   _mm256_add_pd(_mm256_mul_pd(ySep, ySep),
+                                                 _mm256_mul_pd(xSep, xSep)),
+                                   _CMP_LT_OQ);
+
+    ySep = _mm256_sub_pd(OppY, TargetY);
+    xSep = _mm256_sub_pd(OppX, TargetX);
+    __m256d OppCloser = _mm256_cmp_pd(_mm256_add_pd(_mm256_mul_pd(ySep, ySep),
+                                                    _mm256_mul_pd(xSep, xSep)),
+                                      DistTR,
+                                      _CMP_NGT_UQ);
+
+    __m256d Dist = _mm256_sqrt_pd(_mm256_mul_pd(LocalX, LocalX));
+    __m256d term = _mm256_add_pd(SpeedSq, _mm256_mul_pd(_mm256_mul_pd(Two, Dist), Friction));
+    __m256d Time = _mm256_div_pd(_mm256_sub_pd(_mm256_sqrt_pd(term), Speed), Friction);
+    Time = _mm256_blendv_pd(Time, MinusOne, _mm256_cmp_pd(term, Zero, _CMP_LE_OQ));
+
+    __m256d reach = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(&m_MaxSpeed[opp]), Time),
+                                                BallR),
+                                  _mm256_loadu_pd(&m_BRadius[opp]));
+
+    __m256d InReach = _mm256_cmp_pd(_mm256_andnot_pd(SignBit, LocalY), reach, _CMP_LT_OQ);
+
+    __m256d Intercepted = _mm256_and_pd(InFront,
+                                        _mm256_or_pd(_mm256_and_pd(Beyond, _mm256_and_pd(Receiver, OppCloser)),
+                                                     _mm256_andnot_pd(Beyond, InReach)));
+
+    if (_mm256_movemask_pd(Intercepted)) return false;
+  }
+
+#elif defined(PASS_KERNEL_SSE2)
+
+  const __m128d HeadingX = _mm_set1_pd(f.HeadingX);
+  const __m128d HeadingY = _mm_set1_pd(f.HeadingY);
+  const __m128d SideX    = _mm_set1_pd(f.SideX);
+  const __m128d SideY    = _mm_set1_pd(f.SideY);
+  const __m128d Tx       = _mm_set1_pd(f.Tx);
+  const __m128d Ty       = _mm_set1_pd(f.Ty);
+  const __m128d FromX    = _mm_set1_pd(f.FromX);
+  const __m128d FromY    = _mm_set1_pd(f.FromY);
+  const __m128d TargetX  = _mm_set1_pd(f.TargetX);
+  const __m128d TargetY  = _mm_set1_pd(f.TargetY);
+  const __m128d DistFT   = _mm_set1_pd(f.DistSqFromTarget);
+  const __m128d DistTR   = _mm_set1_pd(f.DistSqTargetReceiver);
+  const __m128d Receiver = f.HasReceiver ? _mm_castsi128_pd(_mm_set1_epi32(-1))
+                                         : _mm_setzero_pd();
+  const __m128d Speed    = _mm_set1_pd(f.Speed);
+  const __m128d SpeedSq  = _mm_mul_pd(Speed, Speed);
+  const __m128d Friction = _mm_set1_pd(m_dFriction);
+  const __m128d BallR    = _mm_set1_pd(m_dBallRadius);
+  const __m128d Two      = _mm_set1_pd(2.0);
+  const __m128d MinusOne = _mm_set1_pd(-1.0);
+  const __m128d Zero     = _mm_setzero_pd();
+  const __m128d SignBit  = _mm_set1_pd(-0.0);
+
+  for (; opp+2 <= m_iNumOpponents; opp += 2)
+  {
+    __m128d OppX = _mm_loadu_pd(&m_PosX[opp]);
+    __m128d OppY = _mm_loadu_pd(&m_PosY[opp]);
+
+    __m128d LocalX = _mm_add_pd(_mm_add_pd(_mm_mul_pd(HeadingX, OppX),
+                                           _mm_mul_pd(HeadingY, OppY)),
+                                Tx);
+    __m128d LocalY = _mm_add_pd(_mm_add_pd(_mm_mul_pd(SideX, OppX),
+                                           _mm_mul_pd(SideY, OppY)),
+                                Ty);
+
+    __m128d InFront = _mm_cmpnlt_pd(LocalX, Zero);
+
+    __m128d ySep = _mm_sub_pd(FromY, OppY);
+    __m128d xSep = _mm_sub_pd(FromX, OppX);
+    __m128d Beyond = _mm_cmplt_pd(DistFT,
+                                  _mm_add_pd(_mm_mul_pd(ySep, ySep),
+                                             _mm_mul_pd(xSep, xSep)));
+
+    ySep = _mm_sub_pd(OppY, TargetY);
+    xSep = _mm_sub_pd(OppX, TargetX);
+    __m128d OppCloser = _mm_cmpngt_pd(_mm_add_pd(_mm_mul_pd(ySep, ySep),
+                                                 _mm_mul_pd(xSep, xSep)),
+                                      DistTR);
+
+    __m128d Dist = _mm_sqrt_pd(_mm_mul_pd(LocalX, LocalX));
+    __m128d term = _mm_add_pd(SpeedSq, _mm_mul_pd(_mm_mul_pd(Two, Dist), Friction));
+    __m128d Time = _mm_div_pd(_mm_sub_pd(_mm_sqrt_pd(term), Speed), Friction);
+    __m128d CannotReach = _mm_cmple_pd(term, Zero);
+    Time = _mm_or_pd(_mm_and_pd(CannotReach, MinusOne), _mm_andnot_pd(CannotReach, Time));
+
+    __m128d reach = _mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_loadu_pd(&m_MaxSpeed[opp]), Time),
+                                          BallR),
+                               _mm_loadu_pd(&m_BRadius[opp]));
+
+    __m128d InReach = _mm_cmplt_pd(_mm_andnot_pd(SignBit, LocalY), reach);
+
+    __m128d Intercepted = _mm_and_pd(InFront,
+                                     _mm_or_pd(_mm_and_pd(Beyond, _mm_and_pd(Receiver, OppCloser)),
+                                               _mm_andnot_pd(Beyond, InReach)));
+
+    if (_mm_movemask_pd(Intercepted)) return false;
+  }
+
+#endif
+
+  //any remaining opponents
+  for (; opp < m_iNumOpponents; ++opp)
+  {
+    if (OpponentCanIntercept(f,
+                             m_PosX[opp],
+                             m_PosY[opp],
+                             m_MaxSpeed[opp],
+                             m_BRadius[opp],
+                             m_dBallRadius,
+                             m_dFriction))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+//------------------------------ TestPasses -----------------------------------
+//-----------------------------------------------------------------------------
+void PassSafetyKernel::TestPasses(const PassQuery* passes,
+                                  int              NumPasses,
+                                  char*            results)const
+{
+  for (int pass=0; pass<NumPasses; ++pass)
+  {
+    results[pass] = IsSafe(passes[pass]);
+  }
+}
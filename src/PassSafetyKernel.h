@@ -0,0 +1,96 @@
+#ifndef PASSSAFETYKERNEL_H
+#define PASSSAFETYKERNEL_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   PassSafetyKernel.h
+//
+//  Desc:   batched version of SoccerTeam::isPassSafeFromOpponent. The
+//          opponents are copied into struct-of-arrays form once and any
+//          number of passes are then tested against them, several
+//          opponents at a time using SSE2 or AVX lanes where available.
+//
+//          Every lane performs exactly the same double precision
+//          operations, in the same order, as the scalar test so the
+//          verdicts are identical to testing each opponent in turn.
+//          (This relies on the compiler not fusing multiplies and adds,
+//          hence -ffp-contract=off in the CMake build.) Define
+//          PASS_KERNEL_SCALAR to build it without the lanes.
+//
+//------------------------------------------------------------------------
+#include <vector>
+
+#include "2D/Vector2D.h"
+
+class PlayerBase;
+
+
+//a pass to be tested by the kernel
+struct PassQuery
+{
+  Vector2D  From;
+  Vector2D  Target;
+
+  //the intended receiver's position. Only used if HasReceiver is true
+  Vector2D  ReceiverPos;
+  bool      HasReceiver;
+
+  double    PassingForce;
+
+  PassQuery():HasReceiver(false), PassingForce(0.0){}
+
+  PassQuery(Vector2D                from,
+            Vector2D                target,
+            const PlayerBase* const receiver,
+            double                  force);
+};
+
+
+class PassSafetyKernel
+{
+private:
+
+  //the opponents' positions, maximum speeds and bounding radii
+  std::vector<double>  m_PosX;
+  std::vector<double>  m_PosY;
+  std::vector<double>  m_MaxSpeed;
+  std::vector<double>  m_BRadius;
+
+  int                  m_iNumOpponents;
+
+  //properties of the ball used to calculate how long it takes to reach
+  //the point where an opponent could intercept it
+  double               m_dBallRadius;
+  double               m_dBallMass;
+  double               m_dFriction;
+
+public:
+
+  PassSafetyKernel():m_iNumOpponents(0),
+                     m_dBallRadius(0.0),
+                     m_dBallMass(1.0),
+                     m_dFriction(0.0)
+  {}
+
+  //takes a copy of the opponents' current state. Call this whenever the
+  //opponents may have moved since the last call
+  void  LoadOpponents(const std::vector<PlayerBase*>& opponents,
+                      double                          BallRadius,
+                      double                          BallMass,
+                      double                          Friction);
+
+  //returns true if the pass cannot be intercepted by any of the loaded
+  //opponents
+  bool  IsSafe(const PassQuery& pass)const;
+
+  //tests NumPasses passes, writing a verdict per pass to results (non zero
+  //if safe)
+  void  TestPasses(const PassQuery* passes,
+                   int              NumPasses,
+                   char*            results)const;
+
+  int   NumOpponents()const{return m_iNumOpponents;}
+};
+
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef PLAYERACTION_H
+#define PLAYERACTION_H
+//------------------------------------------------------------------------
+//
+//  Name:   PlayerAction.h
+//
+//  Desc:   what a player is told to do for an update by something outside
+//          the game (a policy being trained, say) instead of deciding for
+//          itself. See PlayerController.h and PlayerBase::TakeAction.
+//
+//          Directions are in the pitch's coordinates.
+//
+//------------------------------------------------------------------------
+#include "2D/Vector2D.h"
+
+
+struct PlayerAction
+{
+  //the direction to run in. The player stands still if this is (near
+  //enough) zero
+  Vector2D  Move;
+
+  //the direction to kick the ball in, and how hard as a fraction (0 to 1)
+  //of the hardest shot a player can make. The player only kicks if the
+  //power is above zero and the ball is within its kicking range and not
+  //behind it
+  Vector2D  Kick;
+  double    KickPower;
+
+  PlayerAction():KickPower(0.0){}
+};
+
+
+#endif
@@ -1,185 +1,247 @@
-#pragma warning (disable:4786)
-#ifndef PLAYERBASE_H
-#define PLAYERBASE_H
-//------------------------------------------------------------------------
-//
-//  Name: PlayerBase.h
-//
-//  Desc: Definition of a soccer player base class. The player inherits
-//        from the autolist class so that any player created will be 
-//        automatically added to a list that is easily accesible by any
-//        other game objects. (mainly used by the steering behaviors and
-//        player state classes)
-//
-//  Author: Mat Buckland 2003 (fup@ai-junkie.com)
-//
-//------------------------------------------------------------------------
-#include <vector>
-#include <string>
-#include <cassert>
-#include "misc/autolist.h"
-#include "2D/Vector2D.h"
-#include "Game/MovingEntity.h"
-#include "constants.h"
-
-class SoccerTeam;
-class SoccerPitch;
-class SoccerBall;
-class SteeringBehaviors;
-class Region;
-
-
-
-class PlayerBase : public MovingEntity,
-                   public AutoList<PlayerBase>
-{
-
-public:
-  
-  //enum player_role{goal_keeper, attacker, defender, role_size};
-
-protected:
-
-  //this player's role in the team
-  FieldConst::player_role             m_PlayerRole;
-
-  //a pointer to this player's team
-  SoccerTeam*             m_pTeam;
- 
-  //the steering behaviors
-  SteeringBehaviors*      m_pSteering;
-
-  //the region that this player is assigned to.
-  int                     m_iHomeRegion;
-
-  //the region this player moves to before kickoff
-  int                     m_iDefaultRegion;
-
-  //the region indexes this player should be guard.
-  int                     m_iGuardRegionMax;
-  int                     m_iGuardRegionMin;
-
-  //the distance to the ball (in squared-space). This value is queried 
-  //a lot so it's calculated once each time-step and stored here.
-  double                   m_dDistSqToBall;
-
-  //player self-attributes, scale is 0~200.0, means player‘s ability based 
-  //on default speed. Default is 100.0, means 100%
-  std::string             m_strName;
-  double                  m_dSelfSpeed;
-  double                  m_dSelfTurnRate;
-  double                  m_dSelfForce;
-
-  
-  //the vertex buffer
-  std::vector<Vector2D>   m_vecPlayerVB;
-  //the buffer for the transformed vertices
-  std::vector<Vector2D>   m_vecPlayerVBTrans;
-
-public:
-
-
-  PlayerBase(SoccerTeam*    home_team,
-             int            home_region,
-             Vector2D       heading,
-             Vector2D       velocity,
-             double          mass,
-             double          max_force,
-             double          max_speed,
-             double          max_turn_rate,
-             double          scale,
-             FieldConst::player_role    role);
-
-  virtual ~PlayerBase();
-
-
-  //returns true if there is an opponent within this player's 
-  //comfort zone
-  bool        isThreatened()const;
-
-  //rotates the player to face the ball or the player's current target
-  void        TrackBall();
-  void        TrackTarget();
-
-  //this messages the player that is closest to the supporting spot to
-  //change state to support the attacking player
-  void        FindSupport()const;
-
-  //returns true if the ball can be grabbed by the goalkeeper
-  bool        BallWithinKeeperRange()const;
-
-  //returns true if the ball is within kicking range
-  bool        BallWithinKickingRange()const;
-
-  //returns true if a ball comes within range of a receiver
-  bool        BallWithinReceivingRange()const;
-
-  //returns true if the player is located within the boundaries 
-  //of his home region
-  bool        InHomeRegion()const;
-
-  //returns true if this player is ahead of the attacker
-  bool        isAheadOfAttacker()const;
-  
-  //returns true if a player is located at the designated support spot
-  bool        AtSupportSpot()const;
-
-  //returns true if the player is located at his steering target
-  bool        AtTarget()const;
-
-  //returns true if the player is the closest player in his team to
-  //the ball
-  bool        isClosestTeamMemberToBall()const;
-
-  //returns true if the point specified by 'position' is located in
-  //front of the player
-  bool        PositionInFrontOfPlayer(Vector2D position)const;
-
-  //returns true if the player is the closest player on the pitch to the ball
-  bool        isClosestPlayerOnPitchToBall()const;
-
-  //returns true if this player is the controlling player
-  bool        isControllingPlayer()const;
-  bool        isReceivePlayer()const;
-
-  //returns true if the player is located in the designated 'hot region' --
-  //the area close to the opponent's goal
-  bool        InHotRegion()const;
-
-  //return true if the ball is in players guard region, that means, monitor the distance
-  //between the ball and the player.. @ning
-  bool        InGuardRegion()const;
-  bool        InGuardRegion(int homeidx, int otheridx)const;
-
-  //returns true if the player is too far from his 
-  //position, especially for defenders...
-  //monitor the distance between player and his home region.. @ning
-  bool        isFarFromHomeRegion()const;
-
-  FieldConst::player_role Role()const{return m_PlayerRole;}
-
-  double       DistSqToBall()const{return m_dDistSqToBall;}
-  void        SetDistSqToBall(double val){m_dDistSqToBall = val;}
-
-  //calculate distance to opponent's/home goal. Used frequently by the passing
-  //methods
-  double       DistToOppGoal()const;
-  double       DistToHomeGoal()const;
-
-  SoccerBall* const        Ball()const;
-  SoccerPitch* const       Pitch()const;
-  SteeringBehaviors*const  Steering()const{return m_pSteering;}
-  const Region* const      HomeRegion()const;
-  int                      HomeRegionIndex() {return m_iHomeRegion;}
-  void                     SetHomeRegion(int NewRegion);
-  void                     SetDefaultHomeRegion(){/*m_iHomeRegion = m_iDefaultRegion;*/return SetHomeRegion(m_iDefaultRegion);}
-
-  SoccerTeam*const         Team()const{return m_pTeam;}
-  
-};
-
-
-
-
-
+#pragma warning (disable:4786)
+#ifndef PLAYERBASE_H
+#define PLAYERBASE_H
+//------------------------------------------------------------------------
+//
+//  Name: PlayerBase.h
+//
+//  Desc: Definition of a soccer player base class. Any player created
+//        is automatically added to its pitch's list of players so that
+//        it is easily accesible by any other game objects. (mainly used
+//        by the steering behaviors and player state classes)
+//
+//  Author: Mat Buckland 2003 (fup@ai-junkie.com)
+//
+//------------------------------------------------------------------------
+#include <vector>
+#include <string>
+#include <cassert>
+#include "2D/Vector2D.h"
+#include "Game/MovingEntity.h"
+#include "constants.h"
+#include "PlayerAction.h"
+#include "PlayerController.h"
+
+class SoccerTeam;
+class SoccerPitch;
+class SoccerBall;
+class SteeringBehaviors;
+class Region;
+struct Telegram;
+
+
+
+class PlayerBase : public MovingEntity
+{
+
+public:
+  
+  //enum player_role{goal_keeper, attacker, defender, role_size};
+
+protected:
+
+  //this player's role in the team
+  FieldConst::player_role             m_PlayerRole;
+
+  //a pointer to this player's team
+  SoccerTeam*             m_pTeam;
+ 
+  //the steering behaviors
+  SteeringBehaviors*      m_pSteering;
+
+  //the region that this player is assigned to.
+  int                     m_iHomeRegion;
+
+  //the region this player moves to before kickoff
+  int                     m_iDefaultRegion;
+
+  //the region indexes this player should be guard.
+  int                     m_iGuardRegionMax;
+  int                     m_iGuardRegionMin;
+
+  //this player's handle into the pitch's player state store. The
+  //distance to the ball (in squared-space) is queried a lot so it's
+  //calculated once each time-step and kept there.
+  int                     m_iStateHandle;
+
+  //player self-attributes, scale is 0~200.0, means player‘s ability based 
+  //on default speed. Default is 100.0, means 100%
+  std::string             m_strName;
+  double                  m_dSelfSpeed;
+  double                  m_dSelfTurnRate;
+  double                  m_dSelfForce;
+
+  
+  //the vertex buffer
+  std::vector<Vector2D>   m_vecPlayerVB;
+  //the buffer for the transformed vertices
+  std::vector<Vector2D>   m_vecPlayerVBTrans;
+
+  //decides the player's moves. Never NULL; the player's own state
+  //machine (the FsmController) unless something else is given control.
+  //Not owned
+  PlayerController*       m_pController;
+
+  friend class MatchSnapshot;
+
+public:
+
+
+  PlayerBase(SoccerTeam*    home_team,
+             int            home_region,
+             Vector2D       heading,
+             Vector2D       velocity,
+             double          mass,
+             double          max_force,
+             double          max_speed,
+             double          max_turn_rate,
+             double          scale,
+             FieldConst::player_role    role);
+
+  virtual ~PlayerBase();
+
+
+  //returns true if there is an opponent within this player's 
+  //comfort zone
+  bool        isThreatened()const;
+
+  //rotates the player to face the ball or the player's current target
+  void        TrackBall();
+  void        TrackTarget();
+
+  //this messages the player that is closest to the supporting spot to
+  //change state to support the attacking player
+  void        FindSupport()const;
+
+  //returns true if the ball can be grabbed by the goalkeeper
+  bool        BallWithinKeeperRange()const;
+
+  //returns true if the ball is within kicking range
+  bool        BallWithinKickingRange()const;
+
+  //returns true if a ball comes within range of a receiver
+  bool        BallWithinReceivingRange()const;
+
+  //returns true if the ball is within sqrt(RangeSq) of the player. In an
+  //update longer than a tick the ball may have passed through that range
+  //and out again since the last; if so it is moved back to where it
+  //entered it, as though the player had stopped it there. Not once the
+  //ball has been kicked or trapped in this update
+  bool        ReachForBall(double RangeSq);
+
+  //publishes an event of the given type (see MatchEvents.h) involving
+  //this player and, unless it is -1, the player with the ID other
+  void        PublishEvent(int type, int other = -1, double force = 0.0)const;
+
+  //publishes a change of the player's state
+  void        PublishStateChange(int from, int to)const;
+
+  //hands the player to the given controller (NULL for its own state
+  //machine). See PlayerController.h
+  void        SetController(PlayerController* controller);
+  PlayerController* Controller()const{return m_pController;}
+
+  //runs the player's state machine for an update standing in for
+  //TimeStep ticks, and passes a telegram to it
+  virtual void RunStateMachine(double TimeStep) = 0;
+  virtual bool StateMachineHandleMessage(const Telegram& msg) = 0;
+
+  //steers the player the way the action asks and kicks the ball if it
+  //asks for that and the ball can be kicked
+  void        TakeAction(const PlayerAction& action);
+
+  //true if the player may kick the ball again. Counts as a kick attempt
+  virtual bool isReadyForNextKick()const{return true;}
+
+  //used by the state machine when an update stands in for several ticks.
+  //Once the ball has been kicked it must move before anyone can react
+  bool        StatesMayChain()const;
+
+  //returns true if the player is located within the boundaries 
+  //of his home region
+  bool        InHomeRegion()const;
+
+  //the region the player is in, or -1 if none (mapped by the pitch each
+  //update and whenever the player moves)
+  int         RegionIndex()const;
+
+  //returns true if the player and the ball are in the same region
+  bool        InSameRegionAsBall()const;
+
+  //returns true if this player is ahead of the attacker
+  bool        isAheadOfAttacker()const;
+  
+  //returns true if a player is located at the designated support spot
+  bool        AtSupportSpot()const;
+
+  //returns true if the player is located at his steering target
+  bool        AtTarget()const;
+
+  //returns true if the player is the closest player in his team to
+  //the ball
+  bool        isClosestTeamMemberToBall()const;
+
+  //returns true if the point specified by 'position' is located in
+  //front of the player
+  bool        PositionInFrontOfPlayer(Vector2D position)const;
+
+  //returns true if the player is the closest player on the pitch to the ball
+  bool        isClosestPlayerOnPitchToBall()const;
+
+  //returns true if this player is the controlling player
+  bool        isControllingPlayer()const;
+  bool        isReceivePlayer()const;
+
+  //returns true if the player is located in the designated 'hot region' --
+  //the area close to the opponent's goal
+  bool        InHotRegion()const;
+
+  //return true if the ball is in players guard region, that means, monitor the distance
+  //between the ball and the player.. @ning
+  bool        InGuardRegion()const;
+  bool        InGuardRegion(int homeidx, int otheridx)const;
+
+  //sets the player's self-attributes, scaling its max force and turn
+  //rate to match. Called once, straight after the player is created
+  void        SetSelfAttributes(double speed, double force, double turn_rate);
+
+  //sets the max speed to the given percentage of the player's self speed
+  void        SetBaseMaxSpeed(double speed){SetMaxSpeed(speed*(m_dSelfSpeed/100.0));}
+
+  //returns true if the player is too far from his 
+  //position, especially for defenders...
+  //monitor the distance between player and his home region.. @ning
+  bool        isFarFromHomeRegion()const;
+
+  FieldConst::player_role Role()const{return m_PlayerRole;}
+
+  double      DistSqToBall()const;
+
+  int         StateHandle()const{return m_iStateHandle;}
+
+  //copies the player's position, velocity and heading into the player
+  //state store. Called after each update
+  void        WriteState();
+
+  //calculate distance to opponent's/home goal. Used frequently by the passing
+  //methods
+  double       DistToOppGoal()const;
+  double       DistToHomeGoal()const;
+
+  SoccerBall* const        Ball()const;
+  SoccerPitch* const       Pitch()const;
+  SteeringBehaviors*const  Steering()const{return m_pSteering;}
+  const Region* const      HomeRegion()const;
+  int                      HomeRegionIndex() {return m_iHomeRegion;}
+  void                     SetHomeRegion(int NewRegion);
+  void                     SetDefaultHomeRegion(){/*m_iHomeRegion = m_iDefaultRegion;*/return SetHomeRegion(m_iDefaultRegion);}
+
+  SoccerTeam*const         Team()const{return m_pTeam;}
+  
+};
+
+
+
+
+
 #endif
\ No newline at end of file
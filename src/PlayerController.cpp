@@ -0,0 +1,299 @@
+#include "PlayerController.h"
+#include "PlayerBase.h"
+#include "SoccerPitch.h"
+#include "SoccerTeam.h"
+#include "Time/SimClock.h"
+
+#include <fstream>
+#include <cassert>
+
+
+//----------------------------- FsmController ---------------------------------
+//-----------------------------------------------------------------------------
+FsmController* FsmController::Instance()
+{
+  static FsmController instance;
+
+  return &instance;
+}
+
+void FsmController::Control(PlayerBase* player, double TimeStep)
+{
+  player->RunStateMachine(TimeStep);
+}
+
+bool FsmController::HandleMessage(PlayerBase* player, const Telegram& msg)
+{
+  return player->StateMachineHandleMessage(msg);
+}
+
+
+//---------------------------- ActionStream -----------------------------------
+//-----------------------------------------------------------------------------
+void ActionStream::Record(const PlayerAction* actions)
+{
+  m_Actions.insert(m_Actions.end(), actions, actions + m_iNumPlayers);
+}
+
+//the file is a tag, the number of players and actions, then the actions
+//as five doubles each
+static const char ActionStreamTag[4] = {'S', 'S', 'A', 'S'};
+
+static const int  ActionSizeInFile = 5 * sizeof(double);
+
+bool ActionStream::Save(const std::string& filename)const
+{
+  std::ofstream file(filename.c_str(), std::ios::binary);
+
+  if (!file) return false;
+
+  int NumActions = (int)m_Actions.size();
+
+  file.write(ActionStreamTag, sizeof(ActionStreamTag));
+  file.write((const char*)&m_iNumPlayers, sizeof(m_iNumPlayers));
+  file.write((const char*)&NumActions,    sizeof(NumActions));
+
+  for (int a=0; a<NumActions; ++a)
+  {
+    const PlayerAction& action = m_Actions[a];
+
+    double fields[5] = {action.Move.x, action.Move.y,
+                        action.Kick.x, action.Kick.y,
+                        action.KickPower};
+
+    file.write((const char*)fields, sizeof(fields));
+  }
+
+  return file.good();
+}
+
+bool ActionStream::Load(const std::string& filename)
+{
+  std::ifstream file(filename.c_str(), std::ios::binary);
+
+  if (!file) return false;
+
+  char tag[4];
+  int  NumPlayers = 0;
+  int  NumActions = 0;
+
+  file.read(tag, sizeof(tag));
+  file.read((char*)&NumPlayers, sizeof(NumPlayers));
+  file.read((char*)&NumActions, sizeof(NumActions));
+
+  if (!file || std::string(tag, 4) != std::string(ActionStreamTag, 4) ||
+      NumPlayers <= 0 || NumActions < 0 || NumActions % NumPlayers != 0)
+  {
+    return false;
+  }
+
+  //the counts are only believed if the rest of the file holds exactly
+  //that many actions, so a bad file can't ask for a huge allocation
+  std::streampos start = file.tellg();
+
+  file.seekg(0, std::ios::end);
+
+  long long NumBytes = (long long)(file.tellg() - start);
+
+  file.seekg(start);
+
+  if (!file || NumBytes != (long long)NumActions * ActionSizeInFile)
+  {
+    return false;
+  }
+
+  std::vector<PlayerAction> actions(NumActions);
+
+  for (int a=0; a<NumActions; ++a)
+  {
+    double fields[5];
+
+    file.read((char*)fields, sizeof(fields));
+
+    actions[a].Move      = Vector2D(fields[0], fields[1]);
+    actions[a].Kick      = Vector2D(fields[2], fields[3]);
+    actions[a].KickPower = fields[4];
+  }
+
+  if (!file) return false;
+
+  m_iNumPlayers = NumPlayers;
+  m_Actions.swap(actions);
+
+  return true;
+}
+
+
+//--------------------------- ActionController --------------------------------
+//-----------------------------------------------------------------------------
+ActionController::ActionController(SoccerPitch* pitch):m_pPitch(pitch),
+                                                       m_bActive(true),
+                                                       m_pRecording(NULL)
+{}
+
+ActionController::~ActionController()
+{
+  for (unsigned int p=0; p<m_Players.size(); ++p)
+  {
+    m_Players[p]->SetController(NULL);
+  }
+
+  if (!m_Players.empty()) m_pPitch->RemoveController(this);
+}
+
+//------------------------------ AddPlayer ------------------------------------
+//
+//  the actions are kept in step with the players, so once the match is
+//  under way no more are made
+//-----------------------------------------------------------------------------
+void ActionController::AddPlayer(PlayerBase* player)
+{
+  assert (player->Pitch() == m_pPitch && "<ActionController::AddPlayer>: player is on another pitch");
+
+  if (m_Players.empty()) m_pPitch->AddController(this);
+
+  const int handle = player->StateHandle();
+
+  if (handle >= (int)m_Slots.size()) m_Slots.resize(handle + 1, -1);
+
+  m_Slots[handle] = (int)m_Players.size();
+
+  m_Players.push_back(player);
+  m_Actions.push_back(PlayerAction());
+
+  player->SetController(this);
+}
+
+void ActionController::AddTeam(SoccerTeam* team)
+{
+  for (unsigned int p=0; p<team->Members().size(); ++p)
+  {
+    AddPlayer(team->Members()[p]);
+  }
+}
+
+void ActionController::ClearActions()
+{
+  for (unsigned int p=0; p<m_Actions.size(); ++p)
+  {
+    m_Actions[p] = PlayerAction();
+  }
+}
+
+//-------------------------------- Decide -------------------------------------
+//-----------------------------------------------------------------------------
+void ActionController::Decide(SoccerPitch* pitch)
+{
+  ChooseActions(pitch);
+
+  if (m_pRecording && !m_Actions.empty())
+  {
+    assert (m_pRecording->NumPlayers() == NumPlayers() &&
+            "<ActionController::Decide>: recording is of another number of players");
+
+    m_pRecording->Record(&m_Actions[0]);
+  }
+}
+
+//------------------------------- Control -------------------------------------
+//-----------------------------------------------------------------------------
+void ActionController::Control(PlayerBase* player, double TimeStep)
+{
+  if (!m_bActive || !m_pPitch->GameOn())
+  {
+    player->RunStateMachine(TimeStep);
+
+    return;
+  }
+
+  player->TakeAction(m_Actions[m_Slots[player->StateHandle()]]);
+}
+
+bool ActionController::HandleMessage(PlayerBase* player, const Telegram& msg)
+{
+  if (m_bActive && m_pPitch->GameOn()) return false;
+
+  return player->StateMachineHandleMessage(msg);
+}
+
+
+//------------------------ BatchPolicyController ------------------------------
+//-----------------------------------------------------------------------------
+BatchPolicyController::BatchPolicyController(SoccerTeam*  team,
+                                             BatchPolicy* policy,
+                                             int          TicksPerMatch):ActionController(team->Pitch()),
+                                                                         m_pPolicy(policy),
+                                                                         m_Observer(team),
+                                                                         m_iTicksPerMatch(TicksPerMatch)
+{
+  m_Observation.resize(m_Observer.ObservationSize());
+  m_ActionBuffer.resize(m_Observer.ActionSize());
+
+  AddTeam(team);
+}
+
+//---------------------------- ChooseActions ----------------------------------
+//
+//  the policy is only asked while the game is on, since only then are the
+//  actions taken
+//-----------------------------------------------------------------------------
+void BatchPolicyController::ChooseActions(SoccerPitch* pitch)
+{
+  if (!pitch->GameOn()) return;
+
+  double TimeLeft = 1.0;
+
+  if (m_iTicksPerMatch > 0)
+  {
+    double ticks = SimTime->GetCurrentTick() * pitch->TimeStep();
+
+    TimeLeft = MaxOf(0.0, 1.0 - ticks / m_iTicksPerMatch);
+  }
+
+  m_Observer.Observe(&m_Observation[0], TimeLeft);
+
+  m_pPolicy->Act(m_Observer, &m_Observation[0], &m_ActionBuffer[0]);
+
+  m_Observer.ReadActions(&m_ActionBuffer[0], Actions());
+}
+
+
+//--------------------------- ReplayController --------------------------------
+//-----------------------------------------------------------------------------
+ReplayController::ReplayController(SoccerPitch*        pitch,
+                                   const ActionStream* stream):ActionController(pitch),
+                                                               m_pStream(stream),
+                                                               m_iNextFrame(0)
+{}
+
+void ReplayController::Rewind(int frame)
+{
+  m_iNextFrame = frame;
+
+  SetActive(true);
+}
+
+//---------------------------- ChooseActions ----------------------------------
+//
+//  a frame is used up every update, whether or not the game is on, just as
+//  one is recorded every update
+//-----------------------------------------------------------------------------
+void ReplayController::ChooseActions(SoccerPitch* /*pitch*/)
+{
+  assert (m_pStream->NumPlayers() == NumPlayers() &&
+          "<ReplayController::ChooseActions>: stream is of another number of players");
+
+  if (isFinished())
+  {
+    SetActive(false);
+
+    return;
+  }
+
+  const PlayerAction* frame = m_pStream->Frame(m_iNextFrame++);
+
+  for (int p=0; p<NumPlayers(); ++p)
+  {
+    Actions()[p] = frame[p];
+  }
+}
@@ -0,0 +1,267 @@
+#ifndef PLAYERCONTROLLER_H
+#define PLAYERCONTROLLER_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   PlayerController.h
+//
+//  Desc:   what decides a player's moves each update. Every player has a
+//          controller; by default it is the FsmController, which runs the
+//          player's own state machine as the game always has.
+//
+//          An ActionController instead has its players take actions (see
+//          PlayerAction.h) chosen outside the state machines: written in
+//          by whoever owns the controller (SoccerEnv does this), asked of
+//          a BatchPolicy for all the controller's players at once, or
+//          played back from an ActionStream recorded earlier.
+//
+//          Controllers of several players are registered with the pitch,
+//          which asks each to decide once per update, after the players
+//          are ranked by the ball and before any is updated. So a policy
+//          is run once per team per update, however many players it plays.
+//
+//          Between a goal and the kick off the players of an
+//          ActionController still make their own way back to their home
+//          regions, and telegrams sent to them while the game is on are
+//          ignored.
+//
+//------------------------------------------------------------------------
+#include <vector>
+#include <string>
+
+#include "PlayerAction.h"
+#include "TeamObserver.h"
+
+class PlayerBase;
+class SoccerPitch;
+class SoccerTeam;
+struct Telegram;
+
+
+class PlayerController
+{
+public:
+
+  virtual ~PlayerController(){}
+
+  //called by the pitch once per update before any player is updated (if
+  //the controller is registered with it)
+  virtual void  Decide(SoccerPitch* /*pitch*/){}
+
+  //makes the player's move for the update, which stands in for TimeStep
+  //ticks
+  virtual void  Control(PlayerBase* player, double TimeStep) = 0;
+
+  //passes on a telegram sent to the player. Returns true if it was handled
+  virtual bool  HandleMessage(PlayerBase* player, const Telegram& msg) = 0;
+};
+
+
+//---------------------------- FsmController -----------------------------
+//
+//  runs the player's state machine. Shared by every player
+//------------------------------------------------------------------------
+class FsmController : public PlayerController
+{
+private:
+
+  FsmController(){}
+
+  FsmController(const FsmController&);
+  FsmController& operator=(const FsmController&);
+
+public:
+
+  static FsmController* Instance();
+
+  void  Control(PlayerBase* player, double TimeStep);
+
+  bool  HandleMessage(PlayerBase* player, const Telegram& msg);
+};
+
+
+//---------------------------- ActionStream ------------------------------
+//
+//  the actions of a number of players, one frame of them per update
+//------------------------------------------------------------------------
+class ActionStream
+{
+private:
+
+  int                        m_iNumPlayers;
+
+  //frame after frame
+  std::vector<PlayerAction>  m_Actions;
+
+public:
+
+  explicit ActionStream(int NumPlayers = 0):m_iNumPlayers(NumPlayers){}
+
+  //appends a frame of NumPlayers actions
+  void  Record(const PlayerAction* actions);
+
+  void  Clear(){m_Actions.clear();}
+
+  int   NumPlayers()const{return m_iNumPlayers;}
+  int   NumFrames()const{return m_iNumPlayers > 0 ? (int)m_Actions.size() / m_iNumPlayers : 0;}
+
+  const PlayerAction* Frame(int frame)const{return &m_Actions[frame * m_iNumPlayers];}
+
+  //the stream as a file. Return false if the file could not be written or
+  //is not a stream
+  bool  Save(const std::string& filename)const;
+  bool  Load(const std::string& filename);
+};
+
+
+//--------------------------- ActionController ---------------------------
+//
+//  has its players take the actions in Actions(), one per player in the
+//  order they were added. The actions are left as they are from update to
+//  update unless changed
+//------------------------------------------------------------------------
+class ActionController : public PlayerController
+{
+private:
+
+  SoccerPitch*               m_pPitch;
+
+  std::vector<PlayerBase*>   m_Players;
+  std::vector<PlayerAction>  m_Actions;
+
+  //the index in m_Players of each player on the pitch, by state handle,
+  //or -1
+  std::vector<int>           m_Slots;
+
+  //if false the players run their state machines
+  bool                       m_bActive;
+
+  //if set, the actions of every update are recorded to this. Not owned
+  ActionStream*              m_pRecording;
+
+  ActionController(const ActionController&);
+  ActionController& operator=(const ActionController&);
+
+protected:
+
+  //called by Decide to choose the actions for the update
+  virtual void  ChooseActions(SoccerPitch* /*pitch*/){}
+
+  void          SetActive(bool active){m_bActive = active;}
+
+public:
+
+  explicit ActionController(SoccerPitch* pitch);
+
+  //gives the players back to the state machine and leaves the pitch
+  virtual ~ActionController();
+
+  //takes control of the player. The controller registers with the pitch
+  //when it is given its first
+  void  AddPlayer(PlayerBase* player);
+
+  //takes control of each of the team's players, in team order
+  void  AddTeam(SoccerTeam* team);
+
+  //records the actions taken each update from now on (NULL to stop)
+  void  SetRecording(ActionStream* stream){m_pRecording = stream;}
+
+  void  Decide(SoccerPitch* pitch);
+
+  void  Control(PlayerBase* player, double TimeStep);
+
+  bool  HandleMessage(PlayerBase* player, const Telegram& msg);
+
+  //the players' actions, in the order they were added
+  PlayerAction*  Actions(){return m_Actions.empty() ? NULL : &m_Actions[0];}
+
+  //sets every action to stand still
+  void  ClearActions();
+
+  int   NumPlayers()const{return (int)m_Players.size();}
+
+  bool  isActive()const{return m_bActive;}
+};
+
+
+//------------------------------ BatchPolicy -----------------------------
+//
+//  a policy outside the game playing a whole team. Given the team's
+//  observation (see TeamObserver.h) it writes an action for each of the
+//  team's players
+//------------------------------------------------------------------------
+class BatchPolicy
+{
+public:
+
+  virtual ~BatchPolicy(){}
+
+  virtual void  Act(const TeamObserver& observer,
+                    const float*        observation,
+                    float*              actions) = 0;
+};
+
+
+//------------------------ BatchPolicyController -------------------------
+//
+//  plays a team with a BatchPolicy, asked once per update
+//------------------------------------------------------------------------
+class BatchPolicyController : public ActionController
+{
+private:
+
+  BatchPolicy*        m_pPolicy;
+
+  TeamObserver        m_Observer;
+
+  //the length of the match in ticks, for the time left feature. 0 if
+  //the match is not of a set length
+  int                 m_iTicksPerMatch;
+
+  std::vector<float>  m_Observation;
+  std::vector<float>  m_ActionBuffer;
+
+protected:
+
+  void  ChooseActions(SoccerPitch* pitch);
+
+public:
+
+  //the policy is not owned
+  BatchPolicyController(SoccerTeam* team, BatchPolicy* policy, int TicksPerMatch = 0);
+
+  const TeamObserver& Observer()const{return m_Observer;}
+};
+
+
+//--------------------------- ReplayController ---------------------------
+//
+//  plays its players' actions back from a stream, a frame per update. The
+//  stream's players are the controller's, in the same order. Once the
+//  stream runs out the players go back to their state machines
+//------------------------------------------------------------------------
+class ReplayController : public ActionController
+{
+private:
+
+  //not owned
+  const ActionStream* m_pStream;
+
+  int                 m_iNextFrame;
+
+protected:
+
+  void  ChooseActions(SoccerPitch* pitch);
+
+public:
+
+  ReplayController(SoccerPitch* pitch, const ActionStream* stream);
+
+  //plays the stream from the given frame on
+  void  Rewind(int frame = 0);
+
+  bool  isFinished()const{return m_iNextFrame >= m_pStream->NumFrames();}
+};
+
+
+#endif
@@ -0,0 +1,243 @@
+#include "PlayerStateStore.h"
+#include "PlayerBase.h"
+#include "RegionTable.h"
+#include "SoccerTeam.h"
+#include "SoccerPitch.h"
+#include "misc/utils.h"
+
+#include <math.h>
+#include <algorithm>
+
+
+//------------------------------- Add ------------------------------------
+//------------------------------------------------------------------------
+int PlayerStateStore::Add(PlayerBase* player)
+{
+  int handle = (int)m_Players.size();
+
+  m_PosX.push_back(0.0);
+  m_PosY.push_back(0.0);
+  m_VelX.push_back(0.0);
+  m_VelY.push_back(0.0);
+  m_HeadingX.push_back(0.0);
+  m_HeadingY.push_back(0.0);
+  m_MaxSpeed.push_back(0.0);
+  m_DistSqToBall.push_back(MaxFloat);
+  m_TimeToBall.push_back(MaxDouble);
+  m_Region.push_back(-1);
+  m_Role.push_back(player->Role());
+  m_Flags.push_back(active);
+  m_Players.push_back(player);
+
+  if (player->Team()->Color() == SoccerTeam::red)
+  {
+    m_Flags[handle] |= red_team;
+  }
+
+  WriteState(handle, player, player->Pitch()->Regions());
+
+  return handle;
+}
+
+//------------------------------ Remove ----------------------------------
+//------------------------------------------------------------------------
+void PlayerStateStore::Remove(int handle)
+{
+  m_Flags[handle] &= ~active;
+
+  m_Players[handle] = NULL;
+}
+
+//---------------------------- WriteState --------------------------------
+//------------------------------------------------------------------------
+void PlayerStateStore::WriteState(int                handle,
+                                  const PlayerBase*  player,
+                                  const RegionTable& regions)
+{
+  m_PosX[handle]     = player->Pos().x;
+  m_PosY[handle]     = player->Pos().y;
+  m_VelX[handle]     = player->Velocity().x;
+  m_VelY[handle]     = player->Velocity().y;
+  m_HeadingX[handle] = player->Heading().x;
+  m_HeadingY[handle] = player->Heading().y;
+  m_MaxSpeed[handle] = player->MaxSpeed();
+  m_Role[handle]     = player->Role();
+
+  m_Region[handle]   = regions.IndexFromPos(player->Pos());
+}
+
+//----------------------------- MapRegions -------------------------------
+//------------------------------------------------------------------------
+void PlayerStateStore::MapRegions(const RegionTable& regions)
+{
+  if (m_Players.empty()) return;
+
+  regions.IndicesFromPositions(&m_PosX[0], &m_PosY[0], NumPlayers(), &m_Region[0]);
+}
+
+//---------------------------- BallRanking -------------------------------
+//------------------------------------------------------------------------
+void BallRanking::Clear()
+{
+  Nearest             = -1;
+  SecondNearest       = -1;
+  NearestDistSq       = MaxFloat;
+  SecondNearestDistSq = MaxFloat;
+  FirstToBall         = -1;
+  FirstToBallTime     = MaxDouble;
+}
+
+void BallRanking::Add(int handle, double DistSq, double TimeToBall)
+{
+  if (DistSq < NearestDistSq)
+  {
+    SecondNearest       = Nearest;
+    SecondNearestDistSq = NearestDistSq;
+
+    Nearest             = handle;
+    NearestDistSq       = DistSq;
+  }
+  else if (DistSq < SecondNearestDistSq)
+  {
+    SecondNearest       = handle;
+    SecondNearestDistSq = DistSq;
+  }
+
+  if (TimeToBall < FirstToBallTime)
+  {
+    FirstToBall     = handle;
+    FirstToBallTime = TimeToBall;
+  }
+}
+
+//----------------------------- RankByBall -------------------------------
+//
+//  a player at P running at speed s meets a ball at B moving with velocity
+//  V at the time t where |B + Vt - P| = st, which is the smallest positive
+//  root of
+//
+//    (V.V - s^2)t^2 + 2(D.V)t + D.D = 0,  where D = B - P
+//------------------------------------------------------------------------
+void PlayerStateStore::RankByBall(Vector2D BallPos, Vector2D BallVelocity)
+{
+  const int    NumPlayers = (int)m_Players.size();
+
+  const double BallSpeedSq = BallVelocity.LengthSq();
+
+  //the distances and times first, in a loop with no dependencies between
+  //players
+  for (int p=0; p<NumPlayers; ++p)
+  {
+    double ySeparation = BallPos.y - m_PosY[p];
+    double xSeparation = BallPos.x - m_PosX[p];
+
+    double c = ySeparation*ySeparation + xSeparation*xSeparation;
+    double b = 2.0 * (xSeparation*BallVelocity.x + ySeparation*BallVelocity.y);
+    double a = BallSpeedSq - m_MaxSpeed[p]*m_MaxSpeed[p];
+
+    m_DistSqToBall[p] = c;
+
+    double time = MaxDouble;
+
+    if (c == 0.0)
+    {
+      time = 0.0;
+    }
+    else if (fabs(a) < MinDouble)
+    {
+      //as fast as the ball: the player only catches it if it is coming
+      //towards him
+      if (b < 0.0) time = -c / b;
+    }
+    else
+    {
+      double discriminant = b*b - 4.0*a*c;
+
+      if (discriminant >= 0.0)
+      {
+        double root = sqrt(discriminant);
+
+        //c > 0, so if the player is the faster (a < 0) one root is
+        //positive and one negative, and if the ball is both roots have the
+        //sign of -b
+        double t1 = (-b - root) / (2.0*a);
+        double t2 = (-b + root) / (2.0*a);
+
+        if (t1 > t2) std::swap(t1, t2);
+
+        if      (t1 > 0.0) time = t1;
+        else if (t2 > 0.0) time = t2;
+      }
+    }
+
+    m_TimeToBall[p] = time;
+  }
+
+  //then the rankings
+  m_RedRanking.Clear();
+  m_BlueRanking.Clear();
+  m_PitchRanking.Clear();
+
+  for (int p=0; p<NumPlayers; ++p)
+  {
+    if (!(m_Flags[p] & active)) continue;
+
+    BallRanking& team = (m_Flags[p] & red_team) ? m_RedRanking : m_BlueRanking;
+
+    team.Add(p, m_DistSqToBall[p], m_TimeToBall[p]);
+    m_PitchRanking.Add(p, m_DistSqToBall[p], m_TimeToBall[p]);
+  }
+}
+
+//-------------------------- isAnyWithinRadius ---------------------------
+//------------------------------------------------------------------------
+bool PlayerStateStore::isAnyWithinRadius(int      first,
+                                         int      count,
+                                         Vector2D pos,
+                                         double   RadiusSq)const
+{
+  const int last = first + count;
+
+  //every player is tested rather than returning at the first hit so the
+  //loop has no early exit and can be vectorised
+  bool found = false;
+
+  for (int p=first; p<last; ++p)
+  {
+    double ySeparation = m_PosY[p] - pos.y;
+    double xSeparation = m_PosX[p] - pos.x;
+
+    bool within = (ySeparation*ySeparation + xSeparation*xSeparation) < RadiusSq;
+
+    found |= within && (m_Flags[p] & active);
+  }
+
+  return found;
+}
+
+//----------------------- isAnyInFrontWithinRadius -----------------------
+//------------------------------------------------------------------------
+bool PlayerStateStore::isAnyInFrontWithinRadius(int      first,
+                                                int      count,
+                                                Vector2D pos,
+                                                Vector2D heading,
+                                                double   RadiusSq)const
+{
+  const int last = first + count;
+
+  bool found = false;
+
+  for (int p=first; p<last; ++p)
+  {
+    double ySeparation = m_PosY[p] - pos.y;
+    double xSeparation = m_PosX[p] - pos.x;
+
+    bool InFront = (xSeparation*heading.x + ySeparation*heading.y) > 0;
+
+    bool within  = (ySeparation*ySeparation + xSeparation*xSeparation) < RadiusSq;
+
+    found |= InFront && within && (m_Flags[p] & active);
+  }
+
+  return found;
+}
@@ -0,0 +1,164 @@
+#ifndef PLAYERSTATESTORE_H
+#define PLAYERSTATESTORE_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   PlayerStateStore.h
+//
+//  Desc:   the state of every player on the pitch kept as parallel arrays
+//          (struct-of-arrays) indexed by a handle handed out when the
+//          player is added. The pitch owns one store; each player keeps
+//          its handle.
+//
+//          The team-wide queries (closest player to the ball, is an
+//          opponent within some radius, ...) scan a contiguous range of
+//          handles so they walk consecutive doubles instead of chasing
+//          player pointers, and the loops are simple enough for the
+//          compiler to vectorise.
+//
+//          A player's kinematics are written back to the store with
+//          WriteState after each of its updates, so the positions seen
+//          by the queries are always current.
+//
+//------------------------------------------------------------------------
+#include <vector>
+
+#include "2D/Vector2D.h"
+#include "constants.h"
+
+class PlayerBase;
+class RegionTable;
+
+
+//the players nearest the ball among some group of players (a team or the
+//whole pitch), and the one that can reach it soonest. Handles are -1 if
+//the group has no one to fill the place
+struct BallRanking
+{
+  int     Nearest;
+  int     SecondNearest;
+
+  //squared distances
+  double  NearestDistSq;
+  double  SecondNearestDistSq;
+
+  int     FirstToBall;
+  double  FirstToBallTime;
+
+  BallRanking(){Clear();}
+
+  void    Clear();
+
+  //considers a player for each place
+  void    Add(int handle, double DistSq, double TimeToBall);
+};
+
+
+class PlayerStateStore
+{
+public:
+
+  enum state_flags
+  {
+    active   = 1 << 0,  //cleared once the player is removed
+    red_team = 1 << 1
+  };
+
+private:
+
+  std::vector<double>                  m_PosX;
+  std::vector<double>                  m_PosY;
+  std::vector<double>                  m_VelX;
+  std::vector<double>                  m_VelY;
+  std::vector<double>                  m_HeadingX;
+  std::vector<double>                  m_HeadingY;
+
+  //the players' top speeds
+  std::vector<double>                  m_MaxSpeed;
+
+  //the distance to the ball (in squared-space) and the time to reach it,
+  //calculated once each time-step by RankByBall
+  std::vector<double>                  m_DistSqToBall;
+  std::vector<double>                  m_TimeToBall;
+
+  //the region each player is in (-1 if none), mapped for every player
+  //once per time-step by MapRegions and kept current by WriteState
+  std::vector<int>                     m_Region;
+
+  std::vector<FieldConst::player_role> m_Role;
+  std::vector<unsigned int>            m_Flags;
+
+  //the player each handle belongs to
+  std::vector<PlayerBase*>             m_Players;
+
+  //the rankings made by RankByBall
+  BallRanking                          m_RedRanking;
+  BallRanking                          m_BlueRanking;
+  BallRanking                          m_PitchRanking;
+
+  friend class MatchSnapshot;
+
+public:
+
+  //adds a player, returning its handle. Handles are allocated
+  //consecutively so the players of a team created one after the other
+  //occupy one contiguous range
+  int          Add(PlayerBase* player);
+
+  //the handle remains allocated but the player is no longer found by any
+  //query
+  void         Remove(int handle);
+
+  //copies the player's current kinematics into the store and maps it to
+  //the region it is now in
+  void         WriteState(int                handle,
+                          const PlayerBase*  player,
+                          const RegionTable& regions);
+
+  //maps every player to the region it is in
+  void         MapRegions(const RegionTable& regions);
+
+  int          NumPlayers()const{return (int)m_Players.size();}
+
+  PlayerBase*  Player(int handle)const{return m_Players[handle];}
+
+  Vector2D     Pos(int handle)const{return Vector2D(m_PosX[handle], m_PosY[handle]);}
+  Vector2D     Velocity(int handle)const{return Vector2D(m_VelX[handle], m_VelY[handle]);}
+  Vector2D     Heading(int handle)const{return Vector2D(m_HeadingX[handle], m_HeadingY[handle]);}
+  double       DistSqToBall(int handle)const{return m_DistSqToBall[handle];}
+  double       TimeToBall(int handle)const{return m_TimeToBall[handle];}
+  int          Region(int handle)const{return m_Region[handle];}
+  FieldConst::player_role Role(int handle)const{return m_Role[handle];}
+  unsigned int Flags(int handle)const{return m_Flags[handle];}
+
+  //calculates every player's distance to the ball and the time it would
+  //take to reach it, and ranks the players of each team and of the whole
+  //pitch by them. Of players equally placed the first added is ranked
+  //higher.
+  //
+  //The time to the ball is when a player running straight at its top
+  //speed would meet the ball were it to carry on at its current velocity
+  //(MaxDouble if it never would). Friction only slows the ball, so the
+  //player can do at least this well
+  void         RankByBall(Vector2D BallPos, Vector2D BallVelocity);
+
+  const BallRanking& TeamRanking(bool red)const{return red ? m_RedRanking : m_BlueRanking;}
+  const BallRanking& PitchRanking()const{return m_PitchRanking;}
+
+  //returns true if any player in the range is within sqrt(RadiusSq) of pos
+  bool         isAnyWithinRadius(int      first,
+                                 int      count,
+                                 Vector2D pos,
+                                 double   RadiusSq)const;
+
+  //returns true if any player in the range is within sqrt(RadiusSq) of pos
+  //and in front of it, where heading gives the direction of front
+  bool         isAnyInFrontWithinRadius(int      first,
+                                        int      count,
+                                        Vector2D pos,
+                                        Vector2D heading,
+                                        double   RadiusSq)const;
+};
+
+
+#endif
@@ -0,0 +1,90 @@
+#include "RegionTable.h"
+
+
+//---------------------------- FindInterval -----------------------------------
+//
+//  returns the index of the interval of edges that v lies strictly inside,
+//  or -1 if it lies on an edge or outside them all. The multiply gives the
+//  interval but may land a hair to one side of an edge, so it is checked
+//  against the edges themselves
+//-----------------------------------------------------------------------------
+static int FindInterval(double v, const std::vector<double>& edges, double InvSpacing)
+{
+  const int NumIntervals = (int)edges.size() - 1;
+
+  if (!(v > edges[0] && v < edges[NumIntervals])) return -1;
+
+  int i = (int)((v - edges[0]) * InvSpacing);
+
+  if (i >= NumIntervals) i = NumIntervals - 1;
+
+  if      (!(v > edges[i]))   --i;
+  else if (!(v < edges[i+1])) ++i;
+
+  if (!(v > edges[i] && v < edges[i+1])) return -1;
+
+  return i;
+}
+
+
+//------------------------------ Create ---------------------------------------
+//-----------------------------------------------------------------------------
+void RegionTable::Create(const Region& area, int NumColumns, int NumRows)
+{
+  const double width  = area.Width()  / (double)NumColumns;
+  const double height = area.Height() / (double)NumRows;
+
+  m_iNumColumns = NumColumns;
+  m_iNumRows    = NumRows;
+
+  m_dInvColumnWidth = 1.0 / width;
+  m_dInvRowHeight   = 1.0 / height;
+
+  m_ColumnEdges.resize(NumColumns + 1);
+  m_RowEdges.resize(NumRows + 1);
+
+  for (int col=0; col<=NumColumns; ++col) m_ColumnEdges[col] = area.Left() + col*width;
+  for (int row=0; row<=NumRows;    ++row) m_RowEdges[row]    = area.Top()  + row*height;
+
+  m_Regions.resize(NumColumns * NumRows);
+
+  //index into the table
+  int idx = Size()-1;
+
+  for (int col=0; col<NumColumns; ++col)
+  {
+    for (int row=0; row<NumRows; ++row, --idx)
+    {
+      m_Regions[idx] = Region(m_ColumnEdges[col],
+                              m_RowEdges[row],
+                              m_ColumnEdges[col+1],
+                              m_RowEdges[row+1],
+                              idx);
+    }
+  }
+}
+
+//---------------------------- IndexFromPos -----------------------------------
+//-----------------------------------------------------------------------------
+int RegionTable::IndexFromPos(Vector2D pos)const
+{
+  int col = FindInterval(pos.x, m_ColumnEdges, m_dInvColumnWidth);
+  int row = FindInterval(pos.y, m_RowEdges, m_dInvRowHeight);
+
+  if (col < 0 || row < 0) return -1;
+
+  return Size()-1 - (col*m_iNumRows + row);
+}
+
+//------------------------ IndicesFromPositions -------------------------------
+//-----------------------------------------------------------------------------
+void RegionTable::IndicesFromPositions(const double* x,
+                                       const double* y,
+                                       int           count,
+                                       int*          indices)const
+{
+  for (int i=0; i<count; ++i)
+  {
+    indices[i] = IndexFromPos(Vector2D(x[i], y[i]));
+  }
+}
@@ -0,0 +1,67 @@
+#ifndef REGIONTABLE_H
+#define REGIONTABLE_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   RegionTable.h
+//
+//  Desc:   the regions the pitch is divided into, held by value, and the
+//          mapping of a position to the region it is in.
+//
+//          The regions form a grid numbered down each column from the
+//          bottom right, so the region a position is in is found with a
+//          multiply per axis rather than a search. The answer is the same
+//          as testing Region::Inside on every region: a position on an
+//          edge between two regions, or off the pitch, is in none (-1).
+//
+//------------------------------------------------------------------------
+#include <vector>
+
+#include "Game/Region.h"
+#include "2D/Vector2D.h"
+
+
+class RegionTable
+{
+private:
+
+  std::vector<Region>  m_Regions;
+
+  int                  m_iNumColumns;
+  int                  m_iNumRows;
+
+  //the edges of the columns, left to right, and of the rows, top to
+  //bottom. These are the very values the regions were made with
+  std::vector<double>  m_ColumnEdges;
+  std::vector<double>  m_RowEdges;
+
+  double               m_dInvColumnWidth;
+  double               m_dInvRowHeight;
+
+public:
+
+  RegionTable():m_iNumColumns(0),
+                m_iNumRows(0),
+                m_dInvColumnWidth(0.0),
+                m_dInvRowHeight(0.0)
+  {}
+
+  //divides the area into NumColumns by NumRows regions
+  void           Create(const Region& area, int NumColumns, int NumRows);
+
+  int            Size()const{return (int)m_Regions.size();}
+
+  const Region&  Get(int idx)const{return m_Regions[idx];}
+
+  //returns the index of the region pos is in, or -1 if it is in none
+  int            IndexFromPos(Vector2D pos)const;
+
+  //the batch version: indices[i] is the region of (x[i], y[i])
+  void           IndicesFromPositions(const double* x,
+                                      const double* y,
+                                      int           count,
+                                      int*          indices)const;
+};
+
+
+#endif
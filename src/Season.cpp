@@ -0,0 +1,391 @@
+#include "Season.h"
+#include "MatchRunner.h"
+#include "MatchExecutor.h"
+#include "ColumnarWriter.h"
+#include "misc/utils.h"
+
+#include <fstream>
+#include <sstream>
+#include <ostream>
+#include <stdexcept>
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+
+//the number of matches a worker plays before handing its results back.
+//Big enough that the hand over costs nothing next to the matches, small
+//enough to keep every worker busy to the end of the run
+const int MatchesPerShard = 32;
+
+
+//-------------------------------- Load ---------------------------------------
+//-----------------------------------------------------------------------------
+void Season::Load(const std::string& filename)
+{
+  std::ifstream file(filename.c_str());
+
+  if (!file)
+  {
+    throw std::runtime_error("cannot open season file " + filename);
+  }
+
+  Teams.clear();
+  Fixtures.clear();
+
+  //tactics files are found relative to the season file
+  std::string directory;
+
+  std::string::size_type slash = filename.find_last_of("/\\");
+
+  if (slash != std::string::npos) directory = filename.substr(0, slash+1);
+
+  TeamConfigReader   reader(filename);
+
+  std::string        line;
+  std::string        keyword;
+  std::istringstream words;
+
+  for (int LineNumber=1; std::getline(file, line); ++LineNumber)
+  {
+    if (!SplitConfigLine(line, keyword, words)) continue;
+
+    if (reader.ReadLine(keyword, words, LineNumber))
+    {
+      if (keyword == "End") AddTeam(reader.Teams().back(), filename, LineNumber);
+    }
+
+    else if (keyword == "Tactics")
+    {
+      std::string TacticsFile;
+
+      if (!(words >> TacticsFile))
+      {
+        ThrowConfigError(filename, LineNumber, "expected Tactics <file>");
+      }
+
+      if (TacticsFile[0] != '/' && TacticsFile[0] != '\\')
+      {
+        TacticsFile = directory + TacticsFile;
+      }
+
+      std::vector<TeamConfig> teams;
+
+      LoadTactics(TacticsFile, teams);
+
+      for (unsigned int t=0; t<teams.size(); ++t)
+      {
+        AddTeam(teams[t], filename, LineNumber);
+      }
+    }
+
+    else if (keyword == "Fixture")
+    {
+      std::string home, away;
+
+      if (!(words >> home >> away))
+      {
+        ThrowConfigError(filename, LineNumber, "expected Fixture <home> <away>");
+      }
+
+      int HomeIdx = FindTeam(home);
+      int AwayIdx = FindTeam(away);
+
+      if (HomeIdx == -1) ThrowConfigError(filename, LineNumber, "unknown team " + home);
+      if (AwayIdx == -1) ThrowConfigError(filename, LineNumber, "unknown team " + away);
+
+      if (HomeIdx == AwayIdx)
+      {
+        ThrowConfigError(filename, LineNumber, "a team cannot play itself");
+      }
+
+      Fixtures.push_back(Fixture(HomeIdx, AwayIdx));
+    }
+
+    else if (keyword == "RoundRobin")
+    {
+      AddRoundRobin();
+    }
+
+    else
+    {
+      ThrowConfigError(filename, LineNumber, "unknown keyword " + keyword);
+    }
+  }
+
+  reader.Finish();
+
+  if (Fixtures.empty())
+  {
+    throw std::runtime_error(filename + ": the season has no fixtures");
+  }
+}
+
+//------------------------------- AddTeam -------------------------------------
+//-----------------------------------------------------------------------------
+void Season::AddTeam(const TeamConfig& team, const std::string& filename, int line)
+{
+  if (FindTeam(team.Name) != -1)
+  {
+    ThrowConfigError(filename, line, "team " + team.Name + " is already defined");
+  }
+
+  Teams.push_back(team);
+}
+
+//------------------------------ FindTeam -------------------------------------
+//-----------------------------------------------------------------------------
+int Season::FindTeam(const std::string& name)const
+{
+  for (unsigned int t=0; t<Teams.size(); ++t)
+  {
+    if (Teams[t].Name == name) return (int)t;
+  }
+
+  return -1;
+}
+
+//---------------------------- AddRoundRobin ----------------------------------
+//-----------------------------------------------------------------------------
+void Season::AddRoundRobin()
+{
+  for (unsigned int home=0; home<Teams.size(); ++home)
+  {
+    for (unsigned int away=0; away<Teams.size(); ++away)
+    {
+      if (home != away) Fixtures.push_back(Fixture(home, away));
+    }
+  }
+}
+
+
+//------------------------------- ctor ----------------------------------------
+//-----------------------------------------------------------------------------
+SeasonSimulator::SeasonSimulator(const Season&      season,
+                                 const MatchRunner& runner,
+                                 int                NumSeasons):m_Season(season),
+                                                                m_Runner(runner),
+                                                                m_iNumSeasons(NumSeasons > 0 ? NumSeasons : 0),
+                                                                m_FixtureTotals(season.Fixtures.size()),
+                                                                m_TeamTotals(season.Teams.size()),
+                                                                m_Table(season.Teams.size()),
+                                                                m_pResults(NULL),
+                                                                m_iFirstColumn(0)
+{}
+
+//-------------------------------- Run ----------------------------------------
+//
+//  match m is fixture m % NumFixtures of season m / NumFixtures, and is
+//  played with the runner's random stream for m, so the results do not
+//  depend on how the matches are spread over the workers. The workers
+//  play shards of consecutive matches; finished shards are held until
+//  every shard before them is in and then taken in order
+//-----------------------------------------------------------------------------
+void SeasonSimulator::Run(MatchExecutor& executor, ColumnarWriter* results)
+{
+  m_pResults = results;
+
+  if (m_pResults)
+  {
+    m_iFirstColumn = m_pResults->AddColumn("match",           ColumnarWriter::int_column);
+    m_pResults->AddColumn("season",          ColumnarWriter::int_column);
+    m_pResults->AddColumn("fixture",         ColumnarWriter::int_column);
+    m_pResults->AddColumn("home",            ColumnarWriter::int_column);
+    m_pResults->AddColumn("away",            ColumnarWriter::int_column);
+    m_pResults->AddColumn("home_goals",      ColumnarWriter::int_column);
+    m_pResults->AddColumn("away_goals",      ColumnarWriter::int_column);
+    m_pResults->AddColumn("home_possession", ColumnarWriter::double_column);
+  }
+
+  const int NumFixtures = (int)m_Season.Fixtures.size();
+  const int NumShards   = (NumMatches() + MatchesPerShard - 1) / MatchesPerShard;
+
+  std::mutex                                 mutex;
+  std::map<int, std::vector<MatchResult> >   finished;
+  int                                        NextShard = 0;
+
+  executor.ParallelFor(NumShards, [&](int shard)
+  {
+    const int first = shard * MatchesPerShard;
+    const int last  = MinOf(first + MatchesPerShard, NumMatches());
+
+    std::vector<MatchResult> played;
+
+    for (int match=first; match<last; ++match)
+    {
+      const Fixture& fixture = m_Season.Fixtures[match % NumFixtures];
+
+      played.push_back(m_Runner.Play(match,
+                                     &m_Season.Teams[fixture.Home],
+                                     &m_Season.Teams[fixture.Away]));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    finished[shard].swap(played);
+
+    //take in every shard that is now next in line
+    std::map<int, std::vector<MatchResult> >::iterator next;
+
+    while ((next = finished.find(NextShard)) != finished.end())
+    {
+      for (unsigned int r=0; r<next->second.size(); ++r)
+      {
+        TakeResult(NextShard * MatchesPerShard + r, next->second[r]);
+      }
+
+      finished.erase(next);
+
+      ++NextShard;
+    }
+  });
+
+  m_pResults = NULL;
+}
+
+//----------------------------- TakeResult ------------------------------------
+//-----------------------------------------------------------------------------
+void SeasonSimulator::TakeResult(int match, const MatchResult& result)
+{
+  const int NumFixtures = (int)m_Season.Fixtures.size();
+
+  const int      FixtureIdx = match % NumFixtures;
+  const Fixture& fixture    = m_Season.Fixtures[FixtureIdx];
+
+  //the home team plays as red
+  const int HomeGoals = result.RedGoals;
+  const int AwayGoals = result.BlueGoals;
+
+  FixtureTotals& totals = m_FixtureTotals[FixtureIdx];
+
+  totals.HomeGoals      += HomeGoals;
+  totals.AwayGoals      += AwayGoals;
+  totals.HomePossession += result.RedPossession();
+
+  TeamRecord& home = m_Table[fixture.Home];
+  TeamRecord& away = m_Table[fixture.Away];
+
+  home.GoalsFor     += HomeGoals;
+  home.GoalsAgainst += AwayGoals;
+  away.GoalsFor     += AwayGoals;
+  away.GoalsAgainst += HomeGoals;
+
+  if (HomeGoals > AwayGoals)
+  {
+    ++totals.HomeWins;
+    home.Points += 3;
+  }
+  else if (HomeGoals < AwayGoals)
+  {
+    ++totals.AwayWins;
+    away.Points += 3;
+  }
+  else
+  {
+    ++totals.Draws;
+    ++home.Points;
+    ++away.Points;
+  }
+
+  if (m_pResults)
+  {
+    int col = m_iFirstColumn;
+
+    m_pResults->SetInt(col++, match);
+    m_pResults->SetInt(col++, match / NumFixtures);
+    m_pResults->SetInt(col++, FixtureIdx);
+    m_pResults->SetInt(col++, fixture.Home);
+    m_pResults->SetInt(col++, fixture.Away);
+    m_pResults->SetInt(col++, HomeGoals);
+    m_pResults->SetInt(col++, AwayGoals);
+    m_pResults->SetDouble(col++, result.RedPossession());
+
+    m_pResults->EndRow();
+  }
+
+  if (FixtureIdx == NumFixtures - 1) EndSeason();
+}
+
+//------------------------------ EndSeason ------------------------------------
+//
+//  teams are ranked on points, then goal difference, then goals scored.
+//  Any team still level is placed by its order in the season file
+//-----------------------------------------------------------------------------
+void SeasonSimulator::EndSeason()
+{
+  std::vector<int> order(m_Table.size());
+
+  for (unsigned int t=0; t<order.size(); ++t) order[t] = (int)t;
+
+  const std::vector<TeamRecord>& table = m_Table;
+
+  std::stable_sort(order.begin(), order.end(), [&table](int a, int b)
+  {
+    const TeamRecord& ta = table[a];
+    const TeamRecord& tb = table[b];
+
+    if (ta.Points != tb.Points) return ta.Points > tb.Points;
+
+    int GDa = ta.GoalsFor - ta.GoalsAgainst;
+    int GDb = tb.GoalsFor - tb.GoalsAgainst;
+
+    if (GDa != GDb) return GDa > GDb;
+
+    return ta.GoalsFor > tb.GoalsFor;
+  });
+
+  for (unsigned int pos=0; pos<order.size(); ++pos)
+  {
+    TeamTotals&       totals = m_TeamTotals[order[pos]];
+    const TeamRecord& record = m_Table[order[pos]];
+
+    totals.Points       += record.Points;
+    totals.GoalsFor     += record.GoalsFor;
+    totals.GoalsAgainst += record.GoalsAgainst;
+    totals.Positions    += pos + 1;
+
+    if (pos == 0) ++totals.Titles;
+  }
+
+  m_Table.assign(m_Table.size(), TeamRecord());
+}
+
+//---------------------------- WriteSummary -----------------------------------
+//-----------------------------------------------------------------------------
+void SeasonSimulator::WriteSummary(std::ostream& os)const
+{
+  const double seasons = (double)MaxOf(1, m_iNumSeasons);
+
+  os << "fixture,home,away,home_win,draw,away_win,"
+        "home_goals,away_goals,home_possession\n";
+
+  for (unsigned int f=0; f<m_FixtureTotals.size(); ++f)
+  {
+    const FixtureTotals& totals  = m_FixtureTotals[f];
+    const Fixture&       fixture = m_Season.Fixtures[f];
+
+    os << f                                   << ","
+       << m_Season.Teams[fixture.Home].Name   << ","
+       << m_Season.Teams[fixture.Away].Name   << ","
+       << totals.HomeWins / seasons           << ","
+       << totals.Draws / seasons              << ","
+       << totals.AwayWins / seasons           << ","
+       << totals.HomeGoals / seasons          << ","
+       << totals.AwayGoals / seasons          << ","
+       << totals.HomePossession / seasons     << "\n";
+  }
+
+  os << "\nteam,points,goals_for,goals_against,title,position\n";
+
+  for (unsigned int t=0; t<m_TeamTotals.size(); ++t)
+  {
+    const TeamTotals& totals = m_TeamTotals[t];
+
+    os << m_Season.Teams[t].Name          << ","
+       << totals.Points / seasons         << ","
+       << totals.GoalsFor / seasons       << ","
+       << totals.GoalsAgainst / seasons   << ","
+       << totals.Titles / seasons         << ","
+       << totals.Positions / seasons      << "\n";
+  }
+}
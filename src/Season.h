@@ -0,0 +1,167 @@
+#ifndef SEASON_H
+#define SEASON_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   Season.h
+//
+//  Desc:   Monte-Carlo simulation of a season. A season file names the
+//          teams taking part, gives the make up of each, and lists the
+//          fixtures. SeasonSimulator plays the season over and over with
+//          a different random stream for every match and aggregates the
+//          results into the chances of each outcome of each fixture and
+//          of each team's finishing position.
+//
+//          The file is made up of lines of whitespace separated words.
+//          Anything after // is a comment.
+//
+//            Team <name>
+//              ... the players, as in a tactics file (see TeamConfig.h)
+//            End
+//
+//            Tactics <file>
+//            Fixture <home team> <away team>
+//            RoundRobin
+//
+//          Tactics adds every team of a tactics file, found relative to
+//          the season file. RoundRobin adds a home and an away fixture
+//          between every pair of teams defined so far. The home team plays
+//          as red.
+//
+//------------------------------------------------------------------------
+#include <vector>
+#include <string>
+#include <iosfwd>
+
+#include "TeamConfig.h"
+
+class MatchRunner;
+class MatchExecutor;
+class ColumnarWriter;
+struct MatchResult;
+
+
+struct Fixture
+{
+  //indices into the season's teams
+  int  Home;
+  int  Away;
+
+  Fixture(int home, int away):Home(home), Away(away){}
+};
+
+
+class Season
+{
+public:
+
+  std::vector<TeamConfig>  Teams;
+  std::vector<Fixture>     Fixtures;
+
+  //reads a season file. Throws a std::runtime_error naming the line at
+  //fault if the file cannot be read or is not valid
+  void  Load(const std::string& filename);
+
+  //returns the index of the named team or -1 if it isn't in the season
+  int   FindTeam(const std::string& name)const;
+
+  //adds a home and an away fixture between every pair of teams
+  void  AddRoundRobin();
+
+  //adds a team to the season. Throws, naming the line of the file it was
+  //defined on, if there is already a team of the same name
+  void  AddTeam(const TeamConfig& team, const std::string& filename, int line);
+};
+
+
+class SeasonSimulator
+{
+private:
+
+  //the totals for a fixture over every season played
+  struct FixtureTotals
+  {
+    int     HomeWins;
+    int     Draws;
+    int     AwayWins;
+
+    long    HomeGoals;
+    long    AwayGoals;
+
+    double  HomePossession;
+
+    FixtureTotals():HomeWins(0), Draws(0), AwayWins(0),
+                    HomeGoals(0), AwayGoals(0), HomePossession(0.0)
+    {}
+  };
+
+  //a team's record in one season, and its totals over every season
+  struct TeamRecord
+  {
+    int     Points;
+    int     GoalsFor;
+    int     GoalsAgainst;
+
+    TeamRecord():Points(0), GoalsFor(0), GoalsAgainst(0){}
+  };
+
+  struct TeamTotals
+  {
+    long    Points;
+    long    GoalsFor;
+    long    GoalsAgainst;
+
+    //the number of seasons the team finished top and the sum of its
+    //finishing positions (1 is top)
+    int     Titles;
+    long    Positions;
+
+    TeamTotals():Points(0), GoalsFor(0), GoalsAgainst(0),
+                 Titles(0), Positions(0)
+    {}
+  };
+
+  const Season&             m_Season;
+  const MatchRunner&        m_Runner;
+
+  //the number of times the season is played
+  int                       m_iNumSeasons;
+
+  std::vector<FixtureTotals>  m_FixtureTotals;
+  std::vector<TeamTotals>     m_TeamTotals;
+
+  //the table of the season whose results are being taken in
+  std::vector<TeamRecord>     m_Table;
+
+  //if not NULL each match's result is written here as it is taken in
+  ColumnarWriter*           m_pResults;
+  int                       m_iFirstColumn;
+
+  //adds a match's result to the totals. Must be called in match order
+  void  TakeResult(int match, const MatchResult& result);
+
+  //ranks the teams of the season just completed and adds their finishing
+  //positions to the totals
+  void  EndSeason();
+
+public:
+
+  SeasonSimulator(const Season&      season,
+                  const MatchRunner& runner,
+                  int                NumSeasons);
+
+  //the number of matches making up the whole run
+  int   NumMatches()const{return m_iNumSeasons * (int)m_Season.Fixtures.size();}
+
+  //plays every season, spreading the matches over the executor's
+  //workers. If results is given a row is written to it for every match,
+  //in match order
+  void  Run(MatchExecutor& executor, ColumnarWriter* results = NULL);
+
+  //writes the aggregated statistics of each fixture and each team as
+  //comma separated rows
+  void  WriteSummary(std::ostream& os)const;
+};
+
+
+#endif
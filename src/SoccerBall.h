@@ -1,101 +1,153 @@
-#ifndef SOCCERBALL_H
-#define SOCCERBALL_H
-#pragma warning (disable:4786)
-//------------------------------------------------------------------------
-//
-//  Name: SoccerBall.h
-//
-//  Desc: Class to implement a soccer ball. This class inherits from
-//        MovingEntity and provides further functionality for collision
-//        testing and position prediction.
-//
-//  Author: Mat Buckland 2003 (fup@ai-junkie.com)
-//
-//------------------------------------------------------------------------
-#include <vector>
-
-#include "Game/MovingEntity.h"
-#include "constants.h"
-
-
-class Wall2D;
-class PlayerBase;
-
-
-class SoccerBall : public MovingEntity
-{
-private:
-
-  //keeps a record of the ball's position at the last update
-  Vector2D                  m_vOldPos;
-
-  //a local reference to the Walls that make up the pitch boundary
-  const std::vector<Wall2D>& m_PitchBoundary;                                      
-
-
-  
-
-public:
-    //tests to see if the ball has collided with a ball and reflects 
-  //the ball's velocity accordingly
-  void TestCollisionWithWalls(const std::vector<Wall2D>& walls);
-
-  SoccerBall(Vector2D           pos,            
-             double               BallSize,
-             double               mass,
-             std::vector<Wall2D>& PitchBoundary):
-  
-      //set up the base class
-      MovingEntity(pos,
-                  BallSize,
-                  Vector2D(0,0),
-                  -1.0,                //max speed - unused
-                  Vector2D(0,1),
-                  mass,
-                  Vector2D(1.0,1.0),  //scale     - unused
-                  0,                   //turn rate - unused
-                  0),                  //max force - unused
-     m_PitchBoundary(PitchBoundary)
-  {}
-  
-  //implement base class Update
-  void      Update();
-
-  //implement base class Render
-  void      Render();
-
-  //a soccer ball doesn't need to handle messages
-  bool      HandleMessage(const Telegram& msg){return false;}
-
-  //this method applies a directional force to the ball (kicks it!)
-  void      Kick(Vector2D direction, double force);
-
-  //given a kicking force and a distance to traverse defined by start
-  //and finish points, this method calculates how long it will take the
-  //ball to cover the distance.
-  double    TimeToCoverDistance(Vector2D from,
-                               Vector2D to,
-                               double     force)const;
-
-  //this method calculates where the ball will in 'time' seconds
-  Vector2D FuturePosition(double time)const;
-
-  //this is used by players and goalkeepers to 'trap' a ball -- to stop
-  //it dead. That player is then assumed to be in possession of the ball
-  //and m_pOwner is adjusted accordingly
-  void      Trap(){m_vVelocity.Zero();}  
-
-  Vector2D  OldPos()const{return m_vOldPos;}
-  
-  //this places the ball at the desired location and sets its velocity to zero
-  void      PlaceAtPosition(Vector2D NewPos);
-};
-
-
-
-//this can be used to vary the accuracy of a player's kick.
-Vector2D AddNoiseToKick(Vector2D BallPos, Vector2D BallTarget);
-
-
-
+#ifndef SOCCERBALL_H
+#define SOCCERBALL_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name: SoccerBall.h
+//
+//  Desc: Class to implement a soccer ball. This class inherits from
+//        MovingEntity and provides further functionality for collision
+//        testing and position prediction.
+//
+//        The ball is moved by sweeping it against the pitch's walls and
+//        goalposts (see BallCollider), in sub-steps of no more than a
+//        tick, so it bounces correctly however hard it is kicked and
+//        however long the step.
+//
+//  Author: Mat Buckland 2003 (fup@ai-junkie.com)
+//
+//------------------------------------------------------------------------
+#include <vector>
+
+#include "Game/MovingEntity.h"
+#include "constants.h"
+#include "BallTrajectory.h"
+#include "BallCollider.h"
+
+
+class PlayerBase;
+
+
+class SoccerBall : public MovingEntity
+{
+private:
+
+  //keeps a record of the ball's position at the last update
+  Vector2D                  m_vOldPos;
+
+  //the path the ball took during the last update: where it started, where
+  //it bounced, and where it was at the end of each tick. Cut back to where
+  //the ball is once it is kicked, trapped or placed
+  std::vector<Vector2D>     m_Path;
+
+  //true if the ball has been kicked since it was last updated
+  bool                      m_bKicked;
+
+  //the walls and goalposts of the pitch, which the ball bounces off
+  const BallCollider&        m_Collider;
+
+  //the predicted path of the ball. Rebuilt on demand the first time it
+  //is asked for after the ball's position or velocity changes, which is
+  //once a tick while the ball is rolling
+  mutable BallTrajectory     m_Trajectory;
+
+  friend class MatchSnapshot;
+
+  void BuildTrajectory()const;
+
+  
+
+  //the longest sub-step (in ticks) the ball's movement is integrated in
+  static const double        MaxSubStep;
+
+  //applies friction to the ball and moves it for TimeStep ticks
+  void      Integrate(double TimeStep);
+
+public:
+
+  SoccerBall(Vector2D            pos,            
+             double              BallSize,
+             double              mass,
+             const BallCollider& collider):
+  
+      //set up the base class
+      MovingEntity(pos,
+                  BallSize,
+                  Vector2D(0,0),
+                  -1.0,                //max speed - unused
+                  Vector2D(0,1),
+                  mass,
+                  Vector2D(1.0,1.0),  //scale     - unused
+                  0,                   //turn rate - unused
+                  0),                  //max force - unused
+     m_bKicked(false),
+     m_Collider(collider)
+  {
+    m_Path.push_back(pos);
+
+    BuildTrajectory();
+  }
+  
+  //implement base class Update
+  void      Update(double TimeStep);
+
+  //implement base class Render
+  void      Render();
+
+  //a soccer ball doesn't need to handle messages
+  bool      HandleMessage(const Telegram& msg){return false;}
+
+  //this method applies a directional force to the ball (kicks it!)
+  void      Kick(Vector2D direction, double force);
+
+  //given a kicking force and a distance to traverse defined by start
+  //and finish points, this method calculates how long it will take the
+  //ball to cover the distance.
+  double    TimeToCoverDistance(Vector2D from,
+                               Vector2D to,
+                               double     force)const;
+
+  //as above, given the distance
+  double    TimeToCoverDistance(double distance, double force)const
+  {
+    return Trajectory().TimeToCoverDistance(distance, force);
+  }
+
+  //this method calculates where the ball will in 'time' seconds
+  Vector2D FuturePosition(double time)const
+  {
+    return Trajectory().PositionAt(time);
+  }
+
+  //the path of the ball from where it is now, for making many predictions
+  //at once (see BallTrajectory)
+  const BallTrajectory& Trajectory()const;
+
+  //this is used by players and goalkeepers to 'trap' a ball -- to stop
+  //it dead. That player is then assumed to be in possession of the ball
+  //and m_pOwner is adjusted accordingly
+  void      Trap(){m_vVelocity.Zero(); m_Path.assign(1, m_vPosition);}
+
+  Vector2D  OldPos()const{return m_vOldPos;}
+
+  bool      KickedThisUpdate()const{return m_bKicked;}
+
+  const std::vector<Vector2D>& Path()const{return m_Path;}
+
+  //if the ball was within sqrt(RangeSq) of pos at any point on its path
+  //in the last update it is moved back to the first such point, the path
+  //is cut short there and this returns true
+  bool      RewindToWithin(Vector2D pos, double RangeSq);
+  
+  //this places the ball at the desired location and sets its velocity to zero
+  void      PlaceAtPosition(Vector2D NewPos);
+};
+
+
+
+//this can be used to vary the accuracy of a player's kick.
+Vector2D AddNoiseToKick(Vector2D BallPos, Vector2D BallTarget);
+
+
+
 #endif
\ No newline at end of file
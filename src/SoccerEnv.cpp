@@ -0,0 +1,246 @@
+#include "SoccerEnv.h"
+#include "SoccerPitch.h"
+#include "SoccerTeam.h"
+#include "PlayerController.h"
+#include "TeamObserver.h"
+#include "ParamLoader.h"
+#include "Game/GameWorld.h"
+
+#include <math.h>
+#include <cassert>
+
+
+//------------------------------- ctor ----------------------------------------
+//
+//  the pitch is made and the snapshot of the kick off taken with the
+//  environment's world bound to the calling thread
+//-----------------------------------------------------------------------------
+SoccerEnv::SoccerEnv(const EnvSettings& settings,
+                     unsigned long long seed):m_Settings(settings),
+                                              m_pWorld(new GameWorld()),
+                                              m_pPitch(NULL),
+                                              m_pController(NULL),
+                                              m_pObserver(NULL),
+                                              m_iUpdates(0)
+{
+  ScopedGameWorld bind(m_pWorld);
+
+  m_pWorld->GetRandom()->Seed(seed);
+
+  m_pPitch = new SoccerPitch(WindowWidth,
+                             WindowHeight,
+                             settings.TimeStep,
+                             settings.RedConfig,
+                             settings.BlueConfig);
+
+  m_pLearner = settings.LearnerIsRed ? m_pPitch->RedTeam() : m_pPitch->BlueTeam();
+
+  m_pController = new ActionController(m_pPitch);
+  m_pController->AddTeam(m_pLearner);
+
+  m_pObserver = new TeamObserver(m_pLearner);
+
+  int UpdatesPerStep = MaxOf(1, settings.UpdatesPerStep);
+
+  m_iUpdatesPerEpisode = (int)ceil(settings.TicksPerEpisode / settings.TimeStep);
+
+  //an episode is a whole number of steps
+  m_iUpdatesPerEpisode = UpdatesPerStep * MaxOf(1, (m_iUpdatesPerEpisode + UpdatesPerStep - 1) / UpdatesPerStep);
+
+  m_KickOff.Take(*m_pPitch);
+}
+
+//------------------------------- dtor ----------------------------------------
+//-----------------------------------------------------------------------------
+SoccerEnv::~SoccerEnv()
+{
+  {
+    ScopedGameWorld bind(m_pWorld);
+
+    delete m_pObserver;
+    delete m_pController;
+    delete m_pPitch;
+  }
+
+  delete m_pWorld;
+}
+
+//------------------------------- Reset ---------------------------------------
+//-----------------------------------------------------------------------------
+void SoccerEnv::Reset(unsigned long long seed)
+{
+  ScopedGameWorld bind(m_pWorld);
+
+  m_KickOff.Restore(*m_pPitch);
+
+  m_pWorld->GetRandom()->Seed(seed);
+
+  m_pController->ClearActions();
+
+  m_iUpdates = 0;
+}
+
+//-------------------------------- Step ---------------------------------------
+//
+//  the actions are turned from the learner's frame into the pitch's
+//-----------------------------------------------------------------------------
+float SoccerEnv::Step(const float* actions, float* observation, bool& done)
+{
+  ScopedGameWorld bind(m_pWorld);
+
+  m_pObserver->ReadActions(actions, m_pController->Actions());
+
+  const int GoalsBefore = GoalDifference();
+
+  const int UpdatesPerStep = MaxOf(1, m_Settings.UpdatesPerStep);
+
+  for (int update=0; update<UpdatesPerStep && !isOver(); ++update)
+  {
+    m_pPitch->Update();
+
+    ++m_iUpdates;
+
+    if (m_Settings.EndOnGoal && GoalDifference() != GoalsBefore) break;
+  }
+
+  float reward = (float)(GoalDifference() - GoalsBefore);
+
+  done = isOver() || (m_Settings.EndOnGoal && reward != 0.0f);
+
+  Observe(observation);
+
+  return reward;
+}
+
+//------------------------------- isOver --------------------------------------
+//-----------------------------------------------------------------------------
+bool SoccerEnv::isOver()const
+{
+  return m_iUpdates >= m_iUpdatesPerEpisode;
+}
+
+//---------------------------- GoalDifference ---------------------------------
+//-----------------------------------------------------------------------------
+int SoccerEnv::GoalDifference()const
+{
+  return m_pObserver->GoalsFor() - m_pObserver->GoalsAgainst();
+}
+
+//-------------------------- ObservationSize ----------------------------------
+//-----------------------------------------------------------------------------
+int SoccerEnv::ObservationSize()const
+{
+  return m_pObserver->ObservationSize();
+}
+
+int SoccerEnv::ActionSize()const
+{
+  return m_pObserver->ActionSize();
+}
+
+int SoccerEnv::NumLearnerPlayers()const
+{
+  return m_pObserver->NumPlayers();
+}
+
+//------------------------------- Observe -------------------------------------
+//-----------------------------------------------------------------------------
+void SoccerEnv::Observe(float* observation)const
+{
+  m_pObserver->Observe(observation, 1.0 - (double)m_iUpdates / m_iUpdatesPerEpisode);
+}
+
+
+//--------------------------- SoccerVecEnv ctor -------------------------------
+//
+//  each environment's pitch is made with a seed of its own
+//-----------------------------------------------------------------------------
+SoccerVecEnv::SoccerVecEnv(int                NumEnvs,
+                           const EnvSettings& settings,
+                           int                NumThreads):m_Executor(NumThreads),
+                                                          m_Seed(0),
+                                                          m_pActions(NULL)
+{
+  assert (NumEnvs > 0 && "<SoccerVecEnv::SoccerVecEnv>: no environments");
+
+  for (int env=0; env<NumEnvs; ++env)
+  {
+    m_Envs.push_back(new SoccerEnv(settings, EpisodeSeed(env, 0)));
+  }
+
+  m_Observations.resize(NumEnvs * ObservationSize());
+  m_Rewards.resize(NumEnvs);
+  m_Dones.resize(NumEnvs);
+  m_Episodes.resize(NumEnvs);
+}
+
+SoccerVecEnv::~SoccerVecEnv()
+{
+  for (unsigned int env=0; env<m_Envs.size(); ++env)
+  {
+    delete m_Envs[env];
+  }
+}
+
+//----------------------------- EpisodeSeed -----------------------------------
+//-----------------------------------------------------------------------------
+unsigned long long SoccerVecEnv::EpisodeSeed(int env, int episode)const
+{
+  unsigned long long seed = m_Seed;
+
+  seed = RandomStream::SplitMix64(seed) + (unsigned long long)env;
+  seed = RandomStream::SplitMix64(seed) + (unsigned long long)episode;
+
+  return RandomStream::SplitMix64(seed);
+}
+
+//-------------------------------- Reset --------------------------------------
+//-----------------------------------------------------------------------------
+void SoccerVecEnv::Reset(unsigned long long seed)
+{
+  m_Seed = seed;
+
+  const int size = ObservationSize();
+
+  for (unsigned int env=0; env<m_Envs.size(); ++env)
+  {
+    m_Episodes[env] = 0;
+
+    m_Envs[env]->Reset(EpisodeSeed(env, m_Episodes[env]));
+
+    m_Envs[env]->Observe(&m_Observations[env * size]);
+
+    m_Rewards[env] = 0.0f;
+    m_Dones[env]   = 0;
+  }
+}
+
+//-------------------------------- Step ---------------------------------------
+//-----------------------------------------------------------------------------
+void SoccerVecEnv::Step(const float* actions)
+{
+  m_pActions = actions;
+
+  m_Executor.ParallelFor(NumEnvs(), [this](int env){StepEnv(env);});
+
+  m_pActions = NULL;
+}
+
+void SoccerVecEnv::StepEnv(int env)
+{
+  SoccerEnv* e = m_Envs[env];
+
+  float* observation = &m_Observations[env * e->ObservationSize()];
+
+  bool done;
+
+  m_Rewards[env] = e->Step(m_pActions + env * e->ActionSize(), observation, done);
+  m_Dones[env]   = done ? 1 : 0;
+
+  if (done)
+  {
+    e->Reset(EpisodeSeed(env, ++m_Episodes[env]));
+
+    e->Observe(observation);
+  }
+}
@@ -0,0 +1,202 @@
+#ifndef SOCCERENV_H
+#define SOCCERENV_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   SoccerEnv.h
+//
+//  Desc:   the simulator as an environment for reinforcement learning.
+//          One team (the learner) is played by a policy outside the game,
+//          which is given an observation of the pitch each step and
+//          answers with an action for each of the learner's players; the
+//          other team plays as usual.
+//
+//          Observations and actions are flat arrays of floats in the
+//          learner's frame, laid out as TeamObserver.h describes. The
+//          learner's players are given to an ActionController (see
+//          PlayerController.h) whose actions each step writes.
+//
+//          The reward of a step is the number of goals the learner scored
+//          in it less the number it conceded.
+//
+//          An environment owns its world and pitch, both made once. Reset
+//          restores a snapshot of the kick off (see MatchSnapshot.h) and
+//          reseeds the world's random stream, and Step writes into the
+//          caller's arrays, so neither allocates.
+//
+//          SoccerVecEnv steps several environments in lockstep over a pool
+//          of threads, each environment in its own world.
+//
+//------------------------------------------------------------------------
+#include <vector>
+
+#include "MatchSnapshot.h"
+#include "MatchExecutor.h"
+
+class GameWorld;
+class SoccerPitch;
+class SoccerTeam;
+class TeamConfig;
+class TeamObserver;
+class ActionController;
+
+
+struct EnvSettings
+{
+  //the length of an episode in ticks (see MatchRunner.h)
+  int     TicksPerEpisode;
+
+  //the ticks each update of the pitch moves the match on by (more than
+  //0 and no more than MaxTimeStep), and the number of updates each step
+  //repeats the action for
+  double  TimeStep;
+  int     UpdatesPerStep;
+
+  //the learner plays red unless this is false
+  bool    LearnerIsRed;
+
+  //if true an episode also ends when a goal is scored
+  bool    EndOnGoal;
+
+  //the teams. NULL plays the default team of the colour
+  const TeamConfig* RedConfig;
+  const TeamConfig* BlueConfig;
+
+  EnvSettings():TicksPerEpisode(60 * 60),
+                TimeStep(1.0),
+                UpdatesPerStep(1),
+                LearnerIsRed(true),
+                EndOnGoal(false),
+                RedConfig(NULL),
+                BlueConfig(NULL)
+  {}
+};
+
+
+class SoccerEnv
+{
+private:
+
+  EnvSettings               m_Settings;
+
+  GameWorld*                m_pWorld;
+  SoccerPitch*              m_pPitch;
+
+  SoccerTeam*               m_pLearner;
+
+  //plays the learner's players, and sees the pitch as the learner does.
+  //Both are made with the pitch and destroyed before it
+  ActionController*         m_pController;
+  TeamObserver*             m_pObserver;
+
+  //the pitch at kick off, restored by Reset
+  MatchSnapshot             m_KickOff;
+
+  int                       m_iUpdatesPerEpisode;
+  int                       m_iUpdates;
+
+  //the learner's goals less the opponents'
+  int   GoalDifference()const;
+
+  SoccerEnv(const SoccerEnv&);
+  SoccerEnv& operator=(const SoccerEnv&);
+
+public:
+
+  //seed seeds the world's random stream while the pitch is made
+  explicit SoccerEnv(const EnvSettings& settings, unsigned long long seed = 0);
+
+  ~SoccerEnv();
+
+  //starts a new episode from the kick off, drawing its random numbers
+  //from a stream seeded with seed
+  void  Reset(unsigned long long seed);
+
+  //has the learner's players take the given actions (ActionSize floats)
+  //for the step and writes the observation after it (ObservationSize
+  //floats). Returns the reward; done is set once the episode is over,
+  //after which Reset must be called before the next step
+  float Step(const float* actions, float* observation, bool& done);
+
+  //writes the current observation
+  void  Observe(float* observation)const;
+
+  int   ObservationSize()const;
+  int   ActionSize()const;
+
+  int   NumLearnerPlayers()const;
+
+  //the layout of the observations and actions
+  const TeamObserver& Observer()const{return *m_pObserver;}
+
+  bool  isOver()const;
+
+  SoccerPitch*  Pitch()const{return m_pPitch;}
+  GameWorld*    World()const{return m_pWorld;}
+};
+
+
+//----------------------------- SoccerVecEnv -----------------------------
+//
+//  NumEnvs environments stepped together. The observations, rewards and
+//  done flags of all of them are kept in arrays laid out environment
+//  after environment. An environment whose episode ends is reset at once
+//  (with a seed drawn from the vector's seed, the environment and the
+//  number of its episode), so the observation written for it is the first
+//  of its next episode
+//------------------------------------------------------------------------
+class SoccerVecEnv
+{
+private:
+
+  std::vector<SoccerEnv*>     m_Envs;
+
+  MatchExecutor               m_Executor;
+
+  std::vector<float>          m_Observations;
+  std::vector<float>          m_Rewards;
+  std::vector<unsigned char>  m_Dones;
+
+  //the number of episodes each environment has started
+  std::vector<int>            m_Episodes;
+
+  unsigned long long          m_Seed;
+
+  //the actions of the step in progress
+  const float*                m_pActions;
+
+  unsigned long long  EpisodeSeed(int env, int episode)const;
+
+  void  StepEnv(int env);
+
+  SoccerVecEnv(const SoccerVecEnv&);
+  SoccerVecEnv& operator=(const SoccerVecEnv&);
+
+public:
+
+  //NumThreads <= 0 uses one thread per hardware thread
+  SoccerVecEnv(int NumEnvs, const EnvSettings& settings, int NumThreads = 0);
+
+  ~SoccerVecEnv();
+
+  //resets every environment
+  void  Reset(unsigned long long seed);
+
+  //steps every environment. actions holds ActionSize floats for each
+  void  Step(const float* actions);
+
+  int   NumEnvs()const{return (int)m_Envs.size();}
+  int   NumThreads()const{return m_Executor.NumThreads();}
+
+  int   ObservationSize()const{return m_Envs[0]->ObservationSize();}
+  int   ActionSize()const{return m_Envs[0]->ActionSize();}
+
+  const float*          Observations()const{return &m_Observations[0];}
+  const float*          Rewards()const{return &m_Rewards[0];}
+  const unsigned char*  Dones()const{return &m_Dones[0];}
+
+  SoccerEnv*  Env(int env)const{return m_Envs[env];}
+};
+
+
+#endif
@@ -1,250 +1,402 @@
-#include "SoccerPitch.h"
-#include "SoccerBall.h"
-#include "Goal.h"
-#include "Game/Region.h"
-#include "2D/Transformations.h"
-#include "2D/Geometry.h"
-#include "SoccerTeam.h"
-#include "Debug/DebugConsole.h"
-#include "Game/EntityManager.h"
-#include "ParamLoader.h"
-#include "PlayerBase.h"
-#include "TeamStates.h"
-#include "misc/FrameCounter.h"
-
-//const int NumRegionsHorizontal = 6; 
-//const int NumRegionsVertical   = 3;
-
-//------------------------------- ctor -----------------------------------
-//------------------------------------------------------------------------
-SoccerPitch::SoccerPitch(int cx, int cy):m_cxClient(cx),
-                                         m_cyClient(cy),
-                                         m_bPaused(false),
-                                         m_bGoalKeeperHasBall(false),
-                                         m_Regions(FieldConst::NumRegionsHorizontal*FieldConst::NumRegionsVertical),
-                                         m_bGameOn(true)
-{
-  //define the playing area
-  m_pPlayingArea = new Region(20, 20, cx-20, cy-20);
-
-  //create the regions  
-  CreateRegions(PlayingArea()->Width() / (double)FieldConst::NumRegionsHorizontal,
-                PlayingArea()->Height() / (double)FieldConst::NumRegionsVertical);
-
-  //create the goals
-   m_pRedGoal  = new Goal(Vector2D( m_pPlayingArea->Left(), (cy-Prm.GoalWidth)/2),
-                          Vector2D(m_pPlayingArea->Left(), cy - (cy-Prm.GoalWidth)/2),
-                          Vector2D(1,0));
-   
-
-
-  m_pBlueGoal = new Goal( Vector2D( m_pPlayingArea->Right(), (cy-Prm.GoalWidth)/2),
-                          Vector2D(m_pPlayingArea->Right(), cy - (cy-Prm.GoalWidth)/2),
-                          Vector2D(-1,0));
-
-
-  //create the soccer ball
-  m_pBall = new SoccerBall(Vector2D((double)m_cxClient/2.0, (double)m_cyClient/2.0),
-                           Prm.BallSize,
-                           Prm.BallMass,
-                           m_vecWalls);
-
-  
-  //create the teams 
-  m_pRedTeam  = new SoccerTeam(m_pRedGoal, m_pBlueGoal, this, SoccerTeam::red);
-  m_pBlueTeam = new SoccerTeam(m_pBlueGoal, m_pRedGoal, this, SoccerTeam::blue);
-
-  //make sure each team knows who their opponents are
-  m_pRedTeam->SetOpponents(m_pBlueTeam);
-  m_pBlueTeam->SetOpponents(m_pRedTeam); 
-
-  //create the walls
-  Vector2D TopLeft(m_pPlayingArea->Left(), m_pPlayingArea->Top());                                        
-  Vector2D TopRight(m_pPlayingArea->Right(), m_pPlayingArea->Top());
-  Vector2D BottomRight(m_pPlayingArea->Right(), m_pPlayingArea->Bottom());
-  Vector2D BottomLeft(m_pPlayingArea->Left(), m_pPlayingArea->Bottom());
-                                      
-  m_vecWalls.push_back(Wall2D(BottomLeft, m_pRedGoal->RightPost()));
-  m_vecWalls.push_back(Wall2D(m_pRedGoal->LeftPost(), TopLeft));
-  m_vecWalls.push_back(Wall2D(TopLeft, TopRight));
-  m_vecWalls.push_back(Wall2D(TopRight, m_pBlueGoal->LeftPost()));
-  m_vecWalls.push_back(Wall2D(m_pBlueGoal->RightPost(), BottomRight));
-  m_vecWalls.push_back(Wall2D(BottomRight, BottomLeft));
-
-  ParamLoader* p = ParamLoader::Instance();
-}
-
-//-------------------------------- dtor ----------------------------------
-//------------------------------------------------------------------------
-SoccerPitch::~SoccerPitch()
-{
-  delete m_pBall;
-
-  delete m_pRedTeam;
-  delete m_pBlueTeam;
-
-  delete m_pRedGoal;
-  delete m_pBlueGoal;
-
-  delete m_pPlayingArea;
-
-  for (unsigned int i=0; i<m_Regions.size(); ++i)
-  {
-    delete m_Regions[i];
-  }
-}
-
-//----------------------------- Update -----------------------------------
-//
-//  this demo works on a fixed frame rate (60 by default) so we don't need
-//  to pass a time_elapsed as a parameter to the game entities
-//------------------------------------------------------------------------
-void SoccerPitch::Update()
-{
-  if (m_bPaused) return;
-
-  static int tick = 0;
-
-  //update the balls
-  m_pBall->Update();
-
-  //update the teams
-  m_pRedTeam->Update();
-  m_pBlueTeam->Update();
-
-  //if a goal has been detected reset the pitch ready for kickoff
-  if (m_pBlueGoal->Scored(m_pBall) || m_pRedGoal->Scored(m_pBall) ||
-        PlayingArea()->Inside(m_pBall->Pos()) == FALSE)
-  {
-    //m_bGameOn = false;
-    SetGameOff();
-    
-    //reset the ball                                                      
-    m_pBall->PlaceAtPosition(Vector2D((double)m_cxClient/2.0, (double)m_cyClient/2.0));
-
-    //get the teams ready for kickoff
-    m_pRedTeam->GetFSM()->ChangeState(PrepareForKickOff::Instance());
-    m_pBlueTeam->GetFSM()->ChangeState(PrepareForKickOff::Instance());
-  }
-}
-
-//------------------------- CreateRegions --------------------------------
-void SoccerPitch::CreateRegions(double width, double height)
-{  
-  //index into the vector
-  int idx = m_Regions.size()-1;
-    
-  for (int col=0; col<FieldConst::NumRegionsHorizontal; ++col)
-  {
-    for (int row=0; row<FieldConst::NumRegionsVertical; ++row)
-    {
-      m_Regions[idx--] = new Region(PlayingArea()->Left()+col*width,
-                                   PlayingArea()->Top()+row*height,
-                                   PlayingArea()->Left()+(col+1)*width,
-                                   PlayingArea()->Top()+(row+1)*height,
-                                   idx);
-    }
-  }
-}
-
-int SoccerPitch::GetRegionIndexFromPos(Vector2D pos)
-{
-	/*
-	std::vector<Region*>::const_iterator cit = m_Regions.begin();
-	while (cit != m_Regions.end())
-	{
-		if (*cit != NULL && (*cit)->Inside(pos) ) {
-
-		}
-	}
-	*/
-	for (size_t id = 0; id < m_Regions.size(); ++id) {
-		if (m_Regions[id] != NULL && (m_Regions[id])->Inside(pos)) {
-			return id;
-		}
-	}
-
-	return -1;
-}
-
-bool SoccerPitch::InSameRegion(const MovingEntity * entity1, const MovingEntity * entity2)
-{
-	if (entity1 == NULL || entity2 == NULL)
-	{
-		return FALSE;
-	}
-
-	if (GetRegionIndexFromPos(entity1->Pos()) == GetRegionIndexFromPos(entity2->Pos()))
-	{
-		return TRUE;
-	}
-	
-	return false;
-}
-
-//------------------------------ Render ----------------------------------
-//------------------------------------------------------------------------
-bool SoccerPitch::Render()
-{
-  //draw the grass
-  gdi->DarkGreenPen();
-  gdi->DarkGreenBrush();
-  gdi->Rect(0,0,m_cxClient, m_cyClient);
-
-  //render regions
-  if (Prm.bRegions)
-  {   
-    for (unsigned int r=0; r<m_Regions.size(); ++r)
-    {
-      m_Regions[r]->Render(true);
-    }
-  }
-  
-  //render the goals
-  gdi->HollowBrush();
-  gdi->RedPen();
-  gdi->Rect(m_pPlayingArea->Left(), (m_cyClient-Prm.GoalWidth)/2, m_pPlayingArea->Left()+40, m_cyClient - (m_cyClient-Prm.GoalWidth)/2);
-
-  gdi->BluePen();
-  gdi->Rect(m_pPlayingArea->Right(), (m_cyClient-Prm.GoalWidth)/2, m_pPlayingArea->Right()-40, m_cyClient - (m_cyClient-Prm.GoalWidth)/2);
-  
-  //render the pitch markings
-  gdi->WhitePen();
-  gdi->Circle(m_pPlayingArea->Center(), m_pPlayingArea->Width() * 0.125);
-  gdi->Line(m_pPlayingArea->Center().x, m_pPlayingArea->Top(), m_pPlayingArea->Center().x, m_pPlayingArea->Bottom());
-  gdi->WhiteBrush();
-  gdi->Circle(m_pPlayingArea->Center(), 2.0);
-
-
-  //the ball
-  gdi->WhitePen();
-  gdi->WhiteBrush();
-  m_pBall->Render();
-  
-  //Render the teams
-  m_pRedTeam->Render();
-  m_pBlueTeam->Render(); 
-
-  //render the walls
-  gdi->WhitePen();
-  for (unsigned int w=0; w<m_vecWalls.size(); ++w)
-  {
-    m_vecWalls[w].Render();
-  }
-
-  //show the score
-  gdi->TextColor(Cgdi::red);
-  gdi->TextAtPos((m_cxClient/2)-50, m_cyClient-18, "Red: " + ttos(m_pBlueGoal->NumGoalsScored()));
-
-  gdi->TextColor(Cgdi::blue);
-  gdi->TextAtPos((m_cxClient/2)+10, m_cyClient-18, "Blue: " + ttos(m_pRedGoal->NumGoalsScored()));
-
-  return true;  
-}
-
-
-
-
-
-
-
+#include "SoccerPitch.h"
+#include "SoccerBall.h"
+#include "Goal.h"
+#include "Game/Region.h"
+#include "2D/Transformations.h"
+#include "2D/geometry.h"
+#include "SoccerTeam.h"
+#include "Debug/DebugConsole.h"
+#include "Game/EntityManager.h"
+#include "ParamLoader.h"
+#include "PlayerBase.h"
+#include "TeamStates.h"
+#include "misc/FrameCounter.h"
+#include "Time/SimClock.h"
+#include "Messaging/MessageDispatcher.h"
+#include "MatchReplay.h"
+#include "TickProfiler.h"
+#include "TeamConfig.h"
+#include "PlayerController.h"
+
+#include <algorithm>
+
+//const int NumRegionsHorizontal = 6; 
+//const int NumRegionsVertical   = 3;
+
+//--------------------------- PlayerGridDrift ----------------------------
+//
+//  the furthest a player can move between builds of the player grid: one
+//  update at the top speed of the fastest player a team may have (twice
+//  the default's), but never less than the view distance
+//------------------------------------------------------------------------
+static double PlayerGridDrift(double TimeStep)
+{
+  double MaxSpeed = 2.0 * MaxOf(Prm.PlayerMaxSpeedWithBall, Prm.PlayerMaxSpeedWithoutBall);
+
+  return MaxOf(Prm.ViewDistance, MaxSpeed * TimeStep);
+}
+
+//------------------------------- ctor -----------------------------------
+//------------------------------------------------------------------------
+SoccerPitch::SoccerPitch(int               cx,
+                         int               cy,
+                         double            TimeStep,
+                         const TeamConfig* RedConfig,
+                         const TeamConfig* BlueConfig):m_PlayerGrid(0, 0, cx, cy,
+                                                                    2.0 * Prm.ViewDistance,
+                                                                    PlayerGridDrift(TimeStep)),
+                                                       m_iBallRegion(-1),
+                                                       m_bGoalKeeperHasBall(false),
+                                                       m_bGameOn(true),
+                                                       m_bPaused(false),
+                                                       m_pReplay(NULL),
+                                                       m_dTimeStep(TimeStep),
+                                                       m_cxClient(cx),
+                                                       m_cyClient(cy)
+{
+  assert (TimeStep > 0.0 && TimeStep <= MaxTimeStep &&
+          "<SoccerPitch::SoccerPitch>: time step out of range");
+
+  //every match starts at time zero. This must be done before the players
+  //are created because their regulators are timed from the clock, which
+  //advances by m_dTimeStep ticks each update
+  SimTime->Reset(Prm.FrameRate, m_dTimeStep);
+
+  //define the playing area
+  m_pPlayingArea = new Region(20, 20, cx-20, cy-20);
+
+  //create the regions  
+  CreateRegions();
+
+  //create the goals
+   m_pRedGoal  = new Goal(Vector2D( m_pPlayingArea->Left(), (cy-Prm.GoalWidth)/2),
+                          Vector2D(m_pPlayingArea->Left(), cy - (cy-Prm.GoalWidth)/2),
+                          Vector2D(1,0));
+   
+
+
+  m_pBlueGoal = new Goal( Vector2D( m_pPlayingArea->Right(), (cy-Prm.GoalWidth)/2),
+                          Vector2D(m_pPlayingArea->Right(), cy - (cy-Prm.GoalWidth)/2),
+                          Vector2D(-1,0));
+
+
+  //create the soccer ball
+  m_pBall = new SoccerBall(Vector2D((double)m_cxClient/2.0, (double)m_cyClient/2.0),
+                           Prm.BallSize,
+                           Prm.BallMass,
+                           m_BallCollider);
+
+  
+  //create the teams 
+  m_pRedTeam  = new SoccerTeam(m_pRedGoal, m_pBlueGoal, this, SoccerTeam::red,
+                               RedConfig ? *RedConfig : TeamConfig::DefaultRed());
+  m_pBlueTeam = new SoccerTeam(m_pBlueGoal, m_pRedGoal, this, SoccerTeam::blue,
+                               BlueConfig ? *BlueConfig : TeamConfig::DefaultBlue());
+
+  //make sure each team knows who their opponents are
+  m_pRedTeam->SetOpponents(m_pBlueTeam);
+  m_pBlueTeam->SetOpponents(m_pRedTeam); 
+
+  //create the walls
+  Vector2D TopLeft(m_pPlayingArea->Left(), m_pPlayingArea->Top());                                        
+  Vector2D TopRight(m_pPlayingArea->Right(), m_pPlayingArea->Top());
+  Vector2D BottomRight(m_pPlayingArea->Right(), m_pPlayingArea->Bottom());
+  Vector2D BottomLeft(m_pPlayingArea->Left(), m_pPlayingArea->Bottom());
+                                      
+  m_vecWalls.push_back(Wall2D(BottomLeft, m_pRedGoal->RightPost()));
+  m_vecWalls.push_back(Wall2D(m_pRedGoal->LeftPost(), TopLeft));
+  m_vecWalls.push_back(Wall2D(TopLeft, TopRight));
+  m_vecWalls.push_back(Wall2D(TopRight, m_pBlueGoal->LeftPost()));
+  m_vecWalls.push_back(Wall2D(m_pBlueGoal->RightPost(), BottomRight));
+  m_vecWalls.push_back(Wall2D(BottomRight, BottomLeft));
+
+  for (unsigned int w=0; w<m_vecWalls.size(); ++w)
+  {
+    m_BallCollider.AddWall(m_vecWalls[w]);
+  }
+
+  //the ends of the walls at the goal mouths
+  m_BallCollider.AddPost(m_pRedGoal->LeftPost());
+  m_BallCollider.AddPost(m_pRedGoal->RightPost());
+  m_BallCollider.AddPost(m_pBlueGoal->LeftPost());
+  m_BallCollider.AddPost(m_pBlueGoal->RightPost());
+
+  m_PlayerGrid.Build(m_Players);
+
+  ParamLoader* p = ParamLoader::Instance();
+}
+
+//-------------------------------- dtor ----------------------------------
+//------------------------------------------------------------------------
+SoccerPitch::~SoccerPitch()
+{
+  delete m_pBall;
+
+  delete m_pRedTeam;
+  delete m_pBlueTeam;
+
+  delete m_pRedGoal;
+  delete m_pBlueGoal;
+
+  delete m_pPlayingArea;
+}
+
+//------------------------------ AddPlayer -------------------------------
+//------------------------------------------------------------------------
+int SoccerPitch::AddPlayer(PlayerBase* player)
+{
+  m_Players.push_back(player);
+
+  return m_PlayerStates.Add(player);
+}
+
+//----------------------------- RemovePlayer -----------------------------
+//------------------------------------------------------------------------
+void SoccerPitch::RemovePlayer(PlayerBase* player)
+{
+  m_Players.remove(player);
+
+  m_PlayerStates.Remove(player->StateHandle());
+}
+
+//----------------------------- Update -----------------------------------
+//
+//  moves the match on by m_dTimeStep ticks. The parameters are all given
+//  per tick at a fixed frame rate (60 by default), so the entities are
+//  passed the length of the update in ticks rather than in seconds
+//------------------------------------------------------------------------
+void SoccerPitch::Update()
+{
+  if (m_bPaused) return;
+
+  PROFILE_SCOPE(zone_tick);
+
+  //advance the simulation clock and send any telegrams now due
+  SimTime->Update();
+
+  m_Events.SetTick(SimTime->GetCurrentTick());
+
+  {
+    PROFILE_SCOPE(zone_message_dispatch);
+
+    Dispatcher->DispatchDelayedMessages();
+  }
+
+  //sort the players into the grid used for neighbourhood queries. The
+  //players move as they are updated, which the grid allows for so long as
+  //none moves further than the view distance in one update
+  m_PlayerGrid.Build(m_Players);
+
+  //update the balls
+  {
+    PROFILE_SCOPE(zone_ball_update);
+
+    m_pBall->Update(m_dTimeStep);
+  }
+
+  //map everyone to the region they are in. A player's region is kept up
+  //to date as it moves (see PlayerStateStore::WriteState)
+  m_PlayerStates.MapRegions(m_Regions);
+
+  BallRegionIndex();
+
+  //and rank them by how near they are to the ball, for both teams at once
+  m_PlayerStates.RankByBall(m_pBall->Pos(), m_pBall->Velocity());
+
+  //let the controllers of players not run by their state machines decide
+  //for all their players at once, now everything they might look at is up
+  //to date
+  for (unsigned int c=0; c<m_Controllers.size(); ++c)
+  {
+    m_Controllers[c]->Decide(this);
+  }
+
+  //update the teams. The team updated first gets to react to the ball
+  //first, which over a long update is a real advantage, so when the
+  //updates are longer than a tick the teams take turns going first
+  if (m_dTimeStep > 1.0 && (SimTime->GetCurrentTick() & 1))
+  {
+    m_pBlueTeam->Update(m_dTimeStep);
+    m_pRedTeam->Update(m_dTimeStep);
+  }
+  else
+  {
+    m_pRedTeam->Update(m_dTimeStep);
+    m_pBlueTeam->Update(m_dTimeStep);
+  }
+
+  //a team scores by putting the ball in the opponent's goal
+  bool RedScored  = m_pBlueGoal->Scored(m_pBall);
+  bool BlueScored = !RedScored && m_pRedGoal->Scored(m_pBall);
+
+  if ((RedScored || BlueScored) && m_Events.isActive())
+  {
+    MatchEvent e(MatchEvent::goal);
+
+    e.Team = RedScored ? SoccerTeam::red : SoccerTeam::blue;
+    e.x    = m_pBall->Pos().x;
+    e.y    = m_pBall->Pos().y;
+
+    m_Events.Publish(e);
+  }
+
+  //if a goal has been detected reset the pitch ready for kickoff
+  if (RedScored || BlueScored || PlayingArea()->Inside(m_pBall->Pos()) == FALSE)
+  {
+    //m_bGameOn = false;
+    SetGameOff();
+    
+    //reset the ball                                                      
+    m_pBall->PlaceAtPosition(Vector2D((double)m_cxClient/2.0, (double)m_cyClient/2.0));
+
+    //get the teams ready for kickoff
+    m_pRedTeam->GetFSM()->ChangeState(PrepareForKickOff::Instance());
+    m_pBlueTeam->GetFSM()->ChangeState(PrepareForKickOff::Instance());
+  }
+
+  if (m_pReplay)
+  {
+    m_pReplay->RecordTick(this);
+  }
+}
+
+//--------------------------- SetReplayWriter ----------------------------
+//------------------------------------------------------------------------
+void SoccerPitch::SetReplayWriter(ReplayWriter* replay)
+{
+  m_pReplay = replay;
+
+  Dispatcher->SetObserver(replay);
+}
+
+//---------------------------- AddController -----------------------------
+//------------------------------------------------------------------------
+void SoccerPitch::AddController(PlayerController* controller)
+{
+  if (std::find(m_Controllers.begin(), m_Controllers.end(), controller) == m_Controllers.end())
+  {
+    m_Controllers.push_back(controller);
+  }
+}
+
+void SoccerPitch::RemoveController(PlayerController* controller)
+{
+  m_Controllers.erase(std::remove(m_Controllers.begin(), m_Controllers.end(), controller),
+                      m_Controllers.end());
+}
+
+//------------------------- CreateRegions --------------------------------
+void SoccerPitch::CreateRegions()
+{  
+  m_Regions.Create(*PlayingArea(),
+                   FieldConst::NumRegionsHorizontal,
+                   FieldConst::NumRegionsVertical);
+}
+
+//------------------------- BallRegionIndex ------------------------------
+//------------------------------------------------------------------------
+int SoccerPitch::BallRegionIndex()const
+{
+  if (m_pBall->Pos() != m_vBallRegionPos)
+  {
+    m_vBallRegionPos = m_pBall->Pos();
+    m_iBallRegion    = GetRegionIndexFromPos(m_vBallRegionPos);
+  }
+
+  return m_iBallRegion;
+}
+
+bool SoccerPitch::InSameRegion(const MovingEntity * entity1, const MovingEntity * entity2)const
+{
+	if (entity1 == NULL || entity2 == NULL)
+	{
+		return FALSE;
+	}
+
+	if (GetRegionIndexFromPos(entity1->Pos()) == GetRegionIndexFromPos(entity2->Pos()))
+	{
+		return TRUE;
+	}
+	
+	return false;
+}
+
+//------------------------------ Render ----------------------------------
+//------------------------------------------------------------------------
+bool SoccerPitch::Render()
+{
+  //draw the grass
+  gdi->DarkGreenPen();
+  gdi->DarkGreenBrush();
+  gdi->Rect(0,0,m_cxClient, m_cyClient);
+
+  //render regions
+  if (Prm.bRegions)
+  {   
+    for (int r=0; r<m_Regions.Size(); ++r)
+    {
+      m_Regions.Get(r).Render(true);
+    }
+  }
+  
+  //render the goals
+  gdi->HollowBrush();
+  gdi->RedPen();
+  gdi->Rect(m_pPlayingArea->Left(), (m_cyClient-Prm.GoalWidth)/2, m_pPlayingArea->Left()+40, m_cyClient - (m_cyClient-Prm.GoalWidth)/2);
+
+  gdi->BluePen();
+  gdi->Rect(m_pPlayingArea->Right(), (m_cyClient-Prm.GoalWidth)/2, m_pPlayingArea->Right()-40, m_cyClient - (m_cyClient-Prm.GoalWidth)/2);
+  
+  //render the pitch markings
+  gdi->WhitePen();
+  gdi->Circle(m_pPlayingArea->Center(), m_pPlayingArea->Width() * 0.125);
+  gdi->Line(m_pPlayingArea->Center().x, m_pPlayingArea->Top(), m_pPlayingArea->Center().x, m_pPlayingArea->Bottom());
+  gdi->WhiteBrush();
+  gdi->Circle(m_pPlayingArea->Center(), 2.0);
+
+
+  //the ball
+  gdi->WhitePen();
+  gdi->WhiteBrush();
+  m_pBall->Render();
+  
+  //Render the teams
+  m_pRedTeam->Render();
+  m_pBlueTeam->Render(); 
+
+  //render the walls
+  gdi->WhitePen();
+  for (unsigned int w=0; w<m_vecWalls.size(); ++w)
+  {
+    m_vecWalls[w].Render();
+  }
+
+  //show the score
+  gdi->TextColor(Cgdi::red);
+  gdi->TextAtPos((m_cxClient/2)-50, m_cyClient-18, "Red: " + ttos(m_pBlueGoal->NumGoalsScored()));
+
+  gdi->TextColor(Cgdi::blue);
+  gdi->TextAtPos((m_cxClient/2)+10, m_cyClient-18, "Blue: " + ttos(m_pRedGoal->NumGoalsScored()));
+
+  //show where the time of a tick goes
+  if (Prm.bViewProfile)
+  {
+    std::vector<std::string> lines = TickProf->ReportLines();
+
+    gdi->TextColor(Cgdi::white);
+
+    for (unsigned int l=0; l<lines.size(); ++l)
+    {
+      gdi->TextAtPos(50, 25 + 14*(int)l, lines[l]);
+    }
+  }
+
+  return true;  
+}
+
+
+
+
+
+
+
@@ -1,115 +1,208 @@
-#ifndef SOCCERPITCH_H
-#define SOCCERPITCH_H
-#pragma warning (disable:4786)
-//------------------------------------------------------------------------
-//
-//  Name:   SoccerPitch.h
-//
-//  Desc:   A SoccerPitch is the main game object. It owns instances of
-//          two soccer teams, two goals, the playing area, the ball
-//          etc. This is the root class for all the game updates and
-//          renders etc
-//
-//  Author: Mat Buckland 2003 (fup@ai-junkie.com)
-//
-//------------------------------------------------------------------------
-#include <windows.h>
-#include <vector>
-#include <cassert>
-
-#include "2D/Wall2D.h"
-#include "2D/Vector2D.h"
-#include "constants.h"
-
-class Region;
-class Goal;
-class SoccerTeam;
-class SoccerBall;
-class MovingEntity;
-class SoccerTeam;
-class PlayerBase;
-
-
-class SoccerPitch
-{ 
-public:
-
-  SoccerBall*          m_pBall;
-
-  SoccerTeam*          m_pRedTeam;
-  SoccerTeam*          m_pBlueTeam;
-
-  Goal*                m_pRedGoal;
-  Goal*                m_pBlueGoal;
-   
-  //container for the boundary walls
-  std::vector<Wall2D>  m_vecWalls;
-
-  //defines the dimensions of the playing area
-  Region*              m_pPlayingArea;
-
-  //the playing field is broken up into regions that the team
-  //can make use of to implement strategies.
-  std::vector<Region*> m_Regions;
-
-  //true if a goal keeper has possession
-  bool                 m_bGoalKeeperHasBall;
-
-  //true if the game is in play. Set to false whenever the players
-  //are getting ready for kickoff
-  bool                 m_bGameOn;
-
-  //set true to pause the motion
-  bool                 m_bPaused;
-
-  //local copy of client window dimensions
-  int                  m_cxClient,
-                       m_cyClient;  
-  
-  //this instantiates the regions the players utilize to  position
-  //themselves
-  void CreateRegions(double width, double height);
-
-
-public:
-
-  SoccerPitch(int cxClient, int cyClient);
-
-  ~SoccerPitch();
-
-  void  Update();
-
-  bool  Render();
-
-  void  TogglePause(){m_bPaused = !m_bPaused;}
-  bool  Paused()const{return m_bPaused;}
-
-  int   cxClient()const{return m_cxClient;}
-  int   cyClient()const{return m_cyClient;}
-
-  bool  GoalKeeperHasBall()const{return m_bGoalKeeperHasBall;}
-  void  SetGoalKeeperHasBall(bool b){m_bGoalKeeperHasBall = b;}
-
-  const Region*const         PlayingArea()const{return m_pPlayingArea;}
-  const std::vector<Wall2D>& Walls(){return m_vecWalls;}                      
-  SoccerBall*const           Ball()const{return m_pBall;}
-
-  const Region* const GetRegionFromIndex(int idx)                                
-  {
-    assert ( (idx >= 0) && (idx < (int)m_Regions.size()) );
-
-    return m_Regions[idx];
-  }
-
-  int GetRegionIndexFromPos(Vector2D pos);
-
-  //to judge if two entities in same region
-  bool InSameRegion(const MovingEntity *entity1, const MovingEntity *entity2);
-
-  bool  GameOn()const{return m_bGameOn;}
-  void  SetGameOn(){m_bGameOn = true;}
-  void  SetGameOff(){m_bGameOn = false;}
-
-};
-
+#ifndef SOCCERPITCH_H
+#define SOCCERPITCH_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   SoccerPitch.h
+//
+//  Desc:   A SoccerPitch is the main game object. It owns instances of
+//          two soccer teams, two goals, the playing area, the ball
+//          etc. This is the root class for all the game updates and
+//          renders etc
+//
+//  Author: Mat Buckland 2003 (fup@ai-junkie.com)
+//
+//------------------------------------------------------------------------
+#ifdef HEADLESS
+#include "misc/HeadlessWin32.h"
+#else
+#include <windows.h>
+#endif
+#include <vector>
+#include <list>
+#include <cassert>
+
+#include "2D/Wall2D.h"
+#include "2D/Vector2D.h"
+#include "misc/SpatialGrid.h"
+#include "PlayerStateStore.h"
+#include "BallCollider.h"
+#include "RegionTable.h"
+#include "MatchEvents.h"
+#include "constants.h"
+
+class Region;
+class Goal;
+class SoccerTeam;
+class SoccerBall;
+class MovingEntity;
+class SoccerTeam;
+class PlayerBase;
+class ReplayWriter;
+class TeamConfig;
+class PlayerController;
+
+
+class SoccerPitch
+{ 
+public:
+
+  SoccerBall*          m_pBall;
+
+  SoccerTeam*          m_pRedTeam;
+  SoccerTeam*          m_pBlueTeam;
+
+  Goal*                m_pRedGoal;
+  Goal*                m_pBlueGoal;
+   
+  //container for the boundary walls
+  std::vector<Wall2D>  m_vecWalls;
+
+  //the walls and goalposts prepared for sweeping the ball against
+  BallCollider         m_BallCollider;
+
+  //every player on the pitch, of both teams, in order of creation
+  std::list<PlayerBase*> m_Players;
+
+  //the players sorted into a grid at the start of each update, for
+  //finding a player's neighbours
+  SpatialGrid<PlayerBase*> m_PlayerGrid;
+
+  //the state of every player, indexed by the handle each player is given
+  //when it is added to the pitch
+  PlayerStateStore     m_PlayerStates;
+
+  //defines the dimensions of the playing area
+  Region*              m_pPlayingArea;
+
+  //the playing field is broken up into regions that the team
+  //can make use of to implement strategies.
+  RegionTable          m_Regions;
+
+  //the region the ball is in and the position it was worked out for. The
+  //ball is mapped once per update, after it moves, and again if anything
+  //moves it during the update
+  mutable int          m_iBallRegion;
+  mutable Vector2D     m_vBallRegionPos;
+
+  //true if a goal keeper has possession
+  bool                 m_bGoalKeeperHasBall;
+
+  //true if the game is in play. Set to false whenever the players
+  //are getting ready for kickoff
+  bool                 m_bGameOn;
+
+  //set true to pause the motion
+  bool                 m_bPaused;
+
+  //the controllers asked to decide once per update, before the teams are
+  //updated (see PlayerController.h). Not owned
+  std::vector<PlayerController*> m_Controllers;
+
+  //if set, each update is recorded to this replay. Not owned
+  ReplayWriter*        m_pReplay;
+
+  //the events of the match are published on this
+  MatchEventBus        m_Events;
+
+  //the number of ticks (of 1/Prm.FrameRate seconds, the rate all the
+  //per tick parameters are given for) each update moves the match on by.
+  //1 runs the match as designed; larger steps, up to MaxTimeStep, run it
+  //faster and coarser
+  double               m_dTimeStep;
+
+  //local copy of client window dimensions
+  int                  m_cxClient,
+                       m_cyClient;  
+  
+  //this instantiates the regions the players utilize to  position
+  //themselves
+  void CreateRegions();
+
+
+public:
+
+  //the red team plays at home. A team with no config is made up as the
+  //default team of its colour
+  SoccerPitch(int               cxClient,
+              int               cyClient,
+              double            TimeStep   = 1.0,
+              const TeamConfig* RedConfig  = NULL,
+              const TeamConfig* BlueConfig = NULL);
+
+  ~SoccerPitch();
+
+  void  Update();
+
+  bool  Render();
+
+  //records every update from now on to the replay (NULL to stop). The
+  //writer is also told of every telegram delivered in this pitch's world
+  void  SetReplayWriter(ReplayWriter* replay);
+
+  //controllers of several players register to be asked to decide for
+  //all of them once per update. A controller must leave before the pitch
+  //is destroyed
+  void  AddController(PlayerController* controller);
+  void  RemoveController(PlayerController* controller);
+
+  //subscribe a ring to this to be sent the events of the match
+  MatchEventBus&  Events(){return m_Events;}
+
+  void  TogglePause(){m_bPaused = !m_bPaused;}
+  bool  Paused()const{return m_bPaused;}
+
+  double TimeStep()const{return m_dTimeStep;}
+
+  int   cxClient()const{return m_cxClient;}
+  int   cyClient()const{return m_cyClient;}
+
+  bool  GoalKeeperHasBall()const{return m_bGoalKeeperHasBall;}
+  void  SetGoalKeeperHasBall(bool b){m_bGoalKeeperHasBall = b;}
+
+  const Region*const         PlayingArea()const{return m_pPlayingArea;}
+  const std::vector<Wall2D>& Walls(){return m_vecWalls;}                      
+  SoccerBall*const           Ball()const{return m_pBall;}
+
+  SoccerTeam*const           RedTeam()const{return m_pRedTeam;}
+  SoccerTeam*const           BlueTeam()const{return m_pBlueTeam;}
+  Goal*const                 RedGoal()const{return m_pRedGoal;}
+  Goal*const                 BlueGoal()const{return m_pBlueGoal;}
+
+  //players add themselves when created and remove themselves when
+  //destroyed
+  //adds a player, returning its handle into the player state store
+  int                        AddPlayer(PlayerBase* player);
+  void                       RemovePlayer(PlayerBase* player);
+  std::list<PlayerBase*>&    AllPlayers(){return m_Players;}
+
+  const SpatialGrid<PlayerBase*>& PlayerGrid()const{return m_PlayerGrid;}
+
+  PlayerStateStore&          PlayerStates(){return m_PlayerStates;}
+  const PlayerStateStore&    PlayerStates()const{return m_PlayerStates;}
+
+  const Region* const GetRegionFromIndex(int idx)const
+  {
+    assert ( (idx >= 0) && (idx < m_Regions.Size()) );
+
+    return &m_Regions.Get(idx);
+  }
+
+  const RegionTable& Regions()const{return m_Regions;}
+
+  //returns the index of the region pos is in, or -1 if it is in none
+  int GetRegionIndexFromPos(Vector2D pos)const{return m_Regions.IndexFromPos(pos);}
+
+  //the region the ball is in
+  int BallRegionIndex()const;
+
+  //to judge if two entities in same region
+  bool InSameRegion(const MovingEntity *entity1, const MovingEntity *entity2)const;
+
+  bool  GameOn()const{return m_bGameOn;}
+  void  SetGameOn(){m_bGameOn = true;}
+  void  SetGameOff(){m_bGameOn = false;}
+
+};
+
 #endif
\ No newline at end of file
@@ -1,314 +1,426 @@
-#include "SteeringBehaviors.h"
-#include "PlayerBase.h"
-#include "2D/Transformations.h"
-#include "misc/utils.h"
-#include "SoccerTeam.h"
-#include "misc/autolist.h"
-#include "ParamLoader.h"
-#include "SoccerBall.h"
-
-
-using std::string;
-using std::vector;
-
-//------------------------- ctor -----------------------------------------
-//
-//------------------------------------------------------------------------
-SteeringBehaviors::SteeringBehaviors(PlayerBase*  agent,
-                                     SoccerPitch* world,
-                                     SoccerBall*  ball):
-                                  
-             m_pPlayer(agent),
-             m_iFlags(0),
-             m_dMultSeparation(Prm.SeparationCoefficient),
-             m_bTagged(false),
-             m_dViewDistance(Prm.ViewDistance),
-             m_pBall(ball),
-             m_dInterposeDist(0.0),
-             m_Antenna(5,Vector2D())
-{
-}
-
-//--------------------- AccumulateForce ----------------------------------
-//
-//  This function calculates how much of its max steering force the 
-//  vehicle has left to apply and then applies that amount of the
-//  force to add.
-//------------------------------------------------------------------------
-bool SteeringBehaviors::AccumulateForce(Vector2D &sf, Vector2D ForceToAdd)
-{
-  //first calculate how much steering force we have left to use
-  double MagnitudeSoFar = sf.Length();
-
-  double magnitudeRemaining = m_pPlayer->MaxForce() - MagnitudeSoFar;
-
-  //return false if there is no more force left to use
-  if (magnitudeRemaining <= 0.0) return false;
-
-  //calculate the magnitude of the force we want to add
-  double MagnitudeToAdd = ForceToAdd.Length();
-  
-  //now calculate how much of the force we can really add  
-  if (MagnitudeToAdd > magnitudeRemaining)
-  {
-    MagnitudeToAdd = magnitudeRemaining;
-  }
-
-  //add it to the steering force
-  sf += (Vec2DNormalize(ForceToAdd) * MagnitudeToAdd); 
-  
-  return true;
-}
-
-//---------------------- Calculate ---------------------------------------
-//
-//  calculates the overall steering force based on the currently active
-//  steering behaviors. 
-//------------------------------------------------------------------------
-Vector2D SteeringBehaviors::Calculate()
-{                                                                         
-  //reset the force
-  m_vSteeringForce.Zero();
-
-  //this will hold the value of each individual steering force
-  m_vSteeringForce = SumForces();
-
-  //make sure the force doesn't exceed the vehicles maximum allowable
-  m_vSteeringForce.Truncate(m_pPlayer->MaxForce());
-
-  return m_vSteeringForce;
-}
-
-//-------------------------- SumForces -----------------------------------
-//
-//  this method calls each active steering behavior and acumulates their
-//  forces until the max steering force magnitude is reached at which
-//  time the function returns the steering force accumulated to that 
-//  point
-//------------------------------------------------------------------------
-Vector2D SteeringBehaviors::SumForces()
-{
-   Vector2D force;
-  
-  //the soccer players must always tag their neighbors
-   FindNeighbours();
-
-  if (On(separation))
-  {
-    force += Separation() * m_dMultSeparation;
-
-    if (!AccumulateForce(m_vSteeringForce, force)) return m_vSteeringForce;
-  }    
-
-  if (On(seek))
-  {
-    force += Seek(m_vTarget);
-
-    if (!AccumulateForce(m_vSteeringForce, force)) return m_vSteeringForce;
-  }
-
-  if (On(arrive))
-  {
-    force += Arrive(m_vTarget, fast);
-
-    if (!AccumulateForce(m_vSteeringForce, force)) return m_vSteeringForce;
-  }
-
-  if (On(pursuit))
-  {
-    force += Pursuit(m_pBall);
-
-    if (!AccumulateForce(m_vSteeringForce, force)) return m_vSteeringForce;
-  }
-
-  if (On(interpose))
-  {
-    force += Interpose(m_pBall, m_vTarget, m_dInterposeDist);
-
-    if (!AccumulateForce(m_vSteeringForce, force)) return m_vSteeringForce;
-  }
-
-  return m_vSteeringForce;
-}
-
-//------------------------- ForwardComponent -----------------------------
-//
-//  calculates the forward component of the steering force
-//------------------------------------------------------------------------
-double SteeringBehaviors::ForwardComponent()
-{
-  return m_pPlayer->Heading().Dot(m_vSteeringForce);
-}
-
-//--------------------------- SideComponent ------------------------------
-//
-//  //  calculates the side component of the steering force
-//------------------------------------------------------------------------
-double SteeringBehaviors::SideComponent()
-{
-  return m_pPlayer->Side().Dot(m_vSteeringForce) * m_pPlayer->MaxTurnRate();
-}
-
-
-//------------------------------- Seek -----------------------------------
-//
-//  Given a target, this behavior returns a steering force which will
-//  allign the agent with the target and move the agent in the desired
-//  direction
-//------------------------------------------------------------------------
-Vector2D SteeringBehaviors::Seek(Vector2D target)
-{
- 
-  Vector2D DesiredVelocity = Vec2DNormalize(target - m_pPlayer->Pos())
-                            * m_pPlayer->MaxSpeed();
-
-  return (DesiredVelocity - m_pPlayer->Velocity());
-}
-
-
-//--------------------------- Arrive -------------------------------------
-//
-//  This behavior is similar to seek but it attempts to arrive at the
-//  target with a zero velocity
-//------------------------------------------------------------------------
-Vector2D SteeringBehaviors::Arrive(Vector2D    target,
-                                   Deceleration deceleration)
-{
-  Vector2D ToTarget = target - m_pPlayer->Pos();
-
-  //calculate the distance to the target
-  double dist = ToTarget.Length();
-
-  if (dist > 0)
-  {
-    //because Deceleration is enumerated as an int, this value is required
-    //to provide fine tweaking of the deceleration..
-    const double DecelerationTweaker = 0.3;
-
-    //calculate the speed required to reach the target given the desired
-    //deceleration
-    double speed =  dist / ((double)deceleration * DecelerationTweaker);                    
-
-    //make sure the velocity does not exceed the max
-    speed = min(speed, m_pPlayer->MaxSpeed());
-
-    //from here proceed just like Seek except we don't need to normalize 
-    //the ToTarget vector because we have already gone to the trouble
-    //of calculating its length: dist. 
-    Vector2D DesiredVelocity =  ToTarget * speed / dist;
-
-    return (DesiredVelocity - m_pPlayer->Velocity());
-  }
-
-  return Vector2D(0,0);
-}
-
-
-//------------------------------ Pursuit ---------------------------------
-//
-//  this behavior creates a force that steers the agent towards the 
-//  ball
-//------------------------------------------------------------------------
-Vector2D SteeringBehaviors::Pursuit(const SoccerBall* ball)
-{
-  Vector2D ToBall = ball->Pos() - m_pPlayer->Pos();
- 
-  //the lookahead time is proportional to the distance between the ball
-  //and the pursuer; 
-  double LookAheadTime = 0.0;
-
-  if (ball->Speed() != 0.0)
-  {
-    LookAheadTime = ToBall.Length() / ball->Speed();
-  }
-
-  //calculate where the ball will be at this time in the future
-  m_vTarget = ball->FuturePosition(LookAheadTime);
-
-  //now seek to the predicted future position of the ball
-  return Arrive(m_vTarget, fast);
-}
-
-
-//-------------------------- FindNeighbours ------------------------------
-//
-//  tags any vehicles within a predefined radius
-//------------------------------------------------------------------------
-void SteeringBehaviors::FindNeighbours()
-{
-  std::list<PlayerBase*>& AllPlayers = AutoList<PlayerBase>::GetAllMembers();
-  std::list<PlayerBase*>::iterator curPlyr;
-  for (curPlyr = AllPlayers.begin(); curPlyr!=AllPlayers.end(); ++curPlyr)
-  {
-    //first clear any current tag
-    (*curPlyr)->Steering()->UnTag();
-
-    //work in distance squared to avoid sqrts
-    Vector2D to = (*curPlyr)->Pos() - m_pPlayer->Pos();
-
-    if (to.LengthSq() < (m_dViewDistance * m_dViewDistance))
-    {
-      (*curPlyr)->Steering()->Tag();
-    }
-  }//next
-}
-
-
-//---------------------------- Separation --------------------------------
-//
-// this calculates a force repelling from the other neighbors
-//------------------------------------------------------------------------
-Vector2D SteeringBehaviors::Separation()
-{  
-   //iterate through all the neighbors and calculate the vector from the
-  Vector2D SteeringForce;
-  
-  std::list<PlayerBase*>& AllPlayers = AutoList<PlayerBase>::GetAllMembers();
-  std::list<PlayerBase*>::iterator curPlyr;
-  for (curPlyr = AllPlayers.begin(); curPlyr!=AllPlayers.end(); ++curPlyr)
-  {
-    //make sure this agent isn't included in the calculations and that
-    //the agent is close enough
-    if((*curPlyr != m_pPlayer) && (*curPlyr)->Steering()->Tagged())
-    {
-      Vector2D ToAgent = m_pPlayer->Pos() - (*curPlyr)->Pos();
-
-      //scale the force inversely proportional to the agents distance  
-      //from its neighbor.
-      SteeringForce += Vec2DNormalize(ToAgent)/ToAgent.Length();
-    }
-  }
-
-  return SteeringForce;
-}
-
-  
-//--------------------------- Interpose ----------------------------------
-//
-//  Given an opponent and an object position this method returns a 
-//  force that attempts to position the agent between them
-//------------------------------------------------------------------------
-Vector2D SteeringBehaviors::Interpose(const SoccerBall* ball,
-                                      Vector2D  target,
-                                      double     DistFromTarget)
-{
-  return Arrive(target + Vec2DNormalize(ball->Pos() - target) * 
-                DistFromTarget, normal);
-}
-
-
-//----------------------------- RenderAids -------------------------------
-//
-//------------------------------------------------------------------------
-void SteeringBehaviors::RenderAids( )
-{ 
-  //render the steering force
-  gdi->RedPen();
-
-  gdi->Line(m_pPlayer->Pos(), m_pPlayer->Pos() + m_vSteeringForce * 20);
-
-
-  
-}
-
-
+#include "SteeringBehaviors.h"
+#include "PlayerBase.h"
+#include "2D/Transformations.h"
+#include "misc/utils.h"
+#include "SoccerTeam.h"
+#include "SoccerPitch.h"
+#include "ParamLoader.h"
+#include "SoccerBall.h"
+#include "TickProfiler.h"
+
+#include <algorithm>
+#include <limits>
+
+
+using std::string;
+using std::vector;
+
+//------------------------- ctor -----------------------------------------
+//
+//------------------------------------------------------------------------
+SteeringBehaviors::SteeringBehaviors(PlayerBase*  agent,
+                                     SoccerPitch* /*world*/,
+                                     SoccerBall*  ball):
+                                  
+             m_pPlayer(agent),
+             m_pBall(ball),
+             m_dInterposeDist(0.0),
+             m_dMultSeparation(Prm.SeparationCoefficient),
+             m_dViewDistance(Prm.ViewDistance),
+             m_dTimeStep(1.0),
+             m_dVelocityGain(1.0),
+             m_iFlags(0),
+             m_Antenna(5,Vector2D())
+{
+}
+
+//--------------------- AccumulateForce ----------------------------------
+//
+//  This function calculates how much of its max steering force the 
+//  vehicle has left to apply and then applies that amount of the
+//  force to add.
+//
+//  MagnitudeSoFar is the length of sf, kept by the caller so it isn't
+//  found again on every call. It is brought up to date only if the
+//  caller has more forces to add
+//------------------------------------------------------------------------
+bool SteeringBehaviors::AccumulateForce(Vector2D &sf,
+                                        Vector2D  ForceToAdd,
+                                        double&   MagnitudeSoFar,
+                                        bool      MoreToAdd)
+{
+  //first calculate how much steering force we have left to use
+  double magnitudeRemaining = m_pPlayer->MaxForce() - MagnitudeSoFar;
+
+  //return false if there is no more force left to use
+  if (magnitudeRemaining <= 0.0) return false;
+
+  //calculate the magnitude of the force we want to add
+  double length = ForceToAdd.Length();
+
+  double MagnitudeToAdd = length;
+  
+  //now calculate how much of the force we can really add  
+  if (MagnitudeToAdd > magnitudeRemaining)
+  {
+    MagnitudeToAdd = magnitudeRemaining;
+  }
+
+  //normalize the force with the length already found (as Vec2DNormalize
+  //would) and add it to the steering force
+  if (length > std::numeric_limits<double>::epsilon())
+  {
+    ForceToAdd.x /= length;
+    ForceToAdd.y /= length;
+  }
+
+  sf += ForceToAdd * MagnitudeToAdd;
+
+  if (MoreToAdd) MagnitudeSoFar = sf.Length();
+  
+  return true;
+}
+
+//---------------------- Calculate ---------------------------------------
+//
+//  calculates the overall steering force based on the currently active
+//  steering behaviors. 
+//
+//  Seek and Arrive ask for the difference between the desired and actual
+//  velocity, which the player's mass turns into a change of 1/mass of the
+//  gap each tick. Over an update of TimeStep ticks the gap would shrink to
+//  (1 - 1/mass)^TimeStep of itself, so the force is scaled to do the same
+//  in one go once the player multiplies it by TimeStep
+//------------------------------------------------------------------------
+Vector2D SteeringBehaviors::Calculate(double TimeStep)
+{                                                                         
+  PROFILE_SCOPE(zone_steering);
+
+  if (TimeStep != m_dTimeStep)
+  {
+    m_dTimeStep = TimeStep;
+
+    if (TimeStep == 1.0)
+    {
+      m_dVelocityGain = 1.0;
+    }
+    else
+    {
+      double mass = m_pPlayer->Mass();
+
+      m_dVelocityGain = mass * (1.0 - pow(1.0 - 1.0/mass, TimeStep)) / TimeStep;
+    }
+  }
+
+  //reset the force
+  m_vSteeringForce.Zero();
+
+  //sum the forces of the behaviors that are on
+  m_vSteeringForce = (this->*s_Kernels[m_iFlags])();
+
+  //make sure the force doesn't exceed the vehicles maximum allowable
+  m_vSteeringForce.Truncate(m_pPlayer->MaxForce());
+
+  return m_vSteeringForce;
+}
+
+//-------------------------- SumForces -----------------------------------
+//
+//  this method calls each active steering behavior and acumulates their
+//  forces until the max steering force magnitude is reached at which
+//  time the function returns the steering force accumulated to that 
+//  point.
+//
+//  There is a version for each combination of behaviors, with the flags
+//  fixed when it is compiled, so each one runs only its own behaviors
+//  and finds the neighbours only if separation needs them. Each force is
+//  added to the ones before it, as it always has been, before it is
+//  accumulated
+//------------------------------------------------------------------------
+template <int Flags>
+Vector2D SteeringBehaviors::SumForces()
+{
+  Vector2D force;
+
+  double   MagnitudeSoFar = 0.0;
+
+  if (Flags & separation)
+  {
+    FindNeighbours();
+
+    force += Separation() * m_dMultSeparation;
+
+    if (!AccumulateForce(m_vSteeringForce, force, MagnitudeSoFar,
+                         (Flags & (seek | arrive | pursuit | interpose)) != 0))
+    {
+      return m_vSteeringForce;
+    }
+  }    
+
+  if (Flags & seek)
+  {
+    force += Seek(m_vTarget);
+
+    if (!AccumulateForce(m_vSteeringForce, force, MagnitudeSoFar,
+                         (Flags & (arrive | pursuit | interpose)) != 0))
+    {
+      return m_vSteeringForce;
+    }
+  }
+
+  if (Flags & arrive)
+  {
+    force += Arrive(m_vTarget, fast);
+
+    if (!AccumulateForce(m_vSteeringForce, force, MagnitudeSoFar,
+                         (Flags & (pursuit | interpose)) != 0))
+    {
+      return m_vSteeringForce;
+    }
+  }
+
+  if (Flags & pursuit)
+  {
+    force += Pursuit(m_pBall);
+
+    if (!AccumulateForce(m_vSteeringForce, force, MagnitudeSoFar,
+                         (Flags & interpose) != 0))
+    {
+      return m_vSteeringForce;
+    }
+  }
+
+  if (Flags & interpose)
+  {
+    force += Interpose(m_pBall, m_vTarget, m_dInterposeDist);
+
+    AccumulateForce(m_vSteeringForce, force, MagnitudeSoFar, false);
+  }
+
+  return m_vSteeringForce;
+}
+
+//the versions of SumForces, indexed by the behavior flags
+const SteeringBehaviors::SumForcesKernel SteeringBehaviors::s_Kernels[num_kernels] =
+{
+  &SteeringBehaviors::SumForces<0>,  &SteeringBehaviors::SumForces<1>,
+  &SteeringBehaviors::SumForces<2>,  &SteeringBehaviors::SumForces<3>,
+  &SteeringBehaviors::SumForces<4>,  &SteeringBehaviors::SumForces<5>,
+  &SteeringBehaviors::SumForces<6>,  &SteeringBehaviors::SumForces<7>,
+  &SteeringBehaviors::SumForces<8>,  &SteeringBehaviors::SumForces<9>,
+  &SteeringBehaviors::SumForces<10>, &SteeringBehaviors::SumForces<11>,
+  &SteeringBehaviors::SumForces<12>, &SteeringBehaviors::SumForces<13>,
+  &SteeringBehaviors::SumForces<14>, &SteeringBehaviors::SumForces<15>,
+  &SteeringBehaviors::SumForces<16>, &SteeringBehaviors::SumForces<17>,
+  &SteeringBehaviors::SumForces<18>, &SteeringBehaviors::SumForces<19>,
+  &SteeringBehaviors::SumForces<20>, &SteeringBehaviors::SumForces<21>,
+  &SteeringBehaviors::SumForces<22>, &SteeringBehaviors::SumForces<23>,
+  &SteeringBehaviors::SumForces<24>, &SteeringBehaviors::SumForces<25>,
+  &SteeringBehaviors::SumForces<26>, &SteeringBehaviors::SumForces<27>,
+  &SteeringBehaviors::SumForces<28>, &SteeringBehaviors::SumForces<29>,
+  &SteeringBehaviors::SumForces<30>, &SteeringBehaviors::SumForces<31>
+};
+
+//------------------------- ForwardComponent -----------------------------
+//
+//  calculates the forward component of the steering force
+//------------------------------------------------------------------------
+double SteeringBehaviors::ForwardComponent()
+{
+  return m_pPlayer->Heading().Dot(m_vSteeringForce);
+}
+
+//--------------------------- SideComponent ------------------------------
+//
+//  //  calculates the side component of the steering force
+//------------------------------------------------------------------------
+double SteeringBehaviors::SideComponent()
+{
+  return m_pPlayer->Side().Dot(m_vSteeringForce) * m_pPlayer->MaxTurnRate();
+}
+
+
+//------------------------------- Seek -----------------------------------
+//
+//  Given a target, this behavior returns a steering force which will
+//  allign the agent with the target and move the agent in the desired
+//  direction
+//------------------------------------------------------------------------
+Vector2D SteeringBehaviors::Seek(Vector2D target)
+{
+ 
+  Vector2D DesiredVelocity = Vec2DNormalize(target - m_pPlayer->Pos())
+                            * m_pPlayer->MaxSpeed();
+
+  return (DesiredVelocity - m_pPlayer->Velocity()) * m_dVelocityGain;
+}
+
+
+//--------------------------- Arrive -------------------------------------
+//
+//  This behavior is similar to seek but it attempts to arrive at the
+//  target with a zero velocity
+//------------------------------------------------------------------------
+Vector2D SteeringBehaviors::Arrive(Vector2D    target,
+                                   Deceleration deceleration)
+{
+  Vector2D ToTarget = target - m_pPlayer->Pos();
+
+  //calculate the distance to the target
+  double dist = ToTarget.Length();
+
+  if (dist > 0)
+  {
+    //because Deceleration is enumerated as an int, this value is required
+    //to provide fine tweaking of the deceleration..
+    const double DecelerationTweaker = 0.3;
+
+    //calculate the speed required to reach the target given the desired
+    //deceleration
+    double speed =  dist / ((double)deceleration * DecelerationTweaker);                    
+
+    //make sure the velocity does not exceed the max
+    speed = MinOf(speed, m_pPlayer->MaxSpeed());
+
+    //nor carries the player past the target in one long update
+    if (m_dTimeStep > 1.0)
+    {
+      speed = MinOf(speed, dist / m_dTimeStep);
+    }
+
+    //from here proceed just like Seek except we don't need to normalize 
+    //the ToTarget vector because we have already gone to the trouble
+    //of calculating its length: dist. 
+    Vector2D DesiredVelocity =  ToTarget * speed / dist;
+
+    return (DesiredVelocity - m_pPlayer->Velocity()) * m_dVelocityGain;
+  }
+
+  return Vector2D(0,0);
+}
+
+
+//------------------------------ Pursuit ---------------------------------
+//
+//  this behavior creates a force that steers the agent towards the 
+//  ball
+//------------------------------------------------------------------------
+Vector2D SteeringBehaviors::Pursuit(const SoccerBall* ball)
+{
+  Vector2D ToBall = ball->Pos() - m_pPlayer->Pos();
+
+  //the ball's speed and heading are worked out once a tick for all the
+  //pursuers
+  const BallTrajectory& trajectory = ball->Trajectory();
+ 
+  //the lookahead time is proportional to the distance between the ball
+  //and the pursuer; 
+  double LookAheadTime = 0.0;
+
+  if (trajectory.Speed() != 0.0)
+  {
+    LookAheadTime = ToBall.Length() / trajectory.Speed();
+  }
+
+  //calculate where the ball will be at this time in the future
+  m_vTarget = trajectory.PositionAt(LookAheadTime);
+
+  //now seek to the predicted future position of the ball
+  if (m_dTimeStep <= 1.0) return Arrive(m_vTarget, fast);
+
+  //over a long update the player would run onto the ball (or past it)
+  //before looking again, so it stops short, inside kicking range
+  Vector2D ToTarget = m_vTarget - m_pPlayer->Pos();
+
+  double dist  = ToTarget.Length();
+  double reach = 0.5 * Prm.PlayerKickingDistance;
+
+  if (dist <= reach) return Arrive(m_pPlayer->Pos(), fast);
+
+  return Arrive(m_pPlayer->Pos() + ToTarget * ((dist - reach) / dist), fast);
+}
+
+
+//-------------------------- FindNeighbours ------------------------------
+//
+//  finds the players within a predefined radius using the pitch's grid.
+//  Entities are created with increasing IDs so sorting by ID puts the
+//  neighbours back into the order the players were created in, which
+//  keeps the separation force independent of the grid layout
+//------------------------------------------------------------------------
+static bool CreatedBefore(const PlayerBase* lhs, const PlayerBase* rhs)
+{
+  return lhs->ID() < rhs->ID();
+}
+
+void SteeringBehaviors::FindNeighbours()
+{
+  m_Neighbours.clear();
+
+  //room for every player, so that the storage never has to grow mid-match
+  m_Neighbours.reserve(m_pPlayer->Pitch()->AllPlayers().size());
+
+  m_pPlayer->Pitch()->PlayerGrid().CalculateNeighbors(m_pPlayer->Pos(),
+                                                      m_dViewDistance,
+                                                      m_Neighbours);
+
+  std::sort(m_Neighbours.begin(), m_Neighbours.end(), CreatedBefore);
+}
+
+
+//---------------------------- Separation --------------------------------
+//
+// this calculates a force repelling from the other neighbors
+//------------------------------------------------------------------------
+Vector2D SteeringBehaviors::Separation()
+{  
+   //iterate through all the neighbors and calculate the vector from the
+  Vector2D SteeringForce;
+  
+  std::vector<PlayerBase*>::const_iterator curPlyr;
+  for (curPlyr = m_Neighbours.begin(); curPlyr!=m_Neighbours.end(); ++curPlyr)
+  {
+    //make sure this agent isn't included in the calculations
+    if(*curPlyr != m_pPlayer)
+    {
+      Vector2D ToAgent = m_pPlayer->Pos() - (*curPlyr)->Pos();
+
+      //scale the force inversely proportional to the agents distance  
+      //from its neighbor.
+      SteeringForce += Vec2DNormalize(ToAgent)/ToAgent.Length();
+    }
+  }
+
+  return SteeringForce;
+}
+
+  
+//--------------------------- Interpose ----------------------------------
+//
+//  Given an opponent and an object position this method returns a 
+//  force that attempts to position the agent between them
+//------------------------------------------------------------------------
+Vector2D SteeringBehaviors::Interpose(const SoccerBall* ball,
+                                      Vector2D  target,
+                                      double     DistFromTarget)
+{
+  return Arrive(target + Vec2DNormalize(ball->Pos() - target) * 
+                DistFromTarget, normal);
+}
+
+
+//----------------------------- RenderAids -------------------------------
+//
+//------------------------------------------------------------------------
+void SteeringBehaviors::RenderAids( )
+{ 
+  //render the steering force
+  gdi->RedPen();
+
+  gdi->Line(m_pPlayer->Pos(), m_pPlayer->Pos() + m_vSteeringForce * 20);
+
+
+  
+}
+
+
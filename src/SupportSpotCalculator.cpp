@@ -1,177 +1,435 @@
-#include "SupportSpotCalculator.h"
-#include "PlayerBase.h"
-#include "Goal.h"
-#include "SoccerBall.h"
-#include "constants.h"
-#include "time/regulator.h"
-#include "SoccerTeam.h"
-#include "ParamLoader.h"
-#include "SoccerPitch.h"
-
-#include "debug/DebugConsole.h"
-
-//------------------------------- dtor ----------------------------------------
-//-----------------------------------------------------------------------------
-SupportSpotCalculator::~SupportSpotCalculator()
-{
-  delete m_pRegulator;
-}
-
-
-//------------------------------- ctor ----------------------------------------
-//-----------------------------------------------------------------------------
-SupportSpotCalculator::SupportSpotCalculator(int           numX,
-                                             int           numY,
-                                             SoccerTeam*   team):m_pBestSupportingSpot(NULL),
-                                                                  m_pTeam(team)
-{
-  const Region* PlayingField = team->Pitch()->PlayingArea();
-
-  //calculate the positions of each sweet spot, create them and 
-  //store them in m_Spots
-  double HeightOfSSRegion = PlayingField->Height() * 0.8;
-  double WidthOfSSRegion  = PlayingField->Width() * 0.9;
-  double SliceX = WidthOfSSRegion / numX ;
-  double SliceY = HeightOfSSRegion / numY;
-
-  double left  = PlayingField->Left() + (PlayingField->Width()-WidthOfSSRegion)/2.0 + SliceX/2.0;
-  double right = PlayingField->Right() - (PlayingField->Width()-WidthOfSSRegion)/2.0 - SliceX/2.0;
-  double top   = PlayingField->Top() + (PlayingField->Height()-HeightOfSSRegion)/2.0 + SliceY/2.0;
-
-  for (int x=0; x<(numX/2)-1; ++x)
-  {
-    for (int y=0; y<numY; ++y)
-    {      
-      if (m_pTeam->Color() == SoccerTeam::blue)
-      {
-        m_Spots.push_back(SupportSpot(Vector2D(left+x*SliceX, top+y*SliceY), 0.0));
-      }
-
-      else
-      {
-        m_Spots.push_back(SupportSpot(Vector2D(right-x*SliceX, top+y*SliceY), 0.0));
-      }
-    }
-  }
-  
-  //create the regulator
-  m_pRegulator = new Regulator(Prm.SupportSpotUpdateFreq);
-}
-
-
-//--------------------------- DetermineBestSupportingPosition -----------------
-//
-//  see header or book for description
-//-----------------------------------------------------------------------------
-Vector2D SupportSpotCalculator::DetermineBestSupportingPosition()
-{
-  //only update the spots every few frames                              
-  if (!m_pRegulator->isReady() && m_pBestSupportingSpot)
-  {
-    return m_pBestSupportingSpot->m_vPos;
-  }
-
-  //reset the best supporting spot
-  m_pBestSupportingSpot = NULL;
- 
-  double BestScoreSoFar = 0.0;
-
-  std::vector<SupportSpot>::iterator curSpot;
-
-  for (curSpot = m_Spots.begin(); curSpot != m_Spots.end(); ++curSpot)
-  {
-    //first remove any previous score. (the score is set to one so that
-    //the viewer can see the positions of all the spots if he has the 
-    //aids turned on)
-    curSpot->m_dScore = 1.0;
-
-    //Test 1. is it possible to make a safe pass from the ball's position 
-    //to this position?
-    if(m_pTeam->isPassSafeFromAllOpponents(m_pTeam->ControllingPlayer()->Pos(),
-                                           curSpot->m_vPos,
-                                           NULL,
-                                           Prm.MaxPassingForce))
-    {
-      curSpot->m_dScore += Prm.Spot_PassSafeScore;
-    }
-      
-   
-    //Test 2. Determine if a goal can be scored from this position.  
-    if( m_pTeam->CanShoot(curSpot->m_vPos,            
-                          Prm.MaxShootingForce))
-    {
-      curSpot->m_dScore += Prm.Spot_CanScoreFromPositionScore;
-    }   
-
-    
-    //Test 3. calculate how far this spot is away from the controlling
-    //player. The further away, the higher the score. Any distances further
-    //away than OptimalDistance pixels do not receive a score.
-    if (m_pTeam->SupportingPlayer())
-    {
-      const double OptimalDistance = 200.0;
-        
-      double dist = Vec2DDistance(m_pTeam->ControllingPlayer()->Pos(),
-                                 curSpot->m_vPos);
-      
-      double temp = fabs(OptimalDistance - dist);
-
-      if (temp < OptimalDistance)
-      {
-
-        //normalize the distance and add it to the score
-        curSpot->m_dScore += Prm.Spot_DistFromControllingPlayerScore *
-                             (OptimalDistance-temp)/OptimalDistance;  
-      }
-    }
-    
-    //check to see if this spot has the highest score so far
-    if (curSpot->m_dScore > BestScoreSoFar)
-    {
-      BestScoreSoFar = curSpot->m_dScore;
-
-      m_pBestSupportingSpot = &(*curSpot);
-    }    
-    
-  }
-
-  return m_pBestSupportingSpot->m_vPos;
-}
-
-
-
-
-
-//------------------------------- GetBestSupportingSpot -----------------------
-//-----------------------------------------------------------------------------
-Vector2D SupportSpotCalculator::GetBestSupportingSpot()
-{
-  if (m_pBestSupportingSpot)
-  {
-    return m_pBestSupportingSpot->m_vPos;
-  }
-    
-  else
-  { 
-    return DetermineBestSupportingPosition();
-  }
-}
-
-//----------------------------------- Render ----------------------------------
-//-----------------------------------------------------------------------------
-void SupportSpotCalculator::Render()const
-{
-    gdi->HollowBrush();
-    gdi->GreyPen();
-
-    for (unsigned int spt=0; spt<m_Spots.size(); ++spt)
-    {
-      gdi->Circle(m_Spots[spt].m_vPos, m_Spots[spt].m_dScore);
-    }
-
-    if (m_pBestSupportingSpot)
-    {
-      gdi->GreenPen();
-      gdi->Circle(m_pBestSupportingSpot->m_vPos, m_pBestSupportingSpot->m_dScore);
-    }
+#include "SupportSpotCalculator.h"
+#include "PlayerBase.h"
+#include "Goal.h"
+#include "SoccerBall.h"
+#include "constants.h"
+#include "Time/Regulator.h"
+#include "SoccerTeam.h"
+#include "ParamLoader.h"
+#include "SoccerPitch.h"
+#include "TickProfiler.h"
+
+#include "Debug/DebugConsole.h"
+
+//------------------------------- dtor ----------------------------------------
+//-----------------------------------------------------------------------------
+SupportSpotCalculator::~SupportSpotCalculator()
+{
+  delete m_pRegulator;
+}
+
+
+//------------------------------- ctor ----------------------------------------
+//-----------------------------------------------------------------------------
+SupportSpotCalculator::SupportSpotCalculator(int           numX,
+                                             int           numY,
+                                             SoccerTeam*   team):m_pBestSupportingSpot(NULL),
+                                                                  m_pTeam(team),
+                                                                  m_bTermsAreValid(false),
+                                                                  m_bHadSupportingPlayer(false)
+{
+  const Region* PlayingField = team->Pitch()->PlayingArea();
+
+  //calculate the positions of each sweet spot, create them and 
+  //store them in m_Spots
+  double HeightOfSSRegion = PlayingField->Height() * 0.8;
+  double WidthOfSSRegion  = PlayingField->Width() * 0.9;
+  double SliceX = WidthOfSSRegion / numX ;
+  double SliceY = HeightOfSSRegion / numY;
+
+  double left  = PlayingField->Left() + (PlayingField->Width()-WidthOfSSRegion)/2.0 + SliceX/2.0;
+  double right = PlayingField->Right() - (PlayingField->Width()-WidthOfSSRegion)/2.0 - SliceX/2.0;
+  double top   = PlayingField->Top() + (PlayingField->Height()-HeightOfSSRegion)/2.0 + SliceY/2.0;
+
+  for (int x=0; x<(numX/2)-1; ++x)
+  {
+    for (int y=0; y<numY; ++y)
+    {      
+      if (m_pTeam->Color() == SoccerTeam::blue)
+      {
+        m_Spots.push_back(SupportSpot(Vector2D(left+x*SliceX, top+y*SliceY), 0.0));
+      }
+
+      else
+      {
+        m_Spots.push_back(SupportSpot(Vector2D(right-x*SliceX, top+y*SliceY), 0.0));
+      }
+    }
+  }
+  
+  for (unsigned int s=0; s<m_Spots.size(); ++s)
+  {
+    m_SpotPositions.push_back(m_Spots[s].m_vPos);
+  }
+
+  m_SpotPassTimes.resize(m_Spots.size());
+
+  m_PassesToSpots.reserve(m_Spots.size());
+  m_PassQuerySpot.reserve(m_Spots.size());
+  m_PassToSpotIsSafe.resize(m_Spots.size());
+
+  //create the regulator
+  m_pRegulator = new Regulator(Prm.SupportSpotUpdateFreq);
+}
+
+
+//------------------------------ MaxFlightTime --------------------------------
+//
+//  the time a kick from A reaches B. If the kick cannot reach B this is the
+//  time it takes the ball to stop, since the ball never gets any further
+//-----------------------------------------------------------------------------
+double SupportSpotCalculator::MaxFlightTime(Vector2D A,
+                                            Vector2D B,
+                                            double   force)const
+{
+  const BallTrajectory& trajectory = m_pTeam->Pitch()->Ball()->Trajectory();
+
+  double time = trajectory.TimeToCoverDistance(Vec2DDistance(A, B), force);
+
+  if (time < 0)
+  {
+    time = trajectory.TimeToStop(force);
+  }
+
+  return time;
+}
+
+//------------------------------ InsideBox ------------------------------------
+//
+//  true if pos is within pad of the box
+//-----------------------------------------------------------------------------
+inline bool InsideBox(const InvertedAABBox2D& box, Vector2D pos, double pad)
+{
+  return (pos.x >= box.Left()   - pad) && (pos.x <= box.Right()  + pad) &&
+         (pos.y >= box.Top()    - pad) && (pos.y <= box.Bottom() + pad);
+}
+
+//---------------------------- UpdatePassBoxes --------------------------------
+//-----------------------------------------------------------------------------
+void SupportSpotCalculator::UpdatePassBoxes(Vector2D PassFrom)
+{
+  //the flight times of the passes to every spot in one go
+  const BallTrajectory& trajectory = m_pTeam->Pitch()->Ball()->Trajectory();
+
+  trajectory.TimesToCoverDistances(PassFrom,
+                                   &m_SpotPositions[0],
+                                   (int)m_SpotPositions.size(),
+                                   Prm.MaxPassingForce,
+                                   &m_SpotPassTimes[0]);
+
+  //a pass that falls short is in the air until the ball stops
+  double TimeToStop = trajectory.TimeToStop(Prm.MaxPassingForce);
+
+  std::vector<SupportSpot>::iterator curSpot;
+
+  for (curSpot = m_Spots.begin(); curSpot != m_Spots.end(); ++curSpot)
+  {
+    curSpot->m_PassBox = InvertedAABBox2D(
+                          Vector2D(MinOf(PassFrom.x, curSpot->m_vPos.x),
+                                   MinOf(PassFrom.y, curSpot->m_vPos.y)),
+                          Vector2D(MaxOf(PassFrom.x, curSpot->m_vPos.x),
+                                   MaxOf(PassFrom.y, curSpot->m_vPos.y)));
+
+    double time = m_SpotPassTimes[curSpot - m_Spots.begin()];
+
+    curSpot->m_dPassTime = (time < 0) ? TimeToStop : time;
+
+    curSpot->m_bPassIsDirty = true;
+  }
+}
+
+//------------------------ MarkTermsChangedByOpponents ------------------------
+//
+//  a pass can only be intercepted by an opponent lying ahead of the kicker,
+//  no further away than the target and within MaxSpeed*TimeForBall + radii
+//  of the line of the pass, so an opponent outside the padded box of a pass
+//  before and after it moved cannot have changed the outcome. The same is
+//  true of every shot from a spot.
+//-----------------------------------------------------------------------------
+void SupportSpotCalculator::MarkTermsChangedByOpponents()
+{
+  const std::vector<PlayerBase*>& opponents = m_pTeam->Opponents()->Members();
+
+  //the first time round every term is calculated anyway
+  if (m_OpponentPos.size() != opponents.size())
+  {
+    m_OpponentPos.resize(opponents.size());
+    m_OpponentMaxSpeed.resize(opponents.size());
+
+    for (unsigned int opp=0; opp<opponents.size(); ++opp)
+    {
+      m_OpponentPos[opp]      = opponents[opp]->Pos();
+      m_OpponentMaxSpeed[opp] = opponents[opp]->MaxSpeed();
+    }
+
+    return;
+  }
+
+  //rounding may make the time the ball takes to cover a shorter distance a
+  //fraction longer, so the boxes are padded slightly more than necessary
+  const double Slack = 1.0;
+
+  const double BallRadius = m_pTeam->Pitch()->Ball()->BRadius();
+
+  for (unsigned int opp=0; opp<opponents.size(); ++opp)
+  {
+    Vector2D OldPos = m_OpponentPos[opp];
+    Vector2D NewPos = opponents[opp]->Pos();
+
+    double OldSpeed = m_OpponentMaxSpeed[opp];
+    double NewSpeed = opponents[opp]->MaxSpeed();
+
+    if (!(OldPos != NewPos) && OldSpeed == NewSpeed) continue;
+
+    m_OpponentPos[opp]      = NewPos;
+    m_OpponentMaxSpeed[opp] = NewSpeed;
+
+    double MaxSpeed = MaxOf(OldSpeed, NewSpeed);
+    double Radii    = BallRadius + opponents[opp]->BRadius() + Slack;
+
+    std::vector<SupportSpot>::iterator curSpot;
+
+    for (curSpot = m_Spots.begin(); curSpot != m_Spots.end(); ++curSpot)
+    {
+      double PassPad = MaxSpeed * curSpot->m_dPassTime + Radii;
+
+      if (InsideBox(curSpot->m_PassBox, OldPos, PassPad) ||
+          InsideBox(curSpot->m_PassBox, NewPos, PassPad))
+      {
+        curSpot->m_bPassIsDirty = true;
+      }
+
+      double ShotPad = MaxSpeed * curSpot->m_dShotTime + Radii;
+
+      if (InsideBox(curSpot->m_ShotBox, OldPos, ShotPad) ||
+          InsideBox(curSpot->m_ShotBox, NewPos, ShotPad))
+      {
+        curSpot->m_bShotIsDirty = true;
+      }
+    }
+  }
+}
+
+//--------------------------- RecalculateDirtyTerms ---------------------------
+//-----------------------------------------------------------------------------
+void SupportSpotCalculator::RecalculateDirtyTerms(Vector2D PassFrom)
+{
+  //the passes are tested against the opponents as one batch
+  m_PassesToSpots.clear();
+  m_PassQuerySpot.clear();
+
+  for (unsigned int spot=0; spot<m_Spots.size(); ++spot)
+  {
+    if (!m_Spots[spot].m_bPassIsDirty) continue;
+
+    m_PassesToSpots.push_back(PassQuery(PassFrom,
+                                        m_Spots[spot].m_vPos,
+                                        NULL,
+                                        Prm.MaxPassingForce));
+    m_PassQuerySpot.push_back(spot);
+  }
+
+  if (!m_PassesToSpots.empty())
+  {
+    m_pTeam->ArePassesSafeFromAllOpponents(&m_PassesToSpots[0],
+                                           (int)m_PassesToSpots.size(),
+                                           &m_PassToSpotIsSafe[0]);
+  }
+
+  for (unsigned int pass=0; pass<m_PassQuerySpot.size(); ++pass)
+  {
+    SupportSpot& spot = m_Spots[m_PassQuerySpot[pass]];
+
+    spot.m_bPassIsSafe  = m_PassToSpotIsSafe[pass] != 0;
+    spot.m_bPassIsDirty = false;
+  }
+
+  //the shots
+  std::vector<SupportSpot>::iterator curSpot;
+
+  for (curSpot = m_Spots.begin(); curSpot != m_Spots.end(); ++curSpot)
+  {
+    if (!curSpot->m_bShotIsDirty) continue;
+
+    curSpot->m_bCanScore = m_pTeam->CanShoot(curSpot->m_vPos,
+                                             Prm.MaxShootingForce);
+
+    curSpot->m_bShotIsDirty = false;
+  }
+}
+
+//--------------------------- DetermineBestSupportingPosition -----------------
+//
+//  see header or book for description
+//-----------------------------------------------------------------------------
+Vector2D SupportSpotCalculator::DetermineBestSupportingPosition()
+{
+  //only update the spots every few frames                              
+  if (!m_pRegulator->isReady() && m_pBestSupportingSpot)
+  {
+    return m_pBestSupportingSpot->m_vPos;
+  }
+
+  PROFILE_SCOPE(zone_support_spots);
+
+  //reset the best supporting spot
+  m_pBestSupportingSpot = NULL;
+ 
+  double BestScoreSoFar = 0.0;
+
+  //passes are made from the controlling player. If the controlling player
+  //has just kicked the ball away the ball's position is used instead
+  Vector2D PassFrom = m_pTeam->ControllingPlayer() ?
+                      m_pTeam->ControllingPlayer()->Pos() :
+                      m_pTeam->Pitch()->Ball()->Pos();
+
+  bool HasSupportingPlayer = m_pTeam->SupportingPlayer() != NULL;
+
+  //the shot boxes never change, so they are calculated the first time
+  //round
+  if (!m_bTermsAreValid)
+  {
+    const Goal*  goal = m_pTeam->OpponentsGoal();
+    const double BallRadius = m_pTeam->Pitch()->Ball()->BRadius();
+
+    //the range of shot targets tried by SoccerTeam::CanShoot
+    Vector2D LowestTarget(goal->Center().x,
+                          (int)(goal->LeftPost().y + BallRadius));
+    Vector2D HighestTarget(goal->Center().x,
+                           (int)(goal->RightPost().y - BallRadius));
+
+    std::vector<SupportSpot>::iterator curSpot;
+
+    for (curSpot = m_Spots.begin(); curSpot != m_Spots.end(); ++curSpot)
+    {
+      curSpot->m_ShotBox = InvertedAABBox2D(
+                  Vector2D(MinOf(curSpot->m_vPos.x, LowestTarget.x),
+                           MinOf(curSpot->m_vPos.y, MinOf(LowestTarget.y, HighestTarget.y))),
+                  Vector2D(MaxOf(curSpot->m_vPos.x, LowestTarget.x),
+                           MaxOf(curSpot->m_vPos.y, MaxOf(LowestTarget.y, HighestTarget.y))));
+
+      curSpot->m_dShotTime =
+               MaxOf(MaxFlightTime(curSpot->m_vPos, LowestTarget, Prm.MaxShootingForce),
+                        MaxFlightTime(curSpot->m_vPos, HighestTarget, Prm.MaxShootingForce));
+    }
+  }
+
+  //every pass term depends on where the passes are made from
+  bool PassFromMoved = !m_bTermsAreValid || (PassFrom != m_vPassFrom);
+
+  if (PassFromMoved)
+  {
+    m_vPassFrom = PassFrom;
+
+    UpdatePassBoxes(PassFrom);
+  }
+
+  MarkTermsChangedByOpponents();
+
+  RecalculateDirtyTerms(PassFrom);
+
+  //Test 3 depends only on the pass position and on there being a
+  //supporting player
+  bool DistancesChanged = PassFromMoved ||
+                          (HasSupportingPlayer != m_bHadSupportingPlayer);
+
+  m_bHadSupportingPlayer = HasSupportingPlayer;
+  m_bTermsAreValid       = true;
+
+  std::vector<SupportSpot>::iterator curSpot;
+
+  for (curSpot = m_Spots.begin(); curSpot != m_Spots.end(); ++curSpot)
+  {
+    //Test 3. calculate how far this spot is away from the controlling
+    //player. The further away, the higher the score. Any distances further
+    //away than OptimalDistance pixels do not receive a score.
+    if (DistancesChanged)
+    {
+      curSpot->m_dDistScore = 0.0;
+
+      if (HasSupportingPlayer)
+      {
+        const double OptimalDistance = 200.0;
+        
+        double dist = Vec2DDistance(PassFrom, curSpot->m_vPos);
+      
+        double temp = fabs(OptimalDistance - dist);
+
+        if (temp < OptimalDistance)
+        {
+          //normalize the distance and add it to the score
+          curSpot->m_dDistScore = Prm.Spot_DistFromControllingPlayerScore *
+                                  (OptimalDistance-temp)/OptimalDistance;
+        }
+      }
+    }
+
+    //the score is set to one so that the viewer can see the positions of
+    //all the spots if he has the aids turned on
+    curSpot->m_dScore = 1.0;
+
+    //Test 1. is it possible to make a safe pass from the ball's position 
+    //to this position?
+    if (curSpot->m_bPassIsSafe)
+    {
+      curSpot->m_dScore += Prm.Spot_PassSafeScore;
+    }
+
+    //Test 2. Determine if a goal can be scored from this position.  
+    if (curSpot->m_bCanScore)
+    {
+      curSpot->m_dScore += Prm.Spot_CanScoreFromPositionScore;
+    }
+
+    curSpot->m_dScore += curSpot->m_dDistScore;
+    
+    //check to see if this spot has the highest score so far
+    if (curSpot->m_dScore > BestScoreSoFar)
+    {
+      BestScoreSoFar = curSpot->m_dScore;
+
+      m_pBestSupportingSpot = &(*curSpot);
+    }    
+    
+  }
+
+  return m_pBestSupportingSpot->m_vPos;
+}
+
+
+
+
+
+//------------------------------- GetBestSupportingSpot -----------------------
+//-----------------------------------------------------------------------------
+Vector2D SupportSpotCalculator::GetBestSupportingSpot()
+{
+  if (m_pBestSupportingSpot)
+  {
+    return m_pBestSupportingSpot->m_vPos;
+  }
+    
+  else
+  { 
+    return DetermineBestSupportingPosition();
+  }
+}
+
+//----------------------------------- Render ----------------------------------
+//-----------------------------------------------------------------------------
+void SupportSpotCalculator::Render()const
+{
+    gdi->HollowBrush();
+    gdi->GreyPen();
+
+    for (unsigned int spt=0; spt<m_Spots.size(); ++spt)
+    {
+      gdi->Circle(m_Spots[spt].m_vPos, m_Spots[spt].m_dScore);
+    }
+
+    if (m_pBestSupportingSpot)
+    {
+      gdi->GreenPen();
+      gdi->Circle(m_pBestSupportingSpot->m_vPos, m_pBestSupportingSpot->m_dScore);
+    }
 }
\ No newline at end of file
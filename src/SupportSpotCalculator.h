@@ -1,87 +1,155 @@
-#ifndef SUPPORTSPOTCALCULATOR
-#define SUPPORTSPOTCALCULATOR
-#pragma warning (disable:4786)
-//------------------------------------------------------------------------
-//
-//  Name:   SupportSpotCalculator.h
-//
-//  Desc:   Class to determine the best spots for a suppoting soccer
-//          player to move to.
-//
-//  Author: Mat Buckland 2003 (fup@ai-junkie.com)
-//
-//------------------------------------------------------------------------
-
-#include <vector>
-
-#include "Game/Region.h"
-#include "2D/Vector2D.h"
-#include "misc/Cgdi.h"
-
-
-class PlayerBase;
-class Goal;
-class SoccerBall;
-class SoccerTeam;
-class Regulator;
-
-
-
-//------------------------------------------------------------------------
-
-class SupportSpotCalculator
-{
-private:
-  
-  //a data structure to hold the values and positions of each spot
-  struct SupportSpot
-  {
-    
-    Vector2D  m_vPos;
-
-    double    m_dScore;
-
-    SupportSpot(Vector2D pos, double value):m_vPos(pos),
-                                            m_dScore(value)
-    {}
-  };
-
-private:
-
-
-  SoccerTeam*               m_pTeam;
-
-  std::vector<SupportSpot>  m_Spots;
-
-  //a pointer to the highest valued spot from the last update
-  SupportSpot*              m_pBestSupportingSpot;
-
-  //this will regulate how often the spots are calculated (default is
-  //one update per second)
-  Regulator*                m_pRegulator;
-
-public:
-  
-  SupportSpotCalculator(int numX,
-                        int numY,
-                        SoccerTeam* team);
-
-  ~SupportSpotCalculator();
-
-  //draws the spots to the screen as a hollow circles. The higher the 
-  //score, the bigger the circle. The best supporting spot is drawn in
-  //bright green.
-  void       Render()const;
-
-  //this method iterates through each possible spot and calculates its
-  //score.
-  Vector2D  DetermineBestSupportingPosition();
-
-  //returns the best supporting spot if there is one. If one hasn't been
-  //calculated yet, this method calls DetermineBestSupportingPosition and
-  //returns the result.
-  Vector2D  GetBestSupportingSpot();
-};
-
-
+#ifndef SUPPORTSPOTCALCULATOR
+#define SUPPORTSPOTCALCULATOR
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   SupportSpotCalculator.h
+//
+//  Desc:   Class to determine the best spots for a suppoting soccer
+//          player to move to.
+//
+//  Author: Mat Buckland 2003 (fup@ai-junkie.com)
+//
+//------------------------------------------------------------------------
+
+#include <vector>
+
+#include "Game/Region.h"
+#include "2D/Vector2D.h"
+#include "2D/InvertedAABBox2D.h"
+#include "misc/Cgdi.h"
+#include "PassSafetyKernel.h"
+
+
+class PlayerBase;
+class Goal;
+class SoccerBall;
+class SoccerTeam;
+class Regulator;
+
+
+
+//------------------------------------------------------------------------
+
+class SupportSpotCalculator
+{
+private:
+  
+  //a data structure to hold the values and positions of each spot
+  struct SupportSpot
+  {
+    
+    Vector2D  m_vPos;
+
+    double    m_dScore;
+
+    //the terms the score is made of, cached between updates so only
+    //those whose inputs have changed need to be recalculated
+    bool      m_bPassIsSafe;
+    bool      m_bCanScore;
+    double    m_dDistScore;
+
+    //the boxes bounding a pass to this spot and every shot at goal from
+    //it, and the longest time the ball is in flight during each. An
+    //opponent can only change the outcome of the pass (or shot) if it is
+    //within MaxSpeed*time + radii of the box
+    InvertedAABBox2D m_PassBox;
+    double           m_dPassTime;
+
+    InvertedAABBox2D m_ShotBox;
+    double           m_dShotTime;
+
+    //set when the cached pass/shot term is out of date
+    bool      m_bPassIsDirty;
+    bool      m_bShotIsDirty;
+
+    SupportSpot(Vector2D pos, double value):m_vPos(pos),
+                                            m_dScore(value),
+                                            m_bPassIsSafe(false),
+                                            m_bCanScore(false),
+                                            m_dDistScore(0.0),
+                                            m_PassBox(pos, pos),
+                                            m_dPassTime(0.0),
+                                            m_ShotBox(pos, pos),
+                                            m_dShotTime(0.0),
+                                            m_bPassIsDirty(true),
+                                            m_bShotIsDirty(true)
+    {}
+  };
+
+private:
+
+
+  SoccerTeam*               m_pTeam;
+
+  std::vector<SupportSpot>  m_Spots;
+
+  //the positions of the spots, and the flight times of passes to them,
+  //laid out for BallTrajectory's batch queries
+  std::vector<Vector2D>     m_SpotPositions;
+  std::vector<double>       m_SpotPassTimes;
+
+  //a pointer to the highest valued spot from the last update
+  SupportSpot*              m_pBestSupportingSpot;
+
+  //a pass to each spot whose pass term is out of date, and whether it
+  //is safe, so they can be tested against the opponents as one batch
+  std::vector<PassQuery>    m_PassesToSpots;
+  std::vector<int>          m_PassQuerySpot;
+  std::vector<char>         m_PassToSpotIsSafe;
+
+  //the inputs the cached terms were last calculated from
+  bool                      m_bTermsAreValid;
+  Vector2D                  m_vPassFrom;
+  bool                      m_bHadSupportingPlayer;
+  std::vector<Vector2D>     m_OpponentPos;
+  std::vector<double>       m_OpponentMaxSpeed;
+
+  //this will regulate how often the spots are calculated (default is
+  //one update per second)
+  Regulator*                m_pRegulator;
+
+  friend class MatchSnapshot;
+
+
+  //the longest a kick of the given force from A can be in flight before
+  //it passes B (or stops short of it)
+  double  MaxFlightTime(Vector2D A, Vector2D B, double force)const;
+
+  //recalculates the pass boxes when the position passes are made from
+  //changes
+  void    UpdatePassBoxes(Vector2D PassFrom);
+
+  //marks the pass and shot terms of any spot whose box an opponent has
+  //moved into or out of since the last update
+  void    MarkTermsChangedByOpponents();
+
+  //recalculates the pass and shot terms marked as dirty
+  void    RecalculateDirtyTerms(Vector2D PassFrom);
+
+public:
+  
+  SupportSpotCalculator(int numX,
+                        int numY,
+                        SoccerTeam* team);
+
+  ~SupportSpotCalculator();
+
+  //draws the spots to the screen as a hollow circles. The higher the 
+  //score, the bigger the circle. The best supporting spot is drawn in
+  //bright green.
+  void       Render()const;
+
+  //this method iterates through each possible spot and calculates its
+  //score. Only the terms of the score whose inputs have changed since the
+  //last call are recalculated.
+  Vector2D  DetermineBestSupportingPosition();
+
+  //returns the best supporting spot if there is one. If one hasn't been
+  //calculated yet, this method calls DetermineBestSupportingPosition and
+  //returns the result.
+  Vector2D  GetBestSupportingSpot();
+};
+
+
 #endif
\ No newline at end of file
@@ -0,0 +1,272 @@
+#include "TeamConfig.h"
+
+#include <fstream>
+#include <stdexcept>
+
+
+//---------------------------- MirrorRegion -----------------------------------
+//
+//  regions are numbered down the columns from the bottom right of the pitch
+//  (see SoccerPitch::CreateRegions), so a region's column and row follow
+//  from its distance from the last region
+//-----------------------------------------------------------------------------
+int MirrorRegion(int region)
+{
+  const int NumRegions = FieldConst::NumRegionsHorizontal *
+                         FieldConst::NumRegionsVertical;
+
+  int FromLast = NumRegions - 1 - region;
+
+  int col = FromLast / FieldConst::NumRegionsVertical;
+  int row = FromLast % FieldConst::NumRegionsVertical;
+
+  int MirroredCol = FieldConst::NumRegionsHorizontal - 1 - col;
+
+  return NumRegions - 1 - (MirroredCol * FieldConst::NumRegionsVertical + row);
+}
+
+//----------------------------- DefaultBlue -----------------------------------
+//-----------------------------------------------------------------------------
+TeamConfig TeamConfig::DefaultBlue()
+{
+  TeamConfig config;
+
+  config.Name = "Blue";
+  config.Players.resize(TeamSize);
+
+  for (int p=0; p<TeamSize; ++p)
+  {
+    config.Players[p].Role            = FieldConst::DefaultBlueTeam()[p];
+    config.Players[p].DefaultRegion   = FieldConst::BlueDefaultRegions()[p];
+    config.Players[p].AttackingRegion = FieldConst::BlueAttackingRegions()[p];
+    config.Players[p].DefendingRegion = FieldConst::BlueDefendingRegions()[p];
+  }
+
+  return config;
+}
+
+//------------------------------ DefaultRed -----------------------------------
+//
+//  the red tables are as the red team sees the pitch, so they are mirrored
+//  into the blue team's view (and mirrored back when the team plays red)
+//-----------------------------------------------------------------------------
+TeamConfig TeamConfig::DefaultRed()
+{
+  TeamConfig config;
+
+  config.Name = "Red";
+  config.Players.resize(TeamSize);
+
+  for (int p=0; p<TeamSize; ++p)
+  {
+    config.Players[p].Role            = FieldConst::DefaultRedTeam()[p];
+    config.Players[p].DefaultRegion   = MirrorRegion(FieldConst::RedDefaultRegions()[p]);
+    config.Players[p].AttackingRegion = MirrorRegion(FieldConst::RedAttackingRegions()[p]);
+    config.Players[p].DefendingRegion = MirrorRegion(FieldConst::RedDefendingRegions()[p]);
+  }
+
+  return config;
+}
+
+//------------------------------- Validate ------------------------------------
+//-----------------------------------------------------------------------------
+std::string TeamConfig::Validate()const
+{
+  const int NumRegions = FieldConst::NumRegionsHorizontal *
+                         FieldConst::NumRegionsVertical;
+
+  std::ostringstream problem;
+
+  if (Size() < 2 || Size() > MaxTeamSize)
+  {
+    problem << "a team must have from 2 to " << MaxTeamSize << " players";
+  }
+
+  for (int p=0; p<Size() && problem.str().empty(); ++p)
+  {
+    const PlayerConfig& player = Players[p];
+
+    if ((p == 0) != (player.Role == FieldConst::goal_keeper))
+    {
+      problem << "player " << p << ": the first player, and only the first, "
+              << "must be the goalkeeper";
+    }
+
+    else if (player.DefaultRegion   < 0 || player.DefaultRegion   >= NumRegions ||
+             player.AttackingRegion < 0 || player.AttackingRegion >= NumRegions ||
+             player.DefendingRegion < 0 || player.DefendingRegion >= NumRegions)
+    {
+      problem << "player " << p << ": regions must be between 0 and "
+              << NumRegions - 1;
+    }
+
+    else if (player.Speed    <= 0.0 || player.Speed    > 200.0 ||
+             player.Force    <= 0.0 || player.Force    > 200.0 ||
+             player.TurnRate <= 0.0 || player.TurnRate > 200.0)
+    {
+      problem << "player " << p << ": attributes must be above 0 and at most 200";
+    }
+  }
+
+  return problem.str();
+}
+
+//--------------------------- SplitConfigLine ---------------------------------
+//-----------------------------------------------------------------------------
+bool SplitConfigLine(std::string line, std::string& keyword, std::istringstream& words)
+{
+  std::string::size_type comment = line.find("//");
+
+  if (comment != std::string::npos) line.erase(comment);
+
+  words.clear();
+  words.str(line);
+
+  return (bool)(words >> keyword);
+}
+
+//--------------------------- ThrowConfigError --------------------------------
+//-----------------------------------------------------------------------------
+void ThrowConfigError(const std::string& filename, int line, const std::string& problem)
+{
+  std::ostringstream msg;
+
+  msg << filename << "(" << line << "): " << problem;
+
+  throw std::runtime_error(msg.str());
+}
+
+//---------------------------- ParseRole --------------------------------------
+//-----------------------------------------------------------------------------
+static bool ParseRole(const std::string& name, FieldConst::player_role& role)
+{
+  if      (name == "goal_keeper") role = FieldConst::goal_keeper;
+  else if (name == "attacker")    role = FieldConst::attacker;
+  else if (name == "defender")    role = FieldConst::defender;
+  else return false;
+
+  return true;
+}
+
+
+//-------------------------- TeamConfigReader ---------------------------------
+//-----------------------------------------------------------------------------
+TeamConfigReader::TeamConfigReader(const std::string& filename):m_strFilename(filename),
+                                                                m_bInTeam(false)
+{}
+
+bool TeamConfigReader::ReadLine(const std::string& keyword,
+                                std::istream&      words,
+                                int                LineNumber)
+{
+  if (keyword == "Team")
+  {
+    if (m_bInTeam)
+    {
+      ThrowConfigError(m_strFilename, LineNumber, "team " + m_Teams.back().Name + " has no End");
+    }
+
+    std::string name;
+
+    if (!(words >> name))
+    {
+      ThrowConfigError(m_strFilename, LineNumber, "the team has no name");
+    }
+
+    for (unsigned int t=0; t<m_Teams.size(); ++t)
+    {
+      if (m_Teams[t].Name == name)
+      {
+        ThrowConfigError(m_strFilename, LineNumber, "team " + name + " is already defined");
+      }
+    }
+
+    m_Teams.push_back(TeamConfig());
+    m_Teams.back().Name = name;
+
+    m_bInTeam = true;
+
+    return true;
+  }
+
+  if (!m_bInTeam) return false;
+
+  TeamConfig& team = m_Teams.back();
+
+  if (keyword == "End")
+  {
+    std::string problem = team.Validate();
+
+    if (!problem.empty())
+    {
+      ThrowConfigError(m_strFilename, LineNumber, "team " + team.Name + ", " + problem);
+    }
+
+    m_bInTeam = false;
+
+    return true;
+  }
+
+  PlayerConfig player;
+
+  if (!ParseRole(keyword, player.Role))
+  {
+    ThrowConfigError(m_strFilename, LineNumber, "unknown role " + keyword);
+  }
+
+  if (!(words >> player.DefaultRegion >> player.AttackingRegion >> player.DefendingRegion
+              >> player.Speed >> player.Force >> player.TurnRate))
+  {
+    ThrowConfigError(m_strFilename, LineNumber,
+                     "expected <role> <default> <attacking> <defending> <speed> <force> <turn>");
+  }
+
+  if (team.Size() == MaxTeamSize)
+  {
+    ThrowConfigError(m_strFilename, LineNumber, "team " + team.Name + " has too many players");
+  }
+
+  team.Players.push_back(player);
+
+  return true;
+}
+
+void TeamConfigReader::Finish()const
+{
+  if (m_bInTeam)
+  {
+    throw std::runtime_error(m_strFilename + ": team " + m_Teams.back().Name + " has no End");
+  }
+}
+
+//----------------------------- LoadTactics -----------------------------------
+//-----------------------------------------------------------------------------
+void LoadTactics(const std::string& filename, std::vector<TeamConfig>& teams)
+{
+  std::ifstream file(filename.c_str());
+
+  if (!file)
+  {
+    throw std::runtime_error("cannot open tactics file " + filename);
+  }
+
+  TeamConfigReader   reader(filename);
+
+  std::string        line;
+  std::string        keyword;
+  std::istringstream words;
+
+  for (int LineNumber=1; std::getline(file, line); ++LineNumber)
+  {
+    if (!SplitConfigLine(line, keyword, words)) continue;
+
+    if (!reader.ReadLine(keyword, words, LineNumber))
+    {
+      ThrowConfigError(filename, LineNumber, "unknown keyword " + keyword);
+    }
+  }
+
+  reader.Finish();
+
+  teams.insert(teams.end(), reader.Teams().begin(), reader.Teams().end());
+}
@@ -0,0 +1,130 @@
+#ifndef TEAMCONFIG_H
+#define TEAMCONFIG_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   TeamConfig.h
+//
+//  Desc:   the make up of a team: the role of each player, the regions
+//          each takes up at kick off, when attacking and when defending,
+//          and each player's self-attributes.
+//
+//          Regions are given as the blue team sees the pitch (defending
+//          the goal on the right). A team playing as red has them
+//          mirrored about the halfway line, so the same config can play
+//          on either side.
+//
+//          Teams can be read at run time from a tactics file, made up of
+//          any number of team definitions:
+//
+//            Team <name>
+//              <role> <default> <attacking> <defending> <speed> <force> <turn>
+//              ... one line per player, the goalkeeper first
+//            End
+//
+//          role is one of goal_keeper, attacker or defender and the
+//          attributes are percentages of the defaults. A team may have
+//          from 2 to MaxTeamSize players. Anything after // is a comment.
+//
+//------------------------------------------------------------------------
+#include <string>
+#include <vector>
+#include <sstream>
+
+#include "constants.h"
+
+
+struct PlayerConfig
+{
+  FieldConst::player_role  Role;
+
+  int     DefaultRegion;
+  int     AttackingRegion;
+  int     DefendingRegion;
+
+  //the player's self-attributes: its speed, force and turn rate as a
+  //percentage (0 to 200) of the defaults in Params.ini
+  double  Speed;
+  double  Force;
+  double  TurnRate;
+
+  PlayerConfig():Role(FieldConst::defender),
+                 DefaultRegion(0),
+                 AttackingRegion(0),
+                 DefendingRegion(0),
+                 Speed(100.0),
+                 Force(100.0),
+                 TurnRate(100.0)
+  {}
+};
+
+
+class TeamConfig
+{
+public:
+
+  std::string                Name;
+
+  //the first player must be the goalkeeper
+  std::vector<PlayerConfig>  Players;
+
+  int                Size()const{return (int)Players.size();}
+
+  //the teams the game has always been played with
+  static TeamConfig  DefaultBlue();
+  static TeamConfig  DefaultRed();
+
+  //returns an empty string if the config can be played, otherwise a
+  //description of what is wrong with it
+  std::string        Validate()const;
+};
+
+
+//returns the index of the region that is the mirror image of the given
+//one about the halfway line. Mirroring twice gives the region back
+int MirrorRegion(int region);
+
+
+//reads team definitions a line at a time, so they can be embedded in
+//other files (see Season.h)
+class TeamConfigReader
+{
+private:
+
+  std::string              m_strFilename;
+
+  std::vector<TeamConfig>  m_Teams;
+
+  //true between a Team line and its End
+  bool                     m_bInTeam;
+
+public:
+
+  //the file name is only used in error messages
+  explicit TeamConfigReader(const std::string& filename);
+
+  //if the line starting with keyword (the rest of it is in words) is part
+  //of a team definition it is taken in and true is returned. Throws a
+  //std::runtime_error naming the line if the definition is not valid
+  bool  ReadLine(const std::string& keyword, std::istream& words, int LineNumber);
+
+  //throws if the last team definition has no End
+  void  Finish()const;
+
+  const std::vector<TeamConfig>& Teams()const{return m_Teams;}
+};
+
+
+//reads every team of a tactics file into teams. Throws a std::runtime_error
+//if the file cannot be read or anything in it is not a team definition
+void LoadTactics(const std::string& filename, std::vector<TeamConfig>& teams);
+
+//splits a line of a tactics or season file into its first word and the
+//rest, dropping any comment. Returns false if the line is blank
+bool SplitConfigLine(std::string line, std::string& keyword, std::istringstream& words);
+
+//throws a std::runtime_error locating the problem at a line of a file
+void ThrowConfigError(const std::string& filename, int line, const std::string& problem);
+
+
+#endif
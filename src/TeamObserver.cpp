@@ -0,0 +1,134 @@
+#include "TeamObserver.h"
+#include "SoccerPitch.h"
+#include "SoccerTeam.h"
+#include "SoccerBall.h"
+#include "PlayerBase.h"
+#include "Goal.h"
+#include "ParamLoader.h"
+#include "Game/Region.h"
+
+
+//------------------------------- ctor ----------------------------------------
+//-----------------------------------------------------------------------------
+TeamObserver::TeamObserver(const SoccerTeam* team):m_pTeam(team),
+                                                   m_pOpponents(team->Opponents())
+{
+  const Region* area = team->Pitch()->PlayingArea();
+
+  m_vCenter     = area->Center();
+  m_dHalfLength = area->Width()  / 2.0;
+  m_dHalfWidth  = area->Height() / 2.0;
+  m_dAttackSign = team->OpponentsGoal()->Center().x > m_vCenter.x ? 1.0 : -1.0;
+
+  m_dPlayerSpeedScale = 1.0 / Prm.PlayerMaxSpeedWithoutBall;
+  m_dBallSpeedScale   = Prm.BallMass / Prm.MaxShootingForce;
+}
+
+//------------------------------ GoalsFor -------------------------------------
+//
+//  a team scores by putting the ball in the opponents' goal
+//-----------------------------------------------------------------------------
+int TeamObserver::GoalsFor()const
+{
+  return m_pTeam->OpponentsGoal()->NumGoalsScored();
+}
+
+int TeamObserver::GoalsAgainst()const
+{
+  return m_pTeam->HomeGoal()->NumGoalsScored();
+}
+
+//-------------------------- ObservationSize ----------------------------------
+//-----------------------------------------------------------------------------
+int TeamObserver::ObservationSize()const
+{
+  return PlayerOffset(false, (int)m_pOpponents->Members().size());
+}
+
+int TeamObserver::ActionSize()const
+{
+  return NumPlayers() * num_action_fields;
+}
+
+int TeamObserver::NumPlayers()const
+{
+  return (int)m_pTeam->Members().size();
+}
+
+int TeamObserver::PlayerOffset(bool own, int member)const
+{
+  int first = num_global_features + num_ball_features;
+
+  if (!own) first += NumPlayers() * num_player_features;
+
+  return first + member * num_player_features;
+}
+
+//------------------------------- Observe -------------------------------------
+//-----------------------------------------------------------------------------
+void TeamObserver::Observe(float* observation, double TimeLeft)const
+{
+  float* global = observation;
+
+  global[time_left]       = (float)TimeLeft;
+  global[game_on]         = m_pTeam->Pitch()->GameOn() ? 1.0f : 0.0f;
+  global[goal_difference] = (float)(GoalsFor() - GoalsAgainst());
+
+  float* ball = observation + num_global_features;
+
+  const SoccerBall* b = m_pTeam->Pitch()->Ball();
+
+  ball[ball_x]  = (float)(m_dAttackSign * (b->Pos().x - m_vCenter.x) / m_dHalfLength);
+  ball[ball_y]  = (float)((b->Pos().y - m_vCenter.y) / m_dHalfWidth);
+  ball[ball_vx] = (float)(m_dAttackSign * b->Velocity().x * m_dBallSpeedScale);
+  ball[ball_vy] = (float)(b->Velocity().y * m_dBallSpeedScale);
+
+  for (unsigned int p=0; p<m_pTeam->Members().size(); ++p)
+  {
+    ObservePlayer(m_pTeam, p, observation + PlayerOffset(true, p));
+  }
+
+  for (unsigned int p=0; p<m_pOpponents->Members().size(); ++p)
+  {
+    ObservePlayer(m_pOpponents, p, observation + PlayerOffset(false, p));
+  }
+}
+
+//---------------------------- ObservePlayer ----------------------------------
+//
+//  read from the player state store, which holds every player's
+//  kinematics as of its last update
+//-----------------------------------------------------------------------------
+void TeamObserver::ObservePlayer(const SoccerTeam* team, int member, float* features)const
+{
+  const PlayerBase*       player = team->Members()[member];
+  const PlayerStateStore& store  = m_pTeam->Pitch()->PlayerStates();
+
+  const int handle = player->StateHandle();
+
+  Vector2D pos     = store.Pos(handle);
+  Vector2D vel     = store.Velocity(handle);
+  Vector2D heading = store.Heading(handle);
+
+  features[player_x]          = (float)(m_dAttackSign * (pos.x - m_vCenter.x) / m_dHalfLength);
+  features[player_y]          = (float)((pos.y - m_vCenter.y) / m_dHalfWidth);
+  features[player_vx]         = (float)(m_dAttackSign * vel.x * m_dPlayerSpeedScale);
+  features[player_vy]         = (float)(vel.y * m_dPlayerSpeedScale);
+  features[player_heading_x]  = (float)(m_dAttackSign * heading.x);
+  features[player_heading_y]  = (float)heading.y;
+  features[player_in_control] = team->ControllingPlayer() == player ? 1.0f : 0.0f;
+}
+
+//----------------------------- ReadActions -----------------------------------
+//-----------------------------------------------------------------------------
+void TeamObserver::ReadActions(const float* actions, PlayerAction* out)const
+{
+  for (int p=0; p<NumPlayers(); ++p)
+  {
+    const float* a = actions + p*num_action_fields;
+
+    out[p].Move      = Vector2D(m_dAttackSign * a[move_x], a[move_y]);
+    out[p].Kick      = Vector2D(m_dAttackSign * a[kick_x], a[kick_y]);
+    out[p].KickPower = a[kick_power];
+  }
+}
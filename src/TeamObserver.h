@@ -0,0 +1,116 @@
+#ifndef TEAMOBSERVER_H
+#define TEAMOBSERVER_H
+//------------------------------------------------------------------------
+//
+//  Name:   TeamObserver.h
+//
+//  Desc:   the pitch as a team sees it, written as a flat array of floats
+//          for a policy outside the game, and that policy's answer (an
+//          action for each of the team's players, likewise flat) read back.
+//
+//          Both are in the team's frame: x points at the opponents' goal
+//          and the pitch runs from -1 to 1 each way, so a policy sees the
+//          same thing whichever end its team attacks.
+//
+//------------------------------------------------------------------------
+#include "2D/Vector2D.h"
+#include "PlayerAction.h"
+
+class SoccerPitch;
+class SoccerTeam;
+
+
+class TeamObserver
+{
+public:
+
+  //the layout of an observation: the global features, the ball, then each
+  //of the team's players followed by each of the opponents', in the order
+  //of their teams
+  enum global_feature
+  {
+    time_left,        //the fraction of the episode or match still to play
+    game_on,          //1 while the game is in play, 0 before a kick off
+    goal_difference,  //the team's goals less the opponents'
+    num_global_features
+  };
+
+  enum ball_feature
+  {
+    ball_x,
+    ball_y,
+    ball_vx,          //as a fraction of the speed of the hardest shot
+    ball_vy,
+    num_ball_features
+  };
+
+  enum player_feature
+  {
+    player_x,
+    player_y,
+    player_vx,        //as a fraction of a player's top speed
+    player_vy,
+    player_heading_x,
+    player_heading_y,
+    player_in_control, //1 if the player is its team's controlling player
+    num_player_features
+  };
+
+  //the layout of the action of one of the team's players. See
+  //PlayerAction.h
+  enum action_field
+  {
+    move_x,
+    move_y,
+    kick_x,
+    kick_y,
+    kick_power,
+    num_action_fields
+  };
+
+private:
+
+  const SoccerTeam*   m_pTeam;
+  const SoccerTeam*   m_pOpponents;
+
+  //1 if the team attacks towards +x, else -1, and the centre and half the
+  //extent of the playing area
+  double              m_dAttackSign;
+  Vector2D            m_vCenter;
+  double              m_dHalfLength;
+  double              m_dHalfWidth;
+
+  double              m_dPlayerSpeedScale;
+  double              m_dBallSpeedScale;
+
+  void  ObservePlayer(const SoccerTeam* team, int member, float* features)const;
+
+public:
+
+  explicit TeamObserver(const SoccerTeam* team);
+
+  //writes the observation (ObservationSize floats). TimeLeft is the
+  //fraction of the episode or match still to play
+  void  Observe(float* observation, double TimeLeft)const;
+
+  //turns the team's actions (ActionSize floats) into the pitch's frame
+  void  ReadActions(const float* actions, PlayerAction* out)const;
+
+  int   ObservationSize()const;
+  int   ActionSize()const;
+
+  int   NumPlayers()const;
+
+  //the index of the first feature of a player in an observation. member
+  //is the player's index in its team
+  int   PlayerOffset(bool own, int member)const;
+
+  //the team's goals, and the opponents'
+  int   GoalsFor()const;
+  int   GoalsAgainst()const;
+
+  const SoccerTeam* Team()const{return m_pTeam;}
+};
+
+
+#endif
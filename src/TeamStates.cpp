@@ -1,171 +1,152 @@
-#include "TeamStates.h"
-#include "SoccerTeam.h"
-#include "PlayerBase.h"
-#include "Messaging/MessageDispatcher.h"
-#include "SoccerMessages.h"
-#include "constants.h"
-#include "SoccerPitch.h"
-
-//uncomment to send state info to debug window
-//#define DEBUG_TEAM_STATES
-#include "Debug/DebugConsole.h"
-
-
-
-
-void ChangePlayerHomeRegions(SoccerTeam* team, const int NewRegions[TeamSize])
-{
-  for (int plyr=0; plyr<TeamSize; ++plyr)
-  {
-    team->SetPlayerHomeRegion(plyr, NewRegions[plyr]);
-  }
-}
-
-//************************************************************************ ATTACKING
-
-Attacking* Attacking::Instance()
-{
-  static Attacking instance;
-
-  return &instance;
-}
-
-
-void Attacking::Enter(SoccerTeam* team)
-{
-#ifdef DEBUG_TEAM_STATES
-  debug_con << team->Name() << " entering Attacking state" << "";
-#endif
-
-  //these define the home regions for this state of each of the players
-  //const int BlueRegions[TeamSize] = {1,12,14,6,4};
-  //const int RedRegions[TeamSize] = {16,3,5,9,13};
-  //const int RedRegions[TeamSize] = {16,3,5,7,13};
-
-  //set up the player's home regions
-  if (team->Color() == SoccerTeam::blue)
-  {
-    ChangePlayerHomeRegions(team, FieldConst::BlueAttackingRegions());
-  }
-  else
-  {
-    ChangePlayerHomeRegions(team, FieldConst::RedAttackingRegions());
-  }
-
-  //if a player is in either the Wait or ReturnToHomeRegion states, its
-  //steering target must be updated to that of its new home region to enable
-  //it to move into the correct position.
-  team->UpdateTargetsOfWaitingPlayers();
-}
-
-
-void Attacking::Execute(SoccerTeam* team)
-{
-  //if this team is no longer in control change states
-  if (!team->InControl())
-  {
-    //team->GetFSM()->ChangeState(Defending::Instance()); return;
-	  team->ChangeToDefending();
-	  return;
-  }
-
-  //calculate the best position for any supporting attacker to move to
-  team->DetermineBestSupportingPosition();
-}
-
-void Attacking::Exit(SoccerTeam* team)
-{
-  //there is no supporting player for defense
-  team->SetSupportingPlayer(NULL);
-}
-
-
-
-//************************************************************************ DEFENDING
-
-Defending* Defending::Instance()
-{
-  static Defending instance;
-
-  return &instance;
-}
-
-void Defending::Enter(SoccerTeam* team)
-{
-#ifdef DEBUG_TEAM_STATES
-  debug_con << team->Name() << " entering Defending state" << "";
-#endif
-
-  //these define the home regions for this state of each of the players
-  //const int BlueRegions[TeamSize] = {1,6,8,3,5};
-  //const int RedRegions[TeamSize] = {16,9,11,12,14};
-  //const int RedRegions[TeamSize] = {16,7,10,12,14};
-
-  //set up the player's home regions
-  if (team->Color() == SoccerTeam::blue)
-  {
-    ChangePlayerHomeRegions(team, FieldConst::BlueDefendingRegions());
-  }
-  else
-  {
-    ChangePlayerHomeRegions(team, FieldConst::RedDefendingRegions());
-  }
-  
-  //if a player is in either the Wait or ReturnToHomeRegion states, its
-  //steering target must be updated to that of its new home region
-  team->UpdateTargetsOfWaitingPlayers();
-}
-
-void Defending::Execute(SoccerTeam* team)
-{
-  //if in control change states
-  if (team->InControl())
-  {
-    //team->GetFSM()->ChangeState(Attacking::Instance()); return;
-	  team->ChangeToAttacking();
-	  return;
-  }
-}
-
-
-void Defending::Exit(SoccerTeam* team){}
-
-
-//************************************************************************ KICKOFF
-PrepareForKickOff* PrepareForKickOff::Instance()
-{
-  static PrepareForKickOff instance;
-
-  return &instance;
-}
-
-void PrepareForKickOff::Enter(SoccerTeam* team)
-{
-  // stop the game first!
-  team->Pitch()->SetGameOff();
-
-  //reset key player pointers
-  team->SetControllingPlayer(NULL);
-  team->SetSupportingPlayer(NULL);
-  team->SetReceiver(NULL);
-  team->SetPlayerClosestToBall(NULL);
-
-  //send Msg_GoHome to each player.
-  team->ReturnAllFieldPlayersToHome();
-}
-
-void PrepareForKickOff::Execute(SoccerTeam* team)
-{
-  //if both teams in position, start the game
-  if (team->AllPlayersAtHome() && team->Opponents()->AllPlayersAtHome())
-  {
-    team->GetFSM()->ChangeState(Defending::Instance());
-  }
-}
-
-void PrepareForKickOff::Exit(SoccerTeam* team)
-{
-  team->Pitch()->SetGameOn();
-}
-
-
+#include "TeamStates.h"
+#include "SoccerTeam.h"
+#include "PlayerBase.h"
+#include "Messaging/MessageDispatcher.h"
+#include "SoccerMessages.h"
+#include "constants.h"
+#include "SoccerPitch.h"
+#include "LogMessages.h"
+
+
+
+
+void ChangePlayerHomeRegions(SoccerTeam* team, Formation::tactic tactic)
+{
+  const Formation& formation = team->GetFormation();
+
+  for (int plyr=0; plyr<formation.NumPlayers(); ++plyr)
+  {
+    team->SetPlayerHomeRegion(plyr, formation.Region(tactic, plyr));
+  }
+}
+
+//************************************************************************ ATTACKING
+
+Attacking* Attacking::Instance()
+{
+  static Attacking instance;
+
+  return &instance;
+}
+
+
+void Attacking::Enter(SoccerTeam* team)
+{
+  binlog(log_debug, Log_TeamEnterAttacking, (int)team->Color());
+
+  //these define the home regions for this state of each of the players
+  //const int BlueRegions[TeamSize] = {1,12,14,6,4};
+  //const int RedRegions[TeamSize] = {16,3,5,9,13};
+  //const int RedRegions[TeamSize] = {16,3,5,7,13};
+
+  //set up the player's home regions
+  ChangePlayerHomeRegions(team, Formation::attacking);
+
+  //if a player is in either the Wait or ReturnToHomeRegion states, its
+  //steering target must be updated to that of its new home region to enable
+  //it to move into the correct position.
+  team->UpdateTargetsOfWaitingPlayers();
+}
+
+
+void Attacking::Execute(SoccerTeam* team)
+{
+  //if this team is no longer in control change states
+  if (!team->InControl())
+  {
+    //team->GetFSM()->ChangeState(Defending::Instance()); return;
+	  team->ChangeToDefending();
+	  return;
+  }
+
+  //calculate the best position for any supporting attacker to move to
+  team->DetermineBestSupportingPosition();
+}
+
+void Attacking::Exit(SoccerTeam* team)
+{
+  //there is no supporting player for defense
+  team->SetSupportingPlayer(NULL);
+}
+
+
+
+//************************************************************************ DEFENDING
+
+Defending* Defending::Instance()
+{
+  static Defending instance;
+
+  return &instance;
+}
+
+void Defending::Enter(SoccerTeam* team)
+{
+  binlog(log_debug, Log_TeamEnterDefending, (int)team->Color());
+
+  //these define the home regions for this state of each of the players
+  //const int BlueRegions[TeamSize] = {1,6,8,3,5};
+  //const int RedRegions[TeamSize] = {16,9,11,12,14};
+  //const int RedRegions[TeamSize] = {16,7,10,12,14};
+
+  //set up the player's home regions
+  ChangePlayerHomeRegions(team, Formation::defending);
+  
+  //if a player is in either the Wait or ReturnToHomeRegion states, its
+  //steering target must be updated to that of its new home region
+  team->UpdateTargetsOfWaitingPlayers();
+}
+
+void Defending::Execute(SoccerTeam* team)
+{
+  //if in control change states
+  if (team->InControl())
+  {
+    //team->GetFSM()->ChangeState(Attacking::Instance()); return;
+	  team->ChangeToAttacking();
+	  return;
+  }
+}
+
+
+void Defending::Exit(SoccerTeam* team){}
+
+
+//************************************************************************ KICKOFF
+PrepareForKickOff* PrepareForKickOff::Instance()
+{
+  static PrepareForKickOff instance;
+
+  return &instance;
+}
+
+void PrepareForKickOff::Enter(SoccerTeam* team)
+{
+  // stop the game first!
+  team->Pitch()->SetGameOff();
+
+  //reset key player pointers
+  team->SetControllingPlayer(NULL);
+  team->SetSupportingPlayer(NULL);
+  team->SetReceiver(NULL);
+  team->SetPlayerClosestToBall(NULL);
+
+  //send Msg_GoHome to each player.
+  team->ReturnAllFieldPlayersToHome();
+}
+
+void PrepareForKickOff::Execute(SoccerTeam* team)
+{
+  //if both teams in position, start the game
+  if (team->AllPlayersAtHome() && team->Opponents()->AllPlayersAtHome())
+  {
+    team->GetFSM()->ChangeState(Defending::Instance());
+  }
+}
+
+void PrepareForKickOff::Exit(SoccerTeam* team)
+{
+  team->Pitch()->SetGameOn();
+}
+
+
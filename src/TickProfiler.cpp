@@ -0,0 +1,375 @@
+#include "TickProfiler.h"
+
+#include <cstring>
+#include <cassert>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+
+
+//the names of the zones, in the order of profile_zone
+static const char* ZoneNames[num_profile_zones] =
+{
+  "tick",
+  "message dispatch",
+  "ball update",
+  "red team fsm",
+  "blue team fsm",
+  "player fsm",
+  "steering",
+  "find pass",
+  "can shoot",
+  "support spots"
+};
+
+const char* ProfileZoneName(int zone)
+{
+  assert (zone >= 0 && zone < num_profile_zones && "<ProfileZoneName>: bad zone");
+
+  return ZoneNames[zone];
+}
+
+//returns the index of the highest set bit of a non zero value
+static int HighestBit(unsigned long long val)
+{
+#if defined(__GNUC__)
+  return 63 - __builtin_clzll(val);
+#else
+  int bit = 0;
+
+  while (val >>= 1) ++bit;
+
+  return bit;
+#endif
+}
+
+
+//------------------------------ BinIndex -------------------------------------
+//-----------------------------------------------------------------------------
+int ProfileBuffer::BinIndex(unsigned long long time)
+{
+  if (time < LinearBins) return (int)time;
+
+  int msb = HighestBit(time);
+
+  //the bits below the highest pick the bin within its power of two
+  return LinearBins + (msb - SubBinBits - 1) * SubBins +
+         (int)((time >> (msb - SubBinBits)) & (SubBins - 1));
+}
+
+//------------------------------ BinValue -------------------------------------
+//-----------------------------------------------------------------------------
+unsigned long long ProfileBuffer::BinValue(int bin)
+{
+  if (bin < LinearBins) return (unsigned long long)bin;
+
+  int msb   = (bin - LinearBins) / SubBins + SubBinBits + 1;
+  int sub   = (bin - LinearBins) % SubBins;
+  int shift = msb - SubBinBits;
+
+  return ((unsigned long long)(SubBins + sub) << shift) + (1ULL << shift) / 2;
+}
+
+//------------------------------- Record --------------------------------------
+//-----------------------------------------------------------------------------
+void ProfileBuffer::Record(int zone, unsigned long long time)
+{
+  Zone& z = m_Zones[zone];
+
+  ++z.Count;
+  z.Total += time;
+
+  if (time > z.Max) z.Max = time;
+
+  ++z.Bins[BinIndex(time)];
+}
+
+//-------------------------------- Clear --------------------------------------
+//-----------------------------------------------------------------------------
+void ProfileBuffer::Clear()
+{
+  memset(m_Zones, 0, sizeof(m_Zones));
+}
+
+//-------------------------------- Merge --------------------------------------
+//-----------------------------------------------------------------------------
+void ProfileBuffer::Merge(const ProfileBuffer& other)
+{
+  for (int zone=0; zone<num_profile_zones; ++zone)
+  {
+    Zone&       z = m_Zones[zone];
+    const Zone& o = other.m_Zones[zone];
+
+    z.Count += o.Count;
+    z.Total += o.Total;
+
+    if (o.Max > z.Max) z.Max = o.Max;
+
+    for (int bin=0; bin<NumBins; ++bin)
+    {
+      z.Bins[bin] += o.Bins[bin];
+    }
+  }
+}
+
+
+//------------------------------------------------------------------------
+//
+//  each thread's buffer is created the first time it records a time and
+//  handed back to the profiler when the thread exits
+//------------------------------------------------------------------------
+struct ProfileThreadSlot
+{
+  ProfileBuffer* pBuffer;
+
+  ProfileThreadSlot():pBuffer(NULL){}
+
+  ~ProfileThreadSlot()
+  {
+    if (pBuffer) TickProf->RetireBuffer(pBuffer);
+  }
+};
+
+static thread_local ProfileThreadSlot ThreadSlot;
+
+
+//------------------------------- Instance ------------------------------------
+//-----------------------------------------------------------------------------
+TickProfiler* TickProfiler::Instance()
+{
+  static TickProfiler instance;
+
+  return &instance;
+}
+
+//--------------------------------- ctor --------------------------------------
+//-----------------------------------------------------------------------------
+TickProfiler::TickProfiler():m_bEnabled(false),
+                             m_dSecondsPerUnit(0.0)
+{}
+
+TickProfiler::~TickProfiler()
+{
+  for (unsigned int b=0; b<m_Buffers.size(); ++b)
+  {
+    delete m_Buffers[b];
+  }
+}
+
+//------------------------------- Calibrate -----------------------------------
+//
+//  measures how long a unit of ProfileTimestamp lasts by counting them over
+//  a short wait
+//-----------------------------------------------------------------------------
+void TickProfiler::Calibrate()
+{
+#ifdef PROFILE_USE_RDTSC
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  unsigned long long                    first = ProfileTimestamp();
+
+  double seconds = 0.0;
+
+  while (seconds < 0.02)
+  {
+    seconds = std::chrono::duration<double>(
+                          std::chrono::steady_clock::now() - start).count();
+  }
+
+  m_dSecondsPerUnit = seconds / (double)(ProfileTimestamp() - first);
+#else
+  m_dSecondsPerUnit = 1e-9;
+#endif
+}
+
+//-------------------------------- Enable -------------------------------------
+//-----------------------------------------------------------------------------
+void TickProfiler::Enable(bool enable)
+{
+  if (enable && m_dSecondsPerUnit == 0.0) Calibrate();
+
+  m_bEnabled = enable;
+}
+
+//------------------------------ LocalBuffer ----------------------------------
+//-----------------------------------------------------------------------------
+ProfileBuffer* TickProfiler::LocalBuffer()
+{
+  if (!ThreadSlot.pBuffer)
+  {
+    ThreadSlot.pBuffer = new ProfileBuffer();
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    m_Buffers.push_back(ThreadSlot.pBuffer);
+  }
+
+  return ThreadSlot.pBuffer;
+}
+
+//----------------------------- RetireBuffer ----------------------------------
+//-----------------------------------------------------------------------------
+void TickProfiler::RetireBuffer(ProfileBuffer* buffer)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  for (unsigned int b=0; b<m_Buffers.size(); ++b)
+  {
+    if (m_Buffers[b] == buffer)
+    {
+      m_Retired.Merge(*buffer);
+
+      m_Buffers.erase(m_Buffers.begin() + b);
+
+      delete buffer;
+
+      return;
+    }
+  }
+}
+
+//-------------------------------- Reset --------------------------------------
+//-----------------------------------------------------------------------------
+void TickProfiler::Reset()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  for (unsigned int b=0; b<m_Buffers.size(); ++b)
+  {
+    m_Buffers[b]->Clear();
+  }
+
+  m_Retired.Clear();
+}
+
+//-------------------------------- Report -------------------------------------
+//-----------------------------------------------------------------------------
+std::vector<ProfileZoneReport> TickProfiler::Report()const
+{
+  //a buffer is too big for the stack
+  ProfileBuffer* merged = new ProfileBuffer();
+
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    merged->Merge(m_Retired);
+
+    for (unsigned int b=0; b<m_Buffers.size(); ++b)
+    {
+      merged->Merge(*m_Buffers[b]);
+    }
+  }
+
+  //the report is in microseconds
+  double scale = m_dSecondsPerUnit * 1e6;
+
+  std::vector<ProfileZoneReport> report;
+
+  for (int zone=0; zone<num_profile_zones; ++zone)
+  {
+    const ProfileBuffer::Zone& z = merged->GetZone(zone);
+
+    if (z.Count == 0) continue;
+
+    ProfileZoneReport r;
+
+    r.Zone  = zone;
+    r.Count = z.Count;
+    r.Total = z.Total * scale;
+    r.Max   = z.Max * scale;
+
+    //the times of the samples ranked count/2 and count*99/100
+    unsigned long long RankP50 = (z.Count + 1) / 2;
+    unsigned long long RankP99 = (z.Count * 99 + 99) / 100;
+
+    r.P50 = r.P99 = r.Max;
+
+    unsigned long long seen  = 0;
+    bool               found = false;
+
+    for (int bin=0; bin<ProfileBuffer::NumBins && !found; ++bin)
+    {
+      if (z.Bins[bin] == 0) continue;
+
+      unsigned long long before = seen;
+
+      seen += z.Bins[bin];
+
+      //a bin's middle can lie beyond the largest time put in it
+      unsigned long long time = ProfileBuffer::BinValue(bin);
+
+      if (time > z.Max) time = z.Max;
+
+      double value = time * scale;
+
+      if (before < RankP50 && seen >= RankP50) r.P50 = value;
+
+      if (seen >= RankP99)
+      {
+        r.P99 = value;
+
+        found = true;
+      }
+    }
+
+    report.push_back(r);
+  }
+
+  delete merged;
+
+  return report;
+}
+
+//------------------------------ ReportLines ----------------------------------
+//-----------------------------------------------------------------------------
+std::vector<std::string> TickProfiler::ReportLines()const
+{
+  std::vector<ProfileZoneReport> report = Report();
+
+  std::vector<std::string> lines;
+
+  lines.push_back("zone: p50 / p99 / max (us)");
+
+  for (unsigned int r=0; r<report.size(); ++r)
+  {
+    std::ostringstream ss;
+
+    ss << std::fixed << std::setprecision(1)
+       << ProfileZoneName(report[r].Zone) << ": "
+       << report[r].P50 << " / " << report[r].P99 << " / " << report[r].Max;
+
+    lines.push_back(ss.str());
+  }
+
+  return lines;
+}
+
+//--------------------------------- Dump --------------------------------------
+//-----------------------------------------------------------------------------
+void TickProfiler::Dump(std::ostream& os)const
+{
+  std::vector<ProfileZoneReport> report = Report();
+
+  os << std::left << std::setw(18) << "zone" << std::right
+     << std::setw(12) << "count"
+     << std::setw(12) << "total ms"
+     << std::setw(10) << "p50 us"
+     << std::setw(10) << "p99 us"
+     << std::setw(10) << "max us" << "\n";
+
+  std::ios::fmtflags flags = os.flags();
+
+  os << std::fixed;
+
+  for (unsigned int r=0; r<report.size(); ++r)
+  {
+    os << std::left << std::setw(18) << ProfileZoneName(report[r].Zone)
+       << std::right
+       << std::setw(12) << report[r].Count
+       << std::setw(12) << std::setprecision(1) << report[r].Total / 1000.0
+       << std::setw(10) << std::setprecision(2) << report[r].P50
+       << std::setw(10) << report[r].P99
+       << std::setw(10) << report[r].Max << "\n";
+  }
+
+  os.flags(flags);
+}
@@ -0,0 +1,233 @@
+#ifndef TICKPROFILER_H
+#define TICKPROFILER_H
+#pragma warning (disable:4786)
+//------------------------------------------------------------------------
+//
+//  Name:   TickProfiler.h
+//
+//  Desc:   a lightweight profiler showing where the time of a tick goes.
+//
+//          The code to be measured is marked with PROFILE_SCOPE(zone),
+//          which times the rest of the enclosing block. The times are
+//          taken from the CPU's time stamp counter where there is one
+//          (steady_clock elsewhere) and recorded into a buffer belonging
+//          to the calling thread, so the workers of a MatchExecutor never
+//          contend. Each buffer holds a log-linear histogram of the times
+//          of every zone (16 bins to each power of two), which bounds its
+//          size however long the run and gives the percentiles to within
+//          a few percent.
+//
+//          The profiler is off until Enable is called, when a scope costs
+//          no more than a test of a flag. Zones nest: the time of a zone
+//          includes that of any zones inside it.
+//
+//          The report merges the buffers of every thread, so take it while
+//          no simulation is running (at the end of a match or, in the
+//          windowed build, from the render).
+//
+//------------------------------------------------------------------------
+#include <cstddef>
+#include <vector>
+#include <string>
+#include <iosfwd>
+#include <mutex>
+#include <chrono>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#define PROFILE_USE_RDTSC
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#include <x86intrin.h>
+#define PROFILE_USE_RDTSC
+#endif
+
+
+//the parts of a tick that are timed
+enum profile_zone
+{
+  zone_tick,              //the whole of SoccerPitch::Update
+  zone_message_dispatch,  //dispatching the delayed telegrams
+  zone_ball_update,
+  zone_red_team_fsm,      //the team state machines, not their players
+  zone_blue_team_fsm,
+  zone_player_fsm,        //a player's state machine
+  zone_steering,          //SteeringBehaviors::Calculate
+  zone_find_pass,
+  zone_can_shoot,
+  zone_support_spots,     //scoring the support spots
+
+  num_profile_zones
+};
+
+//the name of a zone as it appears in the report
+const char* ProfileZoneName(int zone);
+
+
+//a time stamp in the profiler's own units. See TickProfiler::SecondsPerUnit
+inline unsigned long long ProfileTimestamp()
+{
+#ifdef PROFILE_USE_RDTSC
+  return __rdtsc();
+#else
+  return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+
+//------------------------------------------------------------------------
+//
+//  the times recorded by one thread
+//------------------------------------------------------------------------
+class ProfileBuffer
+{
+public:
+
+  //values below LinearBins have a bin each; above that each power of two
+  //is split into SubBins bins
+  enum {SubBinBits = 4,
+        SubBins    = 1 << SubBinBits,
+        LinearBins = 2 * SubBins,
+        NumBins    = LinearBins + (64 - SubBinBits - 1) * SubBins};
+
+  struct Zone
+  {
+    unsigned long long  Count;
+    unsigned long long  Total;
+    unsigned long long  Max;
+    unsigned int        Bins[NumBins];
+  };
+
+private:
+
+  Zone  m_Zones[num_profile_zones];
+
+public:
+
+  ProfileBuffer(){Clear();}
+
+  void  Record(int zone, unsigned long long time);
+
+  void  Clear();
+
+  //adds the times of another buffer to this one
+  void  Merge(const ProfileBuffer& other);
+
+  const Zone&  GetZone(int zone)const{return m_Zones[zone];}
+
+  static int                 BinIndex(unsigned long long time);
+
+  //the value in the middle of the range of times put in a bin
+  static unsigned long long  BinValue(int bin);
+};
+
+
+//------------------------------------------------------------------------
+//
+//  the percentiles of one zone, in microseconds
+//------------------------------------------------------------------------
+struct ProfileZoneReport
+{
+  int                 Zone;
+  unsigned long long  Count;
+  double              Total;
+  double              P50;
+  double              P99;
+  double              Max;
+};
+
+
+#define TickProf TickProfiler::Instance()
+
+class TickProfiler
+{
+private:
+
+  bool                         m_bEnabled;
+
+  //how long one unit of ProfileTimestamp lasts, measured when the
+  //profiler is first enabled
+  double                       m_dSecondsPerUnit;
+
+  //the buffers of the threads running now, and the merged buffers of
+  //the threads that have finished
+  std::vector<ProfileBuffer*>  m_Buffers;
+  ProfileBuffer                m_Retired;
+
+  mutable std::mutex           m_Mutex;
+
+  void  Calibrate();
+
+  //the calling thread's buffer, created on first use
+  ProfileBuffer*  LocalBuffer();
+
+  TickProfiler();
+
+  TickProfiler(const TickProfiler&);
+  TickProfiler& operator=(const TickProfiler&);
+
+public:
+
+  ~TickProfiler();
+
+  static TickProfiler* Instance();
+
+  void  Enable(bool enable);
+  bool  isEnabled()const{return m_bEnabled;}
+
+  double SecondsPerUnit()const{return m_dSecondsPerUnit;}
+
+  //the buffer of the calling thread, or NULL if the profiler is off
+  ProfileBuffer*  ThreadBuffer(){return m_bEnabled ? LocalBuffer() : NULL;}
+
+  //called as a thread exits to fold its buffer into m_Retired
+  void  RetireBuffer(ProfileBuffer* buffer);
+
+  //discards everything recorded so far
+  void  Reset();
+
+  //the percentiles of each zone with at least one sample
+  std::vector<ProfileZoneReport>  Report()const;
+
+  //the report as lines of text, for the debug overlay
+  std::vector<std::string>  ReportLines()const;
+
+  //writes the report as a table
+  void  Dump(std::ostream& os)const;
+};
+
+
+//------------------------------------------------------------------------
+//
+//  times the rest of the block it is declared in
+//------------------------------------------------------------------------
+class ProfileScope
+{
+private:
+
+  ProfileBuffer*      m_pBuffer;
+  int                 m_iZone;
+  unsigned long long  m_Start;
+
+  ProfileScope(const ProfileScope&);
+  ProfileScope& operator=(const ProfileScope&);
+
+public:
+
+  explicit ProfileScope(int zone):m_pBuffer(TickProf->ThreadBuffer()),
+                                  m_iZone(zone),
+                                  m_Start(0)
+  {
+    if (m_pBuffer) m_Start = ProfileTimestamp();
+  }
+
+  ~ProfileScope()
+  {
+    if (m_pBuffer) m_pBuffer->Record(m_iZone, ProfileTimestamp() - m_Start);
+  }
+};
+
+#define PROFILE_SCOPE(zone) ProfileScope profile_scope(zone)
+
+
+#endif
@@ -1,24 +1,25 @@
-//{{NO_DEPENDENCIES}}
-// Microsoft Developer Studio generated include file.
-// Used by Script1.rc
-//
-#define IDR_MENU1                       101
-#define IDI_ICON1                       102
-#define IDM_SHOW_IDS                    40001
-#define IDM_SHOW_STATES                 40002
-#define IDM_SHOW_REGIONS                40003
-#define IDM_AIDS_SUPPORTSPOTS           40005
-#define ID_AIDS_SHOWTARGETS             40006
-#define ID_AIDS_NOAIDS                  40007
-#define IDM_AIDS_HIGHLITE               40008
-
-// Next default values for new objects
-// 
-#ifdef APSTUDIO_INVOKED
-#ifndef APSTUDIO_READONLY_SYMBOLS
-#define _APS_NEXT_RESOURCE_VALUE        104
-#define _APS_NEXT_COMMAND_VALUE         40009
-#define _APS_NEXT_CONTROL_VALUE         1000
-#define _APS_NEXT_SYMED_VALUE           101
-#endif
-#endif
+//{{NO_DEPENDENCIES}}
+// Microsoft Developer Studio generated include file.
+// Used by Script1.rc
+//
+#define IDR_MENU1                       101
+#define IDI_ICON1                       102
+#define IDM_SHOW_IDS                    40001
+#define IDM_SHOW_STATES                 40002
+#define IDM_SHOW_REGIONS                40003
+#define IDM_AIDS_SUPPORTSPOTS           40005
+#define ID_AIDS_SHOWTARGETS             40006
+#define ID_AIDS_NOAIDS                  40007
+#define IDM_AIDS_HIGHLITE               40008
+#define IDM_SHOW_PROFILE                40009
+
+// Next default values for new objects
+// 
+#ifdef APSTUDIO_INVOKED
+#ifndef APSTUDIO_READONLY_SYMBOLS
+#define _APS_NEXT_RESOURCE_VALUE        104
+#define _APS_NEXT_COMMAND_VALUE         40010
+#define _APS_NEXT_CONTROL_VALUE         1000
+#define _APS_NEXT_SYMED_VALUE           101
+#endif
+#endif
@@ -0,0 +1,46 @@
+# Plays the same match twice logging to files in DIR, decodes the logs with
+# -decodelog and fails unless every record decodes and, when neither run
+# dropped any, the two logs are the same.
+#
+#   cmake -DRUNNER=<SimpleSoccerHeadless> -DDIR=<directory> -P LogRoundTrip.cmake
+
+foreach(run first second)
+  set(LogFile ${DIR}/${run}.log)
+
+  execute_process(COMMAND ${RUNNER} -matches 1 -ticks 6000 -threads 1 -seed 5
+                                    -log ${LogFile} -loglevel trace
+                  RESULT_VARIABLE MatchResult
+                  OUTPUT_QUIET
+                  ERROR_VARIABLE  MatchErrors)
+
+  if(NOT MatchResult EQUAL 0)
+    message(FATAL_ERROR "the match failed (${MatchResult})\n${MatchErrors}")
+  endif()
+
+  execute_process(COMMAND ${RUNNER} -decodelog ${LogFile}
+                  RESULT_VARIABLE DecodeResult
+                  OUTPUT_VARIABLE Decoded)
+
+  if(NOT DecodeResult EQUAL 0)
+    message(FATAL_ERROR "cannot decode ${LogFile} (${DecodeResult})")
+  endif()
+
+  # a record reads tick, thread, level and the filled in message
+  if(NOT Decoded MATCHES "^0\t0\t[a-z]+\t[^\n]+\n")
+    message(FATAL_ERROR "${LogFile} decoded as\n${Decoded}")
+  endif()
+
+  if(Decoded MATCHES "unknown message|{}")
+    message(FATAL_ERROR "${LogFile} has records that did not decode")
+  endif()
+
+  if(MatchErrors MATCHES "dropped")
+    set(Dropped TRUE)
+  endif()
+
+  set(Decoded_${run} "${Decoded}")
+endforeach()
+
+if(NOT Dropped AND NOT Decoded_first STREQUAL Decoded_second)
+  message(FATAL_ERROR "the logs of the same match differ")
+endif()
@@ -0,0 +1,37 @@
+# Plays a match recording a replay to DIR, plays the replay back with -play
+# and fails unless the playback ends after as many ticks, with the same
+# score, as the match did.
+#
+#   cmake -DRUNNER=<SimpleSoccerHeadless> -DDIR=<directory> -P ReplayRoundTrip.cmake
+
+file(MAKE_DIRECTORY ${DIR})
+
+execute_process(COMMAND ${RUNNER} -matches 1 -ticks 6000 -threads 1 -seed 5 -replay ${DIR}
+                RESULT_VARIABLE MatchResult
+                OUTPUT_VARIABLE MatchOutput)
+
+if(NOT MatchResult EQUAL 0)
+  message(FATAL_ERROR "the match failed (${MatchResult})")
+endif()
+
+# match,ticks,red_goals,blue_goals,...
+if(NOT MatchOutput MATCHES "\n0,([0-9]+),([0-9]+),([0-9]+),")
+  message(FATAL_ERROR "no result in\n${MatchOutput}")
+endif()
+
+set(Ticks     ${CMAKE_MATCH_1})
+set(RedGoals  ${CMAKE_MATCH_2})
+set(BlueGoals ${CMAKE_MATCH_3})
+
+execute_process(COMMAND ${RUNNER} -play ${DIR}/match_0.ssr
+                RESULT_VARIABLE PlayResult
+                OUTPUT_VARIABLE PlayOutput)
+
+if(NOT PlayResult EQUAL 0)
+  message(FATAL_ERROR "the playback failed (${PlayResult})")
+endif()
+
+if(NOT PlayOutput MATCHES ": ${Ticks} ticks,.*, red ${RedGoals} blue ${BlueGoals},")
+  message(FATAL_ERROR "the match ran ${Ticks} ticks, red ${RedGoals} blue ${BlueGoals}, "
+                      "but the playback reported\n${PlayOutput}")
+endif()
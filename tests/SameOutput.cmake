@@ -0,0 +1,28 @@
+# Runs the commands FIRST and SECOND (lists: the program, then its
+# arguments) and fails unless both succeed and write the same to stdout.
+#
+#   cmake -DFIRST=<command> -DSECOND=<command> -P SameOutput.cmake
+
+execute_process(COMMAND ${FIRST}
+                RESULT_VARIABLE FirstResult
+                OUTPUT_VARIABLE FirstOutput)
+
+execute_process(COMMAND ${SECOND}
+                RESULT_VARIABLE SecondResult
+                OUTPUT_VARIABLE SecondOutput)
+
+if(NOT FirstResult EQUAL 0 OR NOT SecondResult EQUAL 0)
+  message(FATAL_ERROR "failed (${FirstResult}, ${SecondResult})")
+endif()
+
+if(FirstOutput STREQUAL "")
+  message(FATAL_ERROR "no output from ${FIRST}")
+endif()
+
+if(NOT FirstOutput STREQUAL SecondOutput)
+  string(REPLACE ";" " " FirstCommand  "${FIRST}")
+  string(REPLACE ";" " " SecondCommand "${SECOND}")
+
+  message(FATAL_ERROR "the output of\n  ${FirstCommand}\n${FirstOutput}\n"
+                      "differs from that of\n  ${SecondCommand}\n${SecondOutput}")
+endif()